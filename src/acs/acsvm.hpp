@@ -32,6 +32,7 @@
 #include <ACSVM/List.hpp>
 #include <ACSVM/Module.hpp>
 #include <ACSVM/PrintBuf.hpp>
+#include <ACSVM/ProfileData.hpp>
 #include <ACSVM/Scope.hpp>
 #include <ACSVM/Script.hpp>
 #include <ACSVM/Serial.hpp>
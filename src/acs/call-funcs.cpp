@@ -80,27 +80,12 @@ static bool ACS_GetMobjTypeFromString(const char *word, mobjtype_t *type)
 		word += 3;
 	}
 
-	for (int i = 0; i < NUMMOBJFREESLOTS; i++)
-	{
-		if (!FREE_MOBJS[i])
-		{
-			break;
-		}
-
-		if (fastcmp(word, FREE_MOBJS[i]))
-		{
-			*type = static_cast<mobjtype_t>(static_cast<int>(MT_FIRSTFREESLOT) + i);
-			return true;
-		}
-	}
+	int32_t i = DEH_FindConstant(DEHCONST_MOBJ, word);
 
-	for (int i = 0; i < MT_FIRSTFREESLOT; i++)
+	if (i != -1)
 	{
-		if (fastcmp(word, MOBJTYPE_LIST[i] + 3))
-		{
-			*type = static_cast<mobjtype_t>(i);
-			return true;
-		}
+		*type = static_cast<mobjtype_t>(i);
+		return true;
 	}
 
 	return false;
@@ -132,13 +117,12 @@ static bool ACS_GetSFXFromString(const char *word, sfxenum_t *type)
 		word += 2;
 	}
 
-	for (int i = 0; i < NUMSFX; i++)
+	int32_t i = DEH_FindConstant(DEHCONST_SFX, word);
+
+	if (i != -1)
 	{
-		if (S_sfx[i].name && fasticmp(word, S_sfx[i].name))
-		{
-			*type = static_cast<sfxenum_t>(i);
-			return true;
-		}
+		*type = static_cast<sfxenum_t>(i);
+		return true;
 	}
 
 	return false;
@@ -231,27 +215,12 @@ static bool ACS_GetStateFromString(const char *word, statenum_t *type)
 		word += 2;
 	}
 
-	for (int i = 0; i < NUMMOBJFREESLOTS; i++)
-	{
-		if (!FREE_STATES[i])
-		{
-			break;
-		}
+	int32_t i = DEH_FindConstant(DEHCONST_STATE, word);
 
-		if (fastcmp(word, FREE_STATES[i]))
-		{
-			*type = static_cast<statenum_t>(static_cast<int>(S_FIRSTFREESLOT) + i);
-			return true;
-		}
-	}
-
-	for (int i = 0; i < S_FIRSTFREESLOT; i++)
+	if (i != -1)
 	{
-		if (fastcmp(word, STATE_LIST[i] + 2))
-		{
-			*type = static_cast<statenum_t>(i);
-			return true;
-		}
+		*type = static_cast<statenum_t>(i);
+		return true;
 	}
 
 	return false;
@@ -28,6 +28,8 @@
 #include "../z_zone.h"
 #include "../p_local.h"
 #include "../k_dialogue.hpp"
+#include "../command.h"
+#include "../i_system.h"
 
 #include "environment.hpp"
 #include "thread.hpp"
@@ -36,6 +38,8 @@
 
 using namespace srb2::acs;
 
+extern "C" consvar_t cv_acs_profile;
+
 Environment ACSEnv;
 
 Environment::Environment()
@@ -445,3 +449,14 @@ void Environment::printKill(ACSVM::Thread *thread, ACSVM::Word type, ACSVM::Word
 
 	CONS_Printf("Script terminated.\n");
 }
+
+ACSVM::ProfileTime Environment::getProfileTime() const
+{
+	// ACSVM only collects profiling data while this is nonzero.
+	if (!cv_acs_profile.value)
+	{
+		return 0;
+	}
+
+	return static_cast<ACSVM::ProfileTime>(I_GetPreciseTime()) / I_GetPrecisePrecision();
+}
@@ -34,6 +34,8 @@ public:
 
 	virtual void printKill(ACSVM::Thread *thread, ACSVM::Word type, ACSVM::Word data);
 
+	virtual ACSVM::ProfileTime getProfileTime() const;
+
 protected:
 	virtual void loadModule(ACSVM::Module *module);
 
@@ -16,6 +16,7 @@
 #include <istream>
 #include <ostream>
 #include <span>
+#include <string>
 #include <vector>
 
 #include "acsvm.hpp"
@@ -27,6 +28,7 @@
 #include "../doomstat.h"
 
 #include "../r_defs.h"
+#include "../command.h"
 #include "../g_game.h"
 #include "../i_system.h"
 #include "../p_saveg.h"
@@ -39,6 +41,8 @@
 
 using namespace srb2::acs;
 
+extern "C" consvar_t cv_acs_profile;
+
 using std::size_t;
 
 /*--------------------------------------------------
@@ -611,4 +615,73 @@ void ACS_UnArchive(savebuffer_t *save)
 	}
 }
 
+/*--------------------------------------------------
+	void ACS_ResetProfile(void)
+
+		See header file for description.
+--------------------------------------------------*/
+void ACS_ResetProfile(void)
+{
+	Environment *env = &ACSEnv;
+
+	env->resetProfileData();
+}
+
+/*--------------------------------------------------
+	void ACS_DumpProfile(size_t count)
+
+		See header file for description.
+--------------------------------------------------*/
+void ACS_DumpProfile(size_t count)
+{
+	Environment *env = &ACSEnv;
+
+	ACSVM::GlobalScope *const global = env->getGlobalScope(0);
+	ACSVM::HubScope *const hub = global->getHubScope(0);
+	ACSVM::MapScope *const map = hub->getMapScope(0);
+
+	std::vector<const ACSVM::HashMapFixed<ACSVM::Script *, ACSVM::ProfileData>::Elem *> hot;
+
+	for (const auto &elem : map->profileScript)
+	{
+		if (elem.val)
+		{
+			hot.push_back(&elem);
+		}
+	}
+
+	if (hot.empty())
+	{
+		CONS_Printf("No ACS profiling data. %s\n",
+			cv_acs_profile.value ? "Have any scripts run yet?" : "Turn on acs_profile first.");
+		return;
+	}
+
+	std::sort(
+		hot.begin(), hot.end(),
+		[](auto a, auto b) { return a->val.timeTot > b->val.timeTot; }
+	);
+
+	count = std::min(count, hot.size());
+
+	CONS_Printf("Hottest %s of %s profiled ACS scripts:\n", sizeu1(count), sizeu2(hot.size()));
+	CONS_Printf("%10s %10s %8s %8s %12s  %s\n", "total ms", "max ms", "slices", "runs", "insts", "script");
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const ACSVM::Script *script = hot[i]->key;
+		const ACSVM::ProfileData &prof = hot[i]->val;
 
+		std::string name;
+
+		if (script->name.s && script->name.s->len)
+			name = std::string(script->name.s->str);
+		else
+			name = std::to_string((int)script->name.i);
+
+		CONS_Printf("%10.3f %10.3f %8s %8s %12s  %s\n",
+			prof.timeTot * 1000.0, prof.timeMax * 1000.0,
+			sizeu1(prof.timeNum), sizeu2(prof.callNum), sizeu3(prof.instNum),
+			name.c_str());
+	}
+}
@@ -366,6 +366,34 @@ void ACS_Archive(savebuffer_t *save);
 
 void ACS_UnArchive(savebuffer_t *save);
 
+
+/*--------------------------------------------------
+	void ACS_ResetProfile(void);
+
+		Clears the time and instruction counters
+		collected for every script while acs_profile
+		is enabled.
+--------------------------------------------------*/
+
+void ACS_ResetProfile(void);
+
+
+/*--------------------------------------------------
+	void ACS_DumpProfile(size_t count);
+
+		Prints the scripts of the current map that
+		have taken the most time since profiling was
+		enabled, hottest first.
+
+	Input Arguments:-
+		count: Maximum number of scripts to print.
+
+	Return:-
+		None
+--------------------------------------------------*/
+
+void ACS_DumpProfile(size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,7 +31,7 @@ namespace ACSVM
       ProfileData() :
          callMax{0}, callMin{0}, callTot{0},
          timeMax{0}, timeMin{0}, timeTot{0},
-         callNum{0}, timeNum{0}
+         callNum{0}, timeNum{0}, instNum{0}
       {
       }
 
@@ -39,6 +39,11 @@ namespace ACSVM
 
       void addCall();
 
+      //
+      // addInst
+      //
+      void addInst(std::size_t n) {instNum += n;}
+
       void addTime(ProfileTime pt);
 
       void loadState(Serial &in);
@@ -51,6 +56,7 @@ namespace ACSVM
          callMax = callMin = callTot = 0;
          timeMax = timeMin = timeTot = 0;
          callNum = timeNum = 0;
+         instNum = 0;
       }
 
       void saveState(Serial &out) const;
@@ -65,6 +71,9 @@ namespace ACSVM
 
       std::size_t callNum;
       std::size_t timeNum;
+
+      // Instructions executed. Not serialized.
+      std::size_t instNum;
    };
 }
 
@@ -740,6 +740,15 @@ namespace ACSVM
       }
    }
 
+   //
+   // MapScope::addProfileInst
+   //
+   void MapScope::addProfileInst(Script *script, std::size_t n)
+   {
+      if(auto lookup = profileScript.find(script))
+         lookup->addInst(n);
+   }
+
    //
    // MapScope::addProfileTime Function
    //
@@ -174,6 +174,8 @@ namespace ACSVM
       void addProfileCall(Function *func, ProfileTime pt);
       void addProfileCall(Script *script, ProfileTime pt);
 
+      void addProfileInst(Script *script, std::size_t n);
+
       void addProfileTime(Function *func, ProfileTime pt);
       void addProfileTime(Script *script, ProfileTime pt);
 
@@ -77,8 +77,16 @@
 //
 // NextCase
 //
+// Also counts executed instructions for profiling.
+//
 #if ACSVM_DynamicGoto
-#define NextCase() goto *cases[*codePtr++]
+#define NextCase() \
+   do \
+   { \
+      ++instC; \
+      goto *cases[*codePtr++]; \
+   } \
+   while(0)
 #else
 #define NextCase() goto next_case
 #endif
@@ -273,6 +281,7 @@ namespace ACSVM
 
       auto branches = env->branchLimit;
       ProfileTime ptStart = 0;
+      std::size_t instC   = 0;
 
    exec_intr:
       switch(state.state)
@@ -324,7 +333,7 @@ namespace ACSVM
       #if ACSVM_DynamicGoto
       NextCase();
       #else
-      next_case: switch(*codePtr++)
+      next_case: ++instC; switch(*codePtr++)
       #endif
       {
       DeclCase(Nop):
@@ -658,6 +667,8 @@ namespace ACSVM
       {
          auto ptEnd = env->getProfileTime();
 
+         scopeMap->addProfileInst(script, instC);
+
          // If in a function, apply latent times for the call stack.
          if(function)
          {
@@ -685,6 +696,8 @@ namespace ACSVM
       {
          auto ptEnd = env->getProfileTime();
 
+         scopeMap->addProfileInst(script, instC);
+
          // If in a function, apply latent times for the call stack.
          if(function)
          {
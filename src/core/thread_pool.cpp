@@ -26,6 +26,11 @@
 
 using namespace srb2;
 
+// Set on pool worker threads. Identifies the pool by its alive flag, which
+// stays put when the pool object is moved.
+static thread_local const std::atomic<bool>* tl_worker_pool = nullptr;
+static thread_local ThreadPool::Queue* tl_local_queue = nullptr;
+
 static void do_work(ThreadPool::Task& work)
 {
 	try
@@ -45,13 +50,28 @@ static void do_work(ThreadPool::Task& work)
 	}
 }
 
+template <typename Queues>
+static bool any_queued(const Queues& qs)
+{
+	for (auto& q : qs)
+	{
+		if (!q->empty())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 static void pool_executor(
 	int thread_index,
 	std::shared_ptr<std::atomic<bool>> pool_alive,
 	std::shared_ptr<std::mutex> worker_ready_mutex,
 	std::shared_ptr<std::condition_variable> worker_ready_condvar,
 	std::shared_ptr<ThreadPool::Queue> my_wq,
-	srb2::Vector<std::shared_ptr<ThreadPool::Queue>> other_wqs
+	srb2::Vector<std::shared_ptr<ThreadPool::Queue>> other_wqs,
+	std::shared_ptr<ThreadPool::Queue> my_local_wq,
+	srb2::Vector<std::shared_ptr<ThreadPool::Queue>> other_local_wqs
 )
 {
 	{
@@ -59,44 +79,54 @@ static void pool_executor(
 		tracy::SetThreadName(thread_name.c_str());
 	}
 
+	tl_worker_pool = pool_alive.get();
+	tl_local_queue = my_local_wq.get();
+
 	int spins = 0;
 	while (true)
 	{
-		std::optional<ThreadPool::Task> work = my_wq->steal();
-		bool did_work = false;
-		if (work)
+		// Newest first from our own deque, since it's what we just spawned and
+		// is still in cache. Then the main thread's queue for us, then steal.
+		std::optional<ThreadPool::Task> work = my_local_wq->pop();
+		if (!work)
 		{
-			do_work(*work);
-
-			did_work = true;
-			spins = 0;
+			work = my_wq->steal();
 		}
-		else
+		if (!work)
+		{
+			// We only want to steal one work item at a time, to prioritize our own queue
+			for (auto& q : other_local_wqs)
+			{
+				if ((work = q->steal()))
+				{
+					break;
+				}
+			}
+		}
+		if (!work)
 		{
 			for (auto& q : other_wqs)
 			{
-				work = q->steal();
-				if (work)
+				if ((work = q->steal()))
 				{
-					do_work(*work);
-
-					did_work = true;
-					spins = 0;
-
-					// We only want to steal one work item at a time, to prioritize our own queue
 					break;
 				}
 			}
 		}
 
-		if (!did_work)
+		if (work)
+		{
+			do_work(*work);
+			spins = 0;
+		}
+		else
 		{
 			// Spin a few loops to avoid yielding, then wait for the ready lock
 			spins += 1;
 			if (spins > 100)
 			{
 				std::unique_lock<std::mutex> ready_lock {*worker_ready_mutex};
-				while (my_wq->empty() && pool_alive->load())
+				while (my_wq->empty() && !any_queued(other_local_wqs) && pool_alive->load())
 				{
 					worker_ready_condvar->wait(ready_lock);
 				}
@@ -108,6 +138,9 @@ static void pool_executor(
 			}
 		}
 	}
+
+	tl_worker_pool = nullptr;
+	tl_local_queue = nullptr;
 }
 
 ThreadPool::ThreadPool()
@@ -124,6 +157,7 @@ ThreadPool::ThreadPool(size_t threads)
 	{
 		std::shared_ptr<Queue> wsq = std::make_shared<Queue>(2048);
 		work_queues_.push_back(wsq);
+		local_queues_.push_back(std::make_shared<Queue>(256));
 
 		std::shared_ptr<std::mutex> mutex = std::make_shared<std::mutex>();
 		worker_ready_mutexes_.push_back(std::move(mutex));
@@ -135,6 +169,7 @@ ThreadPool::ThreadPool(size_t threads)
 	{
 		std::shared_ptr<Queue> my_queue = work_queues_[i];
 		srb2::Vector<std::shared_ptr<Queue>> other_queues;
+		srb2::Vector<std::shared_ptr<Queue>> other_local_queues;
 		for (size_t j = 0; j < threads; j++)
 		{
 			// Order the other queues starting from the next adjacent worker
@@ -150,6 +185,7 @@ ThreadPool::ThreadPool(size_t threads)
 			if (other_index != i)
 			{
 				other_queues.push_back(work_queues_[other_index]);
+				other_local_queues.push_back(local_queues_[other_index]);
 			}
 		}
 
@@ -164,7 +200,9 @@ ThreadPool::ThreadPool(size_t threads)
 				worker_ready_mutexes_[i],
 				worker_ready_condvars_[i],
 				my_queue,
-				other_queues
+				other_queues,
+				local_queues_[i],
+				other_local_queues
 			};
 		}
 		catch (const std::system_error& error)
@@ -182,10 +220,28 @@ ThreadPool::ThreadPool(size_t threads)
 	}
 }
 
-ThreadPool::ThreadPool(ThreadPool&&) = default;
+ThreadPool::ThreadPool(ThreadPool&& rhs)
+{
+	*this = std::move(rhs);
+}
+
 ThreadPool::~ThreadPool() = default;
 
-ThreadPool& ThreadPool::operator=(ThreadPool&&) = default;
+ThreadPool& ThreadPool::operator=(ThreadPool&& rhs)
+{
+	pool_alive_ = std::move(rhs.pool_alive_);
+	worker_ready_mutexes_ = std::move(rhs.worker_ready_mutexes_);
+	worker_ready_condvars_ = std::move(rhs.worker_ready_condvars_);
+	work_queues_ = std::move(rhs.work_queues_);
+	local_queues_ = std::move(rhs.local_queues_);
+	threads_ = std::move(rhs.threads_);
+	next_queue_index_ = rhs.next_queue_index_;
+	cur_sema_ = std::move(rhs.cur_sema_);
+	immediate_mode_ = rhs.immediate_mode_;
+	// Atomics can't be moved, so the default wouldn't compile
+	sema_begun_.store(rhs.sema_begun_.load());
+	return *this;
+}
 
 void ThreadPool::begin_sema()
 {
@@ -200,14 +256,81 @@ ThreadPool::Sema ThreadPool::end_sema()
 	return ret;
 }
 
+bool ThreadPool::on_worker_thread() const
+{
+	return pool_alive_ != nullptr && tl_worker_pool == pool_alive_.get();
+}
+
+void ThreadPool::push_task(Task&& task)
+{
+	if (on_worker_thread())
+	{
+		tl_local_queue->push(std::move(task));
+		return;
+	}
+
+	work_queues_[next_queue_index_]->push(std::move(task));
+	// worker_ready_condvars_[qi]->notify_one();
+
+	next_queue_index_ += 1;
+	if (next_queue_index_ >= threads_.size())
+	{
+		next_queue_index_ = 0;
+	}
+}
+
+bool ThreadPool::run_one()
+{
+	std::optional<Task> work;
+
+	if (on_worker_thread())
+	{
+		work = tl_local_queue->pop();
+		for (size_t i = 0; !work && i < work_queues_.size(); i++)
+		{
+			work = work_queues_[i]->steal();
+		}
+	}
+	else
+	{
+		// The main thread owns these, so it takes from the back like a worker would
+		for (size_t i = 0; !work && i < work_queues_.size(); i++)
+		{
+			work = work_queues_[i]->pop();
+		}
+	}
+
+	for (size_t i = 0; !work && i < local_queues_.size(); i++)
+	{
+		if (local_queues_[i].get() != tl_local_queue)
+		{
+			work = local_queues_[i]->steal();
+		}
+	}
+
+	if (!work)
+	{
+		return false;
+	}
+
+	do_work(*work);
+	return true;
+}
+
 void ThreadPool::notify()
 {
+	// Work spawned by tasks can be stolen by anyone, so it wakes every worker
+	const bool local_work = any_queued(local_queues_);
+
 	for (size_t i = 0; i < work_queues_.size(); i++)
 	{
 		auto& q = work_queues_[i];
 		size_t count = q->size();
-		if (count > 0)
+		if (count > 0 || local_work)
 		{
+			// The worker checks its queues under this lock before it waits, so
+			// taking it here means the wakeup can't land in between and be lost
+			std::lock_guard<std::mutex> ready_lock {*worker_ready_mutexes_[i]};
 			worker_ready_condvars_[i]->notify_one();
 		}
 	}
@@ -231,15 +354,8 @@ void ThreadPool::wait_idle()
 
 	ZoneScoped;
 
-	for (size_t i = 0; i < work_queues_.size(); i++)
+	while (run_one())
 	{
-		auto& q = work_queues_[i];
-
-		std::optional<Task> work;
-		while ((work = q->pop()).has_value())
-		{
-			do_work(*work);
-		}
 	}
 }
 
@@ -255,17 +371,7 @@ void ThreadPool::wait_sema(const Sema& sema)
 	while (sema.pseudosema_->load(std::memory_order_seq_cst) > 0)
 	{
 		// spin to win
-		for (size_t i = 0; i < work_queues_.size(); i++)
-		{
-			auto& q = work_queues_[i];
-
-			std::optional<Task> work;
-			if ((work = q->pop()).has_value())
-			{
-				do_work(*work);
-				break;
-			}
-		}
+		run_one();
 	}
 
 	if (sema.pseudosema_->load(std::memory_order_seq_cst) != 0)
@@ -285,9 +391,10 @@ void ThreadPool::shutdown()
 
 	pool_alive_->store(false);
 
-	for (auto& condvar : worker_ready_condvars_)
+	for (size_t i = 0; i < worker_ready_condvars_.size(); i++)
 	{
-		condvar->notify_all();
+		std::lock_guard<std::mutex> ready_lock {*worker_ready_mutexes_[i]};
+		worker_ready_condvars_[i]->notify_all();
 	}
 	for (auto& t : threads_)
 	{
@@ -345,3 +452,12 @@ void I_ThreadPoolWaitIdle(void)
 
 	g_main_threadpool->wait_idle();
 }
+
+void I_ThreadPoolParallelFor(size_t begin, size_t end, size_t grain, srb2cparallelfor_t fn, void* data)
+{
+	SRB2_ASSERT(g_main_threadpool != nullptr);
+
+	g_main_threadpool->parallel_for(begin, end, grain, [=](size_t first, size_t last) {
+		(fn)(first, last, data);
+	});
+}
@@ -15,8 +15,11 @@
 
 #ifdef __cplusplus
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -57,13 +60,23 @@ private:
 	std::shared_ptr<std::atomic<bool>> pool_alive_;
 	std::vector<std::shared_ptr<std::mutex>> worker_ready_mutexes_;
 	std::vector<std::shared_ptr<std::condition_variable>> worker_ready_condvars_;
+	/// Owned by the main thread, which pushes to them round-robin; workers steal
 	std::vector<std::shared_ptr<Queue>> work_queues_;
+	/// One per worker, owned by that worker for tasks scheduled from inside a task; everyone else steals
+	std::vector<std::shared_ptr<Queue>> local_queues_;
 	std::vector<std::thread> threads_;
 	size_t next_queue_index_ = 0;
 	std::shared_ptr<std::atomic<uint32_t>> cur_sema_;
 
 	bool immediate_mode_ = false;
-	bool sema_begun_ = false;
+	std::atomic<bool> sema_begun_ {false};
+
+	template <typename T> static Task make_task(T&& thunk);
+	/// Push to the calling worker's own queue, or round-robin if called from the main thread
+	void push_task(Task&& task);
+	bool on_worker_thread() const;
+	/// Run one queued task from anywhere in the pool. Returns false if none were found.
+	bool run_one();
 
 public:
 	ThreadPool();
@@ -86,6 +99,14 @@ public:
 	void wait_idle();
 	void wait_sema(const Sema& sema);
 	void shutdown();
+
+	/// Calls body(first, last) over [begin, end) in chunks of at least grain items.
+	/// Chunks start large and shrink as the range drains, so uneven iterations
+	/// still balance out. The calling thread takes part and returns when every
+	/// chunk is done. Safe to call from inside a task.
+	template <typename F> void parallel_for(size_t begin, size_t end, size_t grain, F&& body);
+
+	size_t worker_count() const noexcept { return threads_.size(); }
 };
 
 extern std::unique_ptr<ThreadPool> g_main_threadpool;
@@ -103,43 +124,141 @@ void callable_destroyer(F* f)
 }
 
 template <typename T>
-void ThreadPool::schedule(T&& thunk)
+ThreadPool::Task ThreadPool::make_task(T&& thunk)
 {
-	static_assert(sizeof(T) <= sizeof(std::declval<Task>().raw));
+	using F = std::remove_cv_t<std::remove_reference_t<T>>;
+	static_assert(sizeof(F) <= sizeof(std::declval<Task>().raw));
+
+	Task task;
+	task.thunk = reinterpret_cast<void(*)(void*)>(callable_caller<F>);
+	task.deleter = reinterpret_cast<void(*)(void*)>(callable_destroyer<F>);
+	new (reinterpret_cast<F*>(task.raw.data())) F(std::forward<T>(thunk));
+	return task;
+}
 
+template <typename T>
+void ThreadPool::schedule(T&& thunk)
+{
 	if (immediate_mode_)
 	{
 		(thunk)();
 		return;
 	}
 
-	if (sema_begun_)
+	Task task = make_task(std::forward<T>(thunk));
+
+	// Semas belong to the main thread. Tasks spawned by other tasks are
+	// waited on by whoever spawned them.
+	if (sema_begun_ && !on_worker_thread())
 	{
 		if (cur_sema_ == nullptr)
 		{
 			cur_sema_ = std::make_shared<std::atomic<uint32_t>>(0);
 		}
 		cur_sema_->fetch_add(1, std::memory_order_relaxed);
+		task.pseudosema = cur_sema_;
+	}
+
+	push_task(std::move(task));
+}
+
+template <typename F>
+void ThreadPool::parallel_for(size_t begin, size_t end, size_t grain, F&& body)
+{
+	if (begin >= end)
+	{
+		return;
 	}
 
-	size_t qi = next_queue_index_;
+	grain = std::max<size_t>(grain, 1);
+	const size_t chunks = (end - begin + grain - 1) / grain;
 
+	if (immediate_mode_ || chunks <= 1)
 	{
-		std::shared_ptr<Queue> q = work_queues_[qi];
-		Task task;
-		task.thunk = reinterpret_cast<void(*)(void*)>(callable_caller<T>);
-		task.deleter = reinterpret_cast<void(*)(void*)>(callable_destroyer<T>);
-		task.pseudosema = cur_sema_;
-		new (reinterpret_cast<T*>(task.raw.data())) T(std::move(thunk));
+		body(begin, end);
+		return;
+	}
+
+	struct State
+	{
+		std::atomic<size_t> next;
+		size_t end;
+		size_t grain;
+		size_t divisor;
+		std::atomic<size_t> helpers;
+		std::remove_reference_t<F>* body;
+		std::mutex error_mutex;
+		std::exception_ptr error;
+	};
 
-		q->push(std::move(task));
+	const size_t helpers = std::min(worker_count(), chunks - 1);
+	State state {begin, end, grain, (helpers + 1) * 2, helpers, &body, {}, {}};
+
+	auto run = [](State& s)
+	{
+		size_t first = s.next.load(std::memory_order_relaxed);
+		while (first < s.end)
+		{
+			// Guided chunking: claim a share of what is left, never less than grain
+			size_t last = first + std::max(s.grain, (s.end - first) / s.divisor);
+			last = std::min(last, s.end);
+			if (s.next.compare_exchange_weak(first, last, std::memory_order_relaxed))
+			{
+				(*s.body)(first, last);
+				first = s.next.load(std::memory_order_relaxed);
+			}
+		}
+	};
+
+	// Keep the first exception and stop handing out chunks
+	auto fail = [](State& s)
+	{
+		std::lock_guard<std::mutex> lock(s.error_mutex);
+		if (!s.error)
+		{
+			s.error = std::current_exception();
+		}
+		s.next.store(s.end, std::memory_order_relaxed);
+	};
+
+	for (size_t i = 0; i < helpers; i++)
+	{
+		push_task(make_task([&state, run, fail]() {
+			try
+			{
+				run(state);
+			}
+			catch (...)
+			{
+				fail(state);
+			}
+			state.helpers.fetch_sub(1, std::memory_order_release);
+		}));
 	}
-	// worker_ready_condvars_[qi]->notify_one();
+	notify();
 
-	next_queue_index_ += 1;
-	if (next_queue_index_ >= threads_.size())
+	try
 	{
-		next_queue_index_ = 0;
+		run(state);
+	}
+	catch (...)
+	{
+		fail(state);
+	}
+
+	// Helpers reference this stack frame, so they must all finish, even the
+	// ones that never got a chunk.
+	while (state.helpers.load(std::memory_order_acquire) > 0)
+	{
+		if (!run_one())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (state.error)
+	{
+		std::rethrow_exception(state.error);
 	}
 }
 
@@ -156,6 +275,11 @@ void I_ThreadPoolShutdown(void);
 void I_ThreadPoolSubmit(srb2cthunk_t thunk, void* data);
 void I_ThreadPoolWaitIdle(void);
 
+typedef void (*srb2cparallelfor_t)(size_t first, size_t last, void* data);
+
+/// Calls fn over [begin, end) on the pool; see srb2::ThreadPool::parallel_for
+void I_ThreadPoolParallelFor(size_t begin, size_t end, size_t grain, srb2cparallelfor_t fn, void* data);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -568,6 +568,9 @@ consvar_t cv_screenshake = Server("screenshake", "Full").values({{0, "Off"}, {1,
 
 consvar_t cv_rendezvousserver = Server("holepunchserver", "relay.kartkrew.org");
 
+// How gamestates sent to joining players are compressed
+consvar_t cv_gamestatecompression = Server("gamestatecompression", "LZF").values({{0, "LZF"}, {1, "Zlib"}});
+
 void Update_parameters (void);
 consvar_t cv_server_contact = Server("server_contact", "").onchange_noinit(Update_parameters);
 consvar_t cv_servername = Server("servername", "Ring Racers server").onchange_noinit(Update_parameters);
@@ -931,6 +934,10 @@ consvar_t cv_vorpal = ServerCheat("vorpal", "No").yes_no().description("Show rea
 
 void lua_profile_OnChange(void);
 consvar_t cv_lua_profile = PlayerCheat("lua_profile", "0").values(CV_Unsigned).onchange(lua_profile_OnChange).description("Show hook timings over an average of N tics");
+consvar_t cv_lua_gcbudget = Player("lua_gcbudget", "500").values(CV_Unsigned).description("Microseconds of Lua garbage collection to run after each tic, 0 lets Lua collect whenever it wants");
+
+void ACS_ResetProfile(void);
+consvar_t cv_acs_profile = PlayerCheat("acs_profile", "Off").on_off().onchange(ACS_ResetProfile).description("Collect time and instruction counts for ACS scripts, see acs_dumpprofile");
 
 void CV_palette_OnChange(void);
 consvar_t cv_palette = PlayerCheat("palette", "").onchange_noinit(CV_palette_OnChange).description("Force palette to a different lump");
@@ -48,10 +48,15 @@
 #include "m_argv.h"
 #include "p_setup.h"
 #include "lzf.h"
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#include "core/thread_pool.h"
 #include "lua_script.h"
 #include "lua_hook.h"
 #include "md5.h"
 #include "m_perfstats.h"
+#include "m_benchtics.h"
 #include "monocypher/monocypher.h"
 #include "stun.h"
 
@@ -123,6 +128,34 @@ static dboolean resendingsavegame[MAXNETNODES]; // Are we resending the savegame
 static tic_t savegameresendcooldown[MAXNETNODES]; // How long before we can resend again?
 static tic_t freezetimeout[MAXNETNODES]; // Until when can this node freeze the server before getting a timeout?
 
+// A gamestate saved and compressed once, then sent to every node that needs it on the same tic
+#define MAXSAVEGAMESNAPSHOTS 4
+
+// Set in the length in front of a sent gamestate when it was compressed with zlib instead of LZF
+#define SAVEGAME_ZLIB 0x80000000
+
+typedef struct
+{
+	dboolean inuse;
+	tic_t tic;
+	gamestate_t state;
+	dboolean resending;
+	dboolean usezlib;
+	savebuffer_t save; // Uncompressed, with room for the length in front
+	size_t length;
+	uint8_t *tosend; // AllocSharedRam block, filled in by SV_CompressSaveGameSnapshot
+	size_t sendlength;
+	dboolean done; // Set once tosend is ready, guarded by savegamesnapshotmutex
+	int32_t waiting; // Number of nodes in pendingsavegame using it
+} savegamesnapshot_t;
+
+static savegamesnapshot_t savegamesnapshots[MAXSAVEGAMESNAPSHOTS];
+static savegamesnapshot_t *cursavegamesnapshot = NULL;
+static savegamesnapshot_t *pendingsavegame[MAXNETNODES]; // Waiting on compression before it can be queued
+#ifdef HAVE_THREADS
+static I_mutex savegamesnapshotmutex;
+#endif
+
 // Incremented by cv_joindelay when a client joins, decremented each tic.
 // If higher than cv_joindelay * 2 (3 joins in a short timespan), joins are temporarily disabled.
 static tic_t joindelay = 0;
@@ -1320,67 +1353,252 @@ static dboolean SV_ResendingSavegameToAnyone(void)
 	return false;
 }
 
-static void SV_SendSaveGame(int32_t node, dboolean resending)
+// Can run on another thread, only touches the snapshot
+static void SV_CompressSaveGameSnapshot(void *userdata)
 {
-	size_t length, compressedlen;
-	savebuffer_t save = {0};
-	uint8_t *compressedsave;
-	uint8_t *buffertosend;
+	savegamesnapshot_t *snapshot = (savegamesnapshot_t *)userdata;
+	const size_t payload = snapshot->length - sizeof(uint32_t);
+	uint8_t *p = snapshot->tosend;
+	size_t compressedlen;
+	uint32_t method = 0;
+
+#ifdef HAVE_ZLIB
+	if (snapshot->usezlib)
+	{
+		uLongf destlen = payload - 1;
+
+		// Slower than LZF, but it's not on the main thread and the result is a lot smaller
+		compressedlen = 0;
+		if (compress2(snapshot->tosend + sizeof(uint32_t), &destlen, snapshot->save.buffer + sizeof(uint32_t), payload, Z_BEST_COMPRESSION) == Z_OK)
+		{
+			compressedlen = destlen;
+			method = SAVEGAME_ZLIB;
+		}
+	}
+	else
+#endif
+	{
+		// Attempt to compress it, to one byte fewer than the
+		// uncompressed data to ensure that the compression is worthwhile.
+		compressedlen = lzf_compress(snapshot->save.buffer + sizeof(uint32_t), payload, snapshot->tosend + sizeof(uint32_t), payload - 1);
+	}
+
+	if (compressedlen)
+	{
+		// State that we're compressed, and how.
+		WRITEUINT32(p, payload | method);
+		snapshot->sendlength = compressedlen + sizeof(uint32_t);
+	}
+	else
+	{
+		// Compression failed to make it smaller; send original
+		memcpy(snapshot->tosend, snapshot->save.buffer, snapshot->length);
+
+		// State that we're not compressed
+		WRITEUINT32(p, 0);
+		snapshot->sendlength = snapshot->length;
+	}
+
+#ifdef HAVE_THREADS
+	I_lock_mutex(&savegamesnapshotmutex);
+#endif
+	snapshot->done = true;
+#ifdef HAVE_THREADS
+	I_unlock_mutex(savegamesnapshotmutex);
+#endif
+}
+
+static dboolean SV_SaveGameSnapshotDone(savegamesnapshot_t *snapshot)
+{
+	dboolean done;
+
+#ifdef HAVE_THREADS
+	I_lock_mutex(&savegamesnapshotmutex);
+#endif
+	done = snapshot->done;
+#ifdef HAVE_THREADS
+	I_unlock_mutex(savegamesnapshotmutex);
+#endif
+
+	return done;
+}
+
+static void SV_UpdateSaveGameSnapshots(void);
+
+static savegamesnapshot_t *SV_FindFreeSaveGameSnapshot(void)
+{
+	size_t i;
+
+	for (i = 0; i < MAXSAVEGAMESNAPSHOTS; i++)
+	{
+		if (!savegamesnapshots[i].inuse)
+			return &savegamesnapshots[i];
+	}
+
+	return NULL;
+}
+
+/** Returns an unused snapshot. Finished snapshots are freed as soon as
+  * they're queued, so if every one is in use, they're still being
+  * compressed. Run whatever compression is still queued on the pool
+  * here, then wait for the workers to finish the rest.
+  *
+  */
+static savegamesnapshot_t *SV_GetFreeSaveGameSnapshot(void)
+{
+	savegamesnapshot_t *snapshot = SV_FindFreeSaveGameSnapshot();
+
+	while (snapshot == NULL)
+	{
+#ifdef HAVE_THREADS
+		I_ThreadPoolWaitIdle();
+#endif
+		SV_UpdateSaveGameSnapshots();
+
+		snapshot = SV_FindFreeSaveGameSnapshot();
+		if (snapshot == NULL)
+			I_Sleep(1);
+	}
+
+	return snapshot;
+}
+
+/** Returns the gamestate as of right now, saving and compressing it
+  * only if it hasn't been already this tic. Compression happens on the
+  * thread pool, so the snapshot may not be done yet.
+  *
+  * \param resending Save it for resending to a node that desynched
+  * \return The snapshot, or NULL if there was no memory for it
+  *
+  */
+static savegamesnapshot_t *SV_GetSaveGameSnapshot(dboolean resending)
+{
+	savegamesnapshot_t *snapshot = cursavegamesnapshot;
+
+	if (snapshot != NULL && snapshot->tic == gametic && snapshot->state == gamestate && snapshot->resending == resending)
+		return snapshot;
+
+	snapshot = SV_GetFreeSaveGameSnapshot();
 
 	// first save it in a malloced buffer
-	if (P_SaveBufferAlloc(&save, NETSAVEGAMESIZE) == false)
+	if (P_SaveBufferAlloc(&snapshot->save, NETSAVEGAMESIZE) == false)
 	{
 		CONS_Alert(CONS_ERROR, M_GetText("No more free memory for savegame\n"));
-		return;
+		return NULL;
 	}
 
 	// Leave room for the uncompressed length.
-	save.p += sizeof(uint32_t);
+	snapshot->save.p += sizeof(uint32_t);
 
-	P_SaveNetGame(&save, resending);
+	P_SaveNetGame(&snapshot->save, resending);
 
-	length = save.p - save.buffer;
-	if (length > NETSAVEGAMESIZE)
+	snapshot->length = snapshot->save.p - snapshot->save.buffer;
+	if (snapshot->length > NETSAVEGAMESIZE)
 	{
-		P_SaveBufferFree(&save);
+		P_SaveBufferFree(&snapshot->save);
 		I_Error("Savegame buffer overrun");
 	}
 
-	// Allocate space for compressed save: one byte fewer than for the
-	// uncompressed data to ensure that the compression is worthwhile.
-	compressedsave = Z_Malloc(length - 1, PU_STATIC, NULL);
-	if (!compressedsave)
-	{
-		CONS_Alert(CONS_ERROR, M_GetText("No more free memory for savegame\n"));
-		return;
-	}
+	snapshot->inuse = true;
+	snapshot->tic = gametic;
+	snapshot->state = gamestate;
+	snapshot->resending = resending;
+	snapshot->usezlib = (cv_gamestatecompression.value == 1);
+	snapshot->tosend = AllocSharedRam(snapshot->length);
+	snapshot->sendlength = 0;
+	snapshot->done = false;
+	snapshot->waiting = 0;
+
+	cursavegamesnapshot = snapshot;
+
+#ifdef HAVE_THREADS
+	I_ThreadPoolSubmit(SV_CompressSaveGameSnapshot, snapshot);
+#else
+	SV_CompressSaveGameSnapshot(snapshot);
+#endif
+
+	return snapshot;
+}
+
+static void SV_FreeSaveGameSnapshot(savegamesnapshot_t *snapshot)
+{
+	P_SaveBufferFree(&snapshot->save);
+	ReleaseSharedRam(snapshot->tosend);
+	snapshot->tosend = NULL;
+	snapshot->inuse = false;
+
+	if (cursavegamesnapshot == snapshot)
+		cursavegamesnapshot = NULL;
+}
 
-	// Attempt to compress it.
-	if ((compressedlen = lzf_compress(save.buffer + sizeof(uint32_t), length - sizeof(uint32_t), compressedsave + sizeof(uint32_t), length - sizeof(uint32_t) - 1)))
+/** Queues finished snapshots for the nodes waiting on them, and frees
+  * the ones nobody needs anymore.
+  *
+  */
+static void SV_UpdateSaveGameSnapshots(void)
+{
+	int32_t node;
+	size_t i;
+
+	for (i = 0; i < MAXSAVEGAMESNAPSHOTS; i++)
 	{
-		// Compressing succeeded; send compressed data
-		P_SaveBufferFree(&save);
+		savegamesnapshot_t *snapshot = &savegamesnapshots[i];
+
+		if (!snapshot->inuse || !SV_SaveGameSnapshotDone(snapshot))
+			continue;
+
+		for (node = 0; node < MAXNETNODES && snapshot->waiting > 0; node++)
+		{
+			if (pendingsavegame[node] != snapshot)
+				continue;
+
+			RetainSharedRam(snapshot->tosend);
+			AddRamToSendQueue(node, snapshot->tosend, snapshot->sendlength, SF_SHAREDRAM, 0);
 
-		// State that we're compressed.
-		buffertosend = compressedsave;
-		WRITEUINT32(compressedsave, length - sizeof(uint32_t));
-		length = compressedlen + sizeof(uint32_t);
+			// Now that we know how much will actually be sent
+			freezetimeout[node] = I_GetTime() + jointimeout + snapshot->sendlength / 1024; // 1 extra tic for each kilobyte
+
+			pendingsavegame[node] = NULL;
+			snapshot->waiting--;
+		}
+
+		// Keep this tic's around for anyone else who joins
+		if (snapshot != cursavegamesnapshot || snapshot->tic != gametic)
+			SV_FreeSaveGameSnapshot(snapshot);
 	}
-	else
-	{
-		// Compression failed to make it smaller; send original
-		Z_Free(compressedsave);
+}
 
-		// State that we're not compressed
-		buffertosend = save.buffer;
-		WRITEUINT32(save.buffer, 0);
+/** Forgets that a node was waiting on a snapshot
+  *
+  * \param node The node
+  *
+  */
+static void SV_CancelSaveGameSnapshot(int32_t node)
+{
+	if (pendingsavegame[node] != NULL)
+	{
+		pendingsavegame[node]->waiting--;
+		pendingsavegame[node] = NULL;
 	}
+}
 
-	AddRamToSendQueue(node, buffertosend, length, SF_Z_RAM, 0);
+static void SV_SendSaveGame(int32_t node, dboolean resending)
+{
+	savegamesnapshot_t *snapshot = SV_GetSaveGameSnapshot(resending);
+
+	if (snapshot == NULL)
+		return;
 
-	// Remember when we started sending the savegame so we can handle timeouts
+	SV_CancelSaveGameSnapshot(node);
+	pendingsavegame[node] = snapshot;
+	snapshot->waiting++;
+
+	// Remember when we started sending the savegame so we can handle timeouts.
+	// The extra time for its size is added once it's compressed and queued.
 	sendingsavegame[node] = true;
-	freezetimeout[node] = I_GetTime() + jointimeout + length / 1024; // 1 extra tic for each kilobyte
+	freezetimeout[node] = I_GetTime() + jointimeout;
+
+	SV_UpdateSaveGameSnapshots();
 }
 
 static void CL_DumpConsistency(const char *file_name)
@@ -1435,11 +1653,39 @@ static void CL_LoadReceivedSavegame(dboolean reloading)
 
 	// Decompress saved game if necessary.
 	decompressedlen = READUINT32(save.p);
-	if (decompressedlen > 0)
+	if (decompressedlen & SAVEGAME_ZLIB)
+	{
+#ifdef HAVE_ZLIB
+		uint8_t *decompressedbuffer;
+		uLongf destlen;
+
+		decompressedlen &= ~SAVEGAME_ZLIB;
+		if (decompressedlen > NETSAVEGAMESIZE)
+			I_Error("Can't decompress savegame sent");
+
+		decompressedbuffer = Z_Malloc(decompressedlen, PU_STATIC, NULL);
+		destlen = decompressedlen;
+
+		if (uncompress(decompressedbuffer, &destlen, save.p, length - sizeof(uint32_t)) != Z_OK || destlen != decompressedlen)
+			I_Error("Can't decompress savegame sent");
+
+		P_SaveBufferFree(&save);
+		P_SaveBufferFromExisting(&save, decompressedbuffer, decompressedlen);
+#else
+		I_Error("Can't decompress savegame sent (zlib not supported)");
+#endif
+	}
+	else if (decompressedlen > 0)
 	{
-		uint8_t *decompressedbuffer = Z_Malloc(decompressedlen, PU_STATIC, NULL);
+		uint8_t *decompressedbuffer;
+
+		if (decompressedlen > NETSAVEGAMESIZE)
+			I_Error("Can't decompress savegame sent");
 
-		lzf_decompress(save.p, length - sizeof(uint32_t), decompressedbuffer, decompressedlen);
+		decompressedbuffer = Z_Malloc(decompressedlen, PU_STATIC, NULL);
+
+		if (lzf_decompress(save.p, length - sizeof(uint32_t), decompressedbuffer, decompressedlen) != decompressedlen)
+			I_Error("Can't decompress savegame sent");
 
 		P_SaveBufferFree(&save);
 		P_SaveBufferFromExisting(&save, decompressedbuffer, decompressedlen);
@@ -3561,6 +3807,7 @@ static void ResetNode(int32_t node)
 	sendingsavegame[node] = false;
 	resendingsavegame[node] = false;
 	savegameresendcooldown[node] = 0;
+	SV_CancelSaveGameSnapshot(node);
 
 	bannednode[node].banid = SIZE_MAX;
 	bannednode[node].timeleft = NO_BAN_TIME;
@@ -3583,6 +3830,9 @@ void SV_ResetServer(void)
 	for (i = 0; i < MAXNETNODES; i++)
 		ResetNode(i);
 
+	// gametic starts over, don't hand out the last server's gamestate
+	cursavegamesnapshot = NULL;
+
 	for (i = 0; i < MAXPLAYERS; i++)
 	{
 		LUA_InvalidatePlayer(&players[i]);
@@ -6767,6 +7017,10 @@ static void SV_Maketic(void)
 
 	PS_ResetBotInfo();
 
+	// Bots ask about the same pairs of objects over and over,
+	// and nothing moves while their ticcmds are built.
+	P_StartSightCache();
+
 	for (i = 0; i < MAXPLAYERS; i++)
 	{
 		packetloss[i][maketic%PACKETMEASUREWINDOW] = false;
@@ -6804,6 +7058,8 @@ static void SV_Maketic(void)
 		}
 	}
 
+	P_StopSightCache();
+
 	// all tic are now proceed make the next
 	maketic++;
 }
@@ -6955,6 +7211,8 @@ dboolean TryRunTics(tic_t realtics)
 
 			ps_tictime = I_GetPreciseTime() - ps_tictime;
 
+			M_BenchTicsSample();
+
 			// Leave a certain amount of tics present in the net buffer as long as we've ran at least one tic this frame.
 			if (client && gamestate == GS_LEVEL && leveltime > 1 && neededtic <= gametic + cv_netticbuffer.value)
 			{
@@ -7383,12 +7641,16 @@ void NetKeepAlive(void)
 
 	Net_AckTicker();
 	HandleNodeTimeouts();
+	SV_UpdateSaveGameSnapshots();
 	FileSendTicker();
 
 	// Update voice whenever possible.
 	{
 		NetVoiceUpdate();
 	}
+
+	if (I_NetFlush)
+		I_NetFlush();
 }
 
 // If a tree falls in the forest but nobody is around to hear it, does it make a tic?
@@ -7573,7 +7835,11 @@ void NetUpdate(void)
 		M_ScreenshotTicker();
 	}
 
+	SV_UpdateSaveGameSnapshots();
 	FileSendTicker();
+
+	if (I_NetFlush)
+		I_NetFlush();
 }
 
 static int32_t BiggestOpusFrameLength(int32_t samples)
@@ -7742,6 +8008,10 @@ void NetVoiceUpdate(void)
 	if (denoise_buffer) Z_Free(denoise_buffer);
 	if (subframe_buffer) Z_Free(subframe_buffer);
 	if (encoded) Z_Free(encoded);
+
+	if (I_NetFlush)
+		I_NetFlush();
+
 	ps_voiceupdatetime = I_GetPreciseTime() - ps_voiceupdatetime;
 	return;
 }
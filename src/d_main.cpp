@@ -58,6 +58,7 @@
 #include "keys.h"
 #include "g_input.h" // tutorial mode control scheming
 #include "m_perfstats.h"
+#include "m_benchtics.h"
 #include "core/memory.h"
 
 #include "monocypher/monocypher.h"
@@ -618,6 +619,9 @@ static bool D_Display(bool world)
 								topleft = screens[0] + viewwindowy*vid.width + viewwindowx;
 							}
 
+							// Views still render one after another, since the BSP walk, clipping,
+							// planes and sprites all share the renderer's globals. Only the masked
+							// column batch of the last view keeps drawing on the pool meanwhile.
 							R_RenderPlayerView();
 
 							if (i > 0)
@@ -628,6 +632,9 @@ static bool D_Display(bool world)
 
 				if (rendermode == render_soft)
 				{
+					// Views may still be drawing masked columns on the thread pool
+					R_FinishColumnBatches();
+
 					for (i = 0; i <= r_splitscreen; i++)
 					{
 						R_ApplyViewMorph(i);
@@ -959,6 +966,8 @@ void D_SRB2Loop(void)
 
 		bool timeisprogressing = (!(paused || P_AutoPause()) && !hu_stopped);
 
+		M_BenchTicsUpdate();
+
 		if (renderisnewtic)
 		{
 			P_ResetInterpHudRandSeed(timeisprogressing);
@@ -1889,7 +1898,7 @@ void D_SRB2Main(void)
 		g_voice_disabled = true;
 	}
 
-	if (M_CheckParm("-noaudio")) // combines -nosound and -nomusic
+	if (M_CheckParm("-noaudio") || M_CheckParm("-benchtics")) // combines -nosound and -nomusic
 	{
 		sound_disabled = true;
 		digital_disabled = true;
@@ -2028,6 +2037,26 @@ void D_SRB2Main(void)
 	if (!autostart)
 		M_PushSpecialParameters(); // push all "+" parameters at the command buffer
 
+	// headless replay benchmark, each parameter is one replay
+	p = M_CheckParm("-benchtics");
+	if (p && M_IsNextParm())
+	{
+		while (M_IsNextParm())
+		{
+			char tmp[MAX_WADPATH];
+
+			strlcpy(tmp, M_GetNextParm(), sizeof tmp);
+			FIL_DefaultExtension(tmp, ".lmp");
+			M_BenchTicsAddDemo(tmp);
+		}
+
+		M_BenchTicsStart();
+
+		G_SetGamestate(GS_NULL);
+		wipegamestate = GS_NULL;
+		return;
+	}
+
 	// demo doesn't need anymore to be added with D_AddFile()
 	p = M_CheckParm("-playdemo");
 	if (!p)
@@ -78,6 +78,7 @@ dboolean (*I_NetGet)(void) = NULL;
 void (*I_NetSend)(void) = NULL;
 dboolean (*I_NetCanSend)(void) = NULL;
 dboolean (*I_NetCanGet)(void) = NULL;
+void (*I_NetFlush)(void) = NULL;
 void (*I_NetCloseSocket)(void) = NULL;
 void (*I_NetFreeNodenum)(int32_t nodenum) = NULL;
 int8_t (*I_NetMakeNodewPort)(const char *address, const char* port) = NULL;
@@ -1334,6 +1335,7 @@ dboolean D_CheckNetGame(void)
 	I_NetGet = Internal_Get;
 	I_NetSend = Internal_Send;
 	I_NetCanSend = NULL;
+	I_NetFlush = NULL;
 	I_NetCloseSocket = NULL;
 	I_NetFreeNodenum = Internal_FreeNodenum;
 	I_NetMakeNodewPort = NULL;
@@ -1544,6 +1546,7 @@ void D_CloseConnection(void)
 		I_NetGet = Internal_Get;
 		I_NetSend = Internal_Send;
 		I_NetCanSend = NULL;
+		I_NetFlush = NULL;
 		I_NetCloseSocket = NULL;
 		I_NetFreeNodenum = Internal_FreeNodenum;
 		I_NetMakeNodewPort = NULL;
@@ -74,6 +74,7 @@
 #include "k_director.h"
 #include "k_credits.h"
 #include "k_hud.h" // K_AddMessage
+#include "acs/interface.h"
 
 #ifdef SRB2_CONFIG_ENABLE_WEBM_MOVIES
 #include "m_avrecorder.h"
@@ -115,6 +116,8 @@ static void Got_Cheat(const uint8_t **cp, int32_t playernum);
 
 static void Command_Playdemo_f(void);
 static void Command_Timedemo_f(void);
+static void Command_DumpObjectStats_f(void);
+static void Command_ACSDumpProfile_f(void);
 static void Command_Stopdemo_f(void);
 static void Command_StartMovie_f(void);
 static void Command_StartLossless_f(void);
@@ -241,6 +244,7 @@ CV_PossibleValue_t perfstats_cons_t[] = {
 	{PS_LOGIC, "Logic"},
 	{PS_BOT, "Bots"},
 	{PS_THINKFRAME, "ThinkFrame"},
+	{PS_OBJECTS, "Objects"},
 	{0, NULL}
 };
 
@@ -523,6 +527,8 @@ void D_RegisterClientCommands(void)
 
 	COM_AddCommand("playdemo", Command_Playdemo_f);
 	COM_AddCommand("timedemo", Command_Timedemo_f);
+	COM_AddCommand("dumpobjectstats", Command_DumpObjectStats_f);
+	COM_AddCommand("acs_dumpprofile", Command_ACSDumpProfile_f);
 	COM_AddCommand("stopdemo", Command_Stopdemo_f);
 	COM_AddCommand("playintro", Command_Playintro_f);
 
@@ -2210,6 +2216,18 @@ static void Command_Timedemo_f(void)
 	G_TimeDemo(timedemo_name);
 }
 
+static void Command_DumpObjectStats_f(void)
+{
+	PS_DumpObjectStats(COM_Argc() > 1 ? COM_Argv(1) : NULL);
+}
+
+static void Command_ACSDumpProfile_f(void)
+{
+	int32_t count = COM_Argc() > 1 ? atoi(COM_Argv(1)) : 10;
+
+	ACS_DumpProfile(max(count, 1));
+}
+
 // stop current demo
 static void Command_Stopdemo_f(void)
 {
@@ -1006,6 +1006,45 @@ void AddRamToSendQueue(int32_t node, void *data, size_t size, freemethod_t freem
 	filestosend++;
 }
 
+// Header in front of every AllocSharedRam block, padded so the data stays aligned
+typedef struct
+{
+	size_t refcount;
+} sharedram_t;
+
+#define SHAREDRAMHEADER 16
+
+/** Allocates a reference counted memory block, so the same data can be in
+  * several nodes' file lists at once. Only use it from the main thread.
+  *
+  * \param size The size of the block in bytes
+  * \return The block, with one reference owned by the caller
+  * \sa ReleaseSharedRam
+  *
+  */
+void *AllocSharedRam(size_t size)
+{
+	sharedram_t *block = (sharedram_t *)malloc(SHAREDRAMHEADER + size);
+	if (!block)
+		I_Error("AllocSharedRam: No more memory\n");
+
+	block->refcount = 1;
+	return (uint8_t *)block + SHAREDRAMHEADER;
+}
+
+void RetainSharedRam(void *data)
+{
+	((sharedram_t *)((uint8_t *)data - SHAREDRAMHEADER))->refcount++;
+}
+
+void ReleaseSharedRam(void *data)
+{
+	sharedram_t *block = (sharedram_t *)((uint8_t *)data - SHAREDRAMHEADER);
+
+	if (--block->refcount == 0)
+		free(block);
+}
+
 /** Adds a file requested by Lua to the file list for a node
   *
   * \param node The node to send the file to
@@ -1080,6 +1119,9 @@ static void SV_EndFileSend(int32_t node)
 			free(p->id.ram);
 		case SF_NOFREERAM: // Nothing to free
 			break;
+		case SF_SHAREDRAM: // It's shared with other nodes, let go of our reference
+			ReleaseSharedRam(p->id.ram);
+			break;
 	}
 
 	// Remove the file request from the list
@@ -29,7 +29,8 @@ typedef enum
 	SF_FILE,
 	SF_Z_RAM,
 	SF_RAM,
-	SF_NOFREERAM
+	SF_NOFREERAM,
+	SF_SHAREDRAM // Allocated with AllocSharedRam, one reference is released
 } freemethod_t;
 
 typedef enum
@@ -97,6 +98,10 @@ dboolean CL_LoadServerFiles(void);
 void AddRamToSendQueue(int32_t node, void *data, size_t size, freemethod_t freemethod,
 	uint8_t fileid);
 
+void *AllocSharedRam(size_t size);
+void RetainSharedRam(void *data);
+void ReleaseSharedRam(void *data);
+
 void FileSendTicker(void);
 void PT_FileAck(void);
 void PT_FileReceived(void);
@@ -71,6 +71,7 @@ static inline int lib_freeslot(lua_State *L)
 			CONS_Printf("Sound sfx_%s allocated.\n",word);
 			sfx = S_AddSoundFx(word, false, 0, false);
 			if (sfx != sfx_None) {
+				DEH_AddConstant(DEHCONST_SFX, S_sfx[sfx].name, sfx);
 				lua_pushinteger(L, sfx);
 				r++;
 			} else
@@ -111,6 +112,7 @@ static inline int lib_freeslot(lua_State *L)
 					CONS_Printf("State S_%s allocated.\n",word);
 					FREE_STATES[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 					strcpy(FREE_STATES[i],word);
+					DEH_AddConstant(DEHCONST_STATE, word, S_FIRSTFREESLOT + i);
 					freeslotusage[0][0]++;
 					lua_pushinteger(L, S_FIRSTFREESLOT + i);
 					r++;
@@ -127,6 +129,7 @@ static inline int lib_freeslot(lua_State *L)
 					CONS_Printf("MobjType MT_%s allocated.\n",word);
 					FREE_MOBJS[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 					strcpy(FREE_MOBJS[i],word);
+					DEH_AddConstant(DEHCONST_MOBJ, word, MT_FIRSTFREESLOT + i);
 					freeslotusage[1][0]++;
 					lua_pushinteger(L, MT_FIRSTFREESLOT + i);
 					r++;
@@ -143,6 +146,7 @@ static inline int lib_freeslot(lua_State *L)
 					CONS_Printf("Skincolor SKINCOLOR_%s allocated.\n",word);
 					FREE_SKINCOLORS[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 					strcpy(FREE_SKINCOLORS[i],word);
+					DEH_AddConstant(DEHCONST_SKINCOLOR, word, SKINCOLOR_FIRSTFREESLOT + i);
 					skincolors[SKINCOLOR_FIRSTFREESLOT+i].cache_spraycan = UINT16_MAX;
 					numskincolors++;
 					lua_pushinteger(L, SKINCOLOR_FIRSTFREESLOT + i);
@@ -452,19 +456,11 @@ static inline int lib_getenum(lua_State *L)
 			lua_pushinteger(L, S_FIRSTFREESLOT);
 			return 1;
 		}
-		for (i = 0; i < NUMSTATEFREESLOTS; i++) {
-			if (!FREE_STATES[i])
-				break;
-			if (fastcmp(p, FREE_STATES[i])) {
-				lua_pushinteger(L, S_FIRSTFREESLOT+i);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_STATE, p);
+		if (i != -1) {
+			lua_pushinteger(L, i);
+			return 1;
 		}
-		for (i = 0; i < S_FIRSTFREESLOT; i++)
-			if (fastcmp(p, STATE_LIST[i]+2)) {
-				lua_pushinteger(L, i);
-				return 1;
-			}
 		return luaL_error(L, "state '%s' does not exist.\n", word);
 	}
 	else if (fastncmp("MT_",word,3)) {
@@ -474,19 +470,11 @@ static inline int lib_getenum(lua_State *L)
 			lua_pushinteger(L, MT_FIRSTFREESLOT);
 			return 1;
 		}
-		for (i = 0; i < NUMMOBJFREESLOTS; i++) {
-			if (!FREE_MOBJS[i])
-				break;
-			if (fastcmp(p, FREE_MOBJS[i])) {
-				lua_pushinteger(L, MT_FIRSTFREESLOT+i);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_MOBJ, p);
+		if (i != -1) {
+			lua_pushinteger(L, i);
+			return 1;
 		}
-		for (i = 0; i < MT_FIRSTFREESLOT; i++)
-			if (fastcmp(p, MOBJTYPE_LIST[i]+3)) {
-				lua_pushinteger(L, i);
-				return 1;
-			}
 		return luaL_error(L, "mobjtype '%s' does not exist.\n", word);
 	}
 	else if (fastncmp("SPR_",word,4)) {
@@ -527,6 +515,12 @@ static inline int lib_getenum(lua_State *L)
 	}
 	else if (fastncmp("sfx_",word,4)) {
 		p = word+4;
+		i = DEH_FindConstant(DEHCONST_SFX, p);
+		if (i != -1 && fastcmp(p, S_sfx[i].name)) {
+			lua_pushinteger(L, i);
+			return 1;
+		}
+		// The table ignores case, look for an exact match.
 		for (i = 0; i < NUMSFX; i++)
 			if (S_sfx[i].name && fastcmp(p, S_sfx[i].name)) {
 				lua_pushinteger(L, i);
@@ -536,20 +530,20 @@ static inline int lib_getenum(lua_State *L)
 	}
 	else if (mathlib && fastncmp("SFX_",word,4)) { // SOCs are ALL CAPS!
 		p = word+4;
-		for (i = 0; i < NUMSFX; i++)
-			if (S_sfx[i].name && fasticmp(p, S_sfx[i].name)) {
-				lua_pushinteger(L, i);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_SFX, p);
+		if (i != -1) {
+			lua_pushinteger(L, i);
+			return 1;
+		}
 		return luaL_error(L, "sfx '%s' could not be found.\n", word);
 	}
 	else if (mathlib && fastncmp("DS",word,2)) {
 		p = word+2;
-		for (i = 0; i < NUMSFX; i++)
-			if (S_sfx[i].name && fasticmp(p, S_sfx[i].name)) {
-				lua_pushinteger(L, i);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_SFX, p);
+		if (i != -1) {
+			lua_pushinteger(L, i);
+			return 1;
+		}
 		if (mathlib) return luaL_error(L, "sfx '%s' could not be found.\n", word);
 		return 0;
 	}
@@ -573,19 +567,11 @@ static inline int lib_getenum(lua_State *L)
 	}
 	else if (fastncmp("SKINCOLOR_",word,10)) {
 		p = word+10;
-		for (i = 0; i < NUMCOLORFREESLOTS; i++) {
-			if (!FREE_SKINCOLORS[i])
-				break;
-			if (fastcmp(p, FREE_SKINCOLORS[i])) {
-				lua_pushinteger(L, SKINCOLOR_FIRSTFREESLOT+i);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_SKINCOLOR, p);
+		if (i != -1) {
+			lua_pushinteger(L, i);
+			return 1;
 		}
-		for (i = 0; i < SKINCOLOR_FIRSTFREESLOT; i++)
-			if (fastcmp(p, COLOR_ENUMS[i])) {
-				lua_pushinteger(L, i);
-				return 1;
-			}
 		return luaL_error(L, "skincolor '%s' could not be found.\n", word);
 	}
 	else if (fastncmp("PRECIP_",word,7)) {
@@ -620,12 +606,12 @@ static inline int lib_getenum(lua_State *L)
 
 		// Hardcoded actions as callable Lua functions!
 		// Retrieving them from this metatable allows them to be case-insensitive!
-		for (i = 0; actionpointers[i].name; i++)
-			if (fasticmp(word, actionpointers[i].name)) {
-				// We push the actionf_t* itself as userdata!
-				LUA_PushUserdata(L, &actionpointers[i].action, META_ACTION);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_ACTION, word);
+		if (i != -1) {
+			// We push the actionf_t* itself as userdata!
+			LUA_PushUserdata(L, &actionpointers[i].action, META_ACTION);
+			return 1;
+		}
 		return 0;
 	}
 	else if (!mathlib && fastcmp("super",word))
@@ -635,11 +621,11 @@ static inline int lib_getenum(lua_State *L)
 			lua_pushcfunction(L, lib_dummysuper);
 			return 1;
 		}
-		for (i = 0; actionpointers[i].name; i++)
-			if (fasticmp(superactions[superstack-1], actionpointers[i].name)) {
-				LUA_PushUserdata(L, &actionpointers[i].action, META_ACTION);
-				return 1;
-			}
+		i = DEH_FindConstant(DEHCONST_ACTION, superactions[superstack-1]);
+		if (i != -1) {
+			LUA_PushUserdata(L, &actionpointers[i].action, META_ACTION);
+			return 1;
+		}
 		return 0;
 	}
 
@@ -751,24 +737,22 @@ const char *LUA_GetActionName(void *action)
 void LUA_SetActionByName(void *state, const char *actiontocompare)
 {
 	state_t *st = (state_t *)state;
-	size_t z;
-	for (z = 0; actionpointers[z].name; z++)
+	int32_t z = DEH_FindConstant(DEHCONST_ACTION, actiontocompare);
+	if (z != -1)
 	{
-		if (fasticmp(actiontocompare, actionpointers[z].name))
-		{
-			st->action = actionpointers[z].action;
-			st->action.acv = actionpointers[z].action.acv; // assign
-			st->action.acp1 = actionpointers[z].action.acp1;
-			return;
-		}
+		st->action = actionpointers[z].action;
+		st->action.acv = actionpointers[z].action.acv; // assign
+		st->action.acp1 = actionpointers[z].action.acp1;
 	}
 }
 
 size_t LUA_GetActionNumByName(const char *actiontocompare)
 {
-	size_t z;
+	int32_t z = DEH_FindConstant(DEHCONST_ACTION, actiontocompare);
+	if (z != -1)
+		return z;
+	// Not found is the index of the terminator.
 	for (z = 0; actionpointers[z].name; z++)
-		if (fasticmp(actiontocompare, actionpointers[z].name))
-			return z;
+		;
 	return z;
 }
@@ -275,8 +275,10 @@ void readfreeslots(MYFILE *f)
 			// TODO: Name too long (truncated) warnings.
 			if (fastcmp(type, "SFX"))
 			{
+				sfxenum_t sfx;
 				CONS_Printf("Sound sfx_%s allocated.\n",word);
-				S_AddSoundFx(word, false, 0, false);
+				sfx = S_AddSoundFx(word, false, 0, false);
+				DEH_AddConstant(DEHCONST_SFX, S_sfx[sfx].name, sfx);
 			}
 			else if (fastcmp(type, "SPR"))
 			{
@@ -306,6 +308,7 @@ void readfreeslots(MYFILE *f)
 						CONS_Printf("State S_%s allocated.\n",word);
 						FREE_STATES[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 						strcpy(FREE_STATES[i],word);
+						DEH_AddConstant(DEHCONST_STATE, word, S_FIRSTFREESLOT+i);
 						freeslotusage[0][0]++;
 						break;
 					}
@@ -320,6 +323,7 @@ void readfreeslots(MYFILE *f)
 						CONS_Printf("MobjType MT_%s allocated.\n",word);
 						FREE_MOBJS[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 						strcpy(FREE_MOBJS[i],word);
+						DEH_AddConstant(DEHCONST_MOBJ, word, MT_FIRSTFREESLOT+i);
 						freeslotusage[1][0]++;
 						break;
 					}
@@ -334,6 +338,7 @@ void readfreeslots(MYFILE *f)
 						CONS_Printf("Skincolor SKINCOLOR_%s allocated.\n",word);
 						FREE_SKINCOLORS[i] = Z_Malloc(strlen(word)+1, PU_STATIC, NULL);
 						strcpy(FREE_SKINCOLORS[i],word);
+						DEH_AddConstant(DEHCONST_SKINCOLOR, word, SKINCOLOR_FIRSTFREESLOT+i);
 						skincolors[SKINCOLOR_FIRSTFREESLOT+i].cache_spraycan = UINT16_MAX;
 						numskincolors++;
 						break;
@@ -2191,21 +2196,18 @@ void readframe(MYFILE *f, int32_t num)
 						break;
 				}
 
-				z = 0;
 				found = LUA_SetLuaAction(&states[num], actiontocompare);
 				if (!found)
-					while (actionpointers[z].name)
+				{
+					int32_t action = DEH_FindConstant(DEHCONST_ACTION, actiontocompare);
+					if (action != -1 && fastcmp(actiontocompare, actionpointers[action].name))
 					{
-						if (fastcmp(actiontocompare, actionpointers[z].name))
-						{
-							states[num].action = actionpointers[z].action;
-							states[num].action.acv = actionpointers[z].action.acv; // assign
-							states[num].action.acp1 = actionpointers[z].action.acp1;
-							found = true;
-							break;
-						}
-						z++;
+						states[num].action = actionpointers[action].action;
+						states[num].action.acv = actionpointers[action].action.acv; // assign
+						states[num].action.acp1 = actionpointers[action].action.acp1;
+						found = true;
 					}
+				}
 
 				if (!found)
 					deh_warning("Unknown action %s", actiontocompare);
@@ -4588,60 +4590,42 @@ void readweather(MYFILE *f, int32_t num)
 
 mobjtype_t get_mobjtype(const char *word)
 { // Returns the value of MT_ enumerations
-	mobjtype_t i;
+	int32_t i;
 	if (*word >= '0' && *word <= '9')
 		return atoi(word);
 	if (fastncmp("MT_",word,3))
 		word += 3; // take off the MT_
-	for (i = 0; i < NUMMOBJFREESLOTS; i++) {
-		if (!FREE_MOBJS[i])
-			break;
-		if (fastcmp(word, FREE_MOBJS[i]))
-			return MT_FIRSTFREESLOT+i;
-	}
-	for (i = 0; i < MT_FIRSTFREESLOT; i++)
-		if (fastcmp(word, MOBJTYPE_LIST[i]+3))
-			return i;
+	i = DEH_FindConstant(DEHCONST_MOBJ, word);
+	if (i != -1)
+		return i;
 	deh_warning("Couldn't find mobjtype named 'MT_%s'",word);
 	return MT_NULL;
 }
 
 statenum_t get_state(const char *word)
 { // Returns the value of S_ enumerations
-	statenum_t i;
+	int32_t i;
 	if (*word >= '0' && *word <= '9')
 		return atoi(word);
 	if (fastncmp("S_",word,2))
 		word += 2; // take off the S_
-	for (i = 0; i < NUMSTATEFREESLOTS; i++) {
-		if (!FREE_STATES[i])
-			break;
-		if (fastcmp(word, FREE_STATES[i]))
-			return S_FIRSTFREESLOT+i;
-	}
-	for (i = 0; i < S_FIRSTFREESLOT; i++)
-		if (fastcmp(word, STATE_LIST[i]+2))
-			return i;
+	i = DEH_FindConstant(DEHCONST_STATE, word);
+	if (i != -1)
+		return i;
 	deh_warning("Couldn't find state named 'S_%s'",word);
 	return S_NULL;
 }
 
 skincolornum_t get_skincolor(const char *word)
 { // Returns the value of SKINCOLOR_ enumerations
-	skincolornum_t i;
+	int32_t i;
 	if (*word >= '0' && *word <= '9')
 		return atoi(word);
 	if (fastncmp("SKINCOLOR_",word,10))
 		word += 10; // take off the SKINCOLOR_
-	for (i = 0; i < NUMCOLORFREESLOTS; i++) {
-		if (!FREE_SKINCOLORS[i])
-			break;
-		if (fastcmp(word, FREE_SKINCOLORS[i]))
-			return SKINCOLOR_FIRSTFREESLOT+i;
-	}
-	for (i = 0; i < SKINCOLOR_FIRSTFREESLOT; i++)
-		if (fastcmp(word, COLOR_ENUMS[i]))
-			return i;
+	i = DEH_FindConstant(DEHCONST_SKINCOLOR, word);
+	if (i != -1)
+		return i;
 	deh_warning("Couldn't find skincolor named 'SKINCOLOR_%s'",word);
 	return SKINCOLOR_GREEN;
 }
@@ -4676,16 +4660,16 @@ playersprite_t get_sprite2(const char *word)
 
 sfxenum_t get_sfx(const char *word)
 { // Returns the value of SFX_ enumerations
-	sfxenum_t i;
+	int32_t i;
 	if (*word >= '0' && *word <= '9')
 		return atoi(word);
 	if (fastncmp("SFX_",word,4))
 		word += 4; // take off the SFX_
 	else if (fastncmp("DS",word,2))
 		word += 2; // take off the DS
-	for (i = 0; i < NUMSFX; i++)
-		if (S_sfx[i].name && fasticmp(word, S_sfx[i].name))
-			return i;
+	i = DEH_FindConstant(DEHCONST_SFX, word);
+	if (i != -1)
+		return i;
 	deh_warning("Couldn't find sfx named 'SFX_%s'",word);
 	return sfx_None;
 }
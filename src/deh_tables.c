@@ -28,6 +28,8 @@
 #include "music.h" // tune flags (for lua)
 #include "k_respawn.h" // respawn values (for lua)
 #include "k_waypoint.h" // waypoint values (for lua)
+#include "z_zone.h"
+#include "fastcmp.h"
 
 #include "deh_tables.h"
 
@@ -5444,6 +5446,255 @@ struct int_const_s const INT_CONST[] = {
 	{NULL,0}
 };
 
+// Constant name lookup.
+//
+// SOC and Lua resolve S_, MT_, SKINCOLOR_, sfx_ and action names
+// constantly while addons load, and with thousands of freeslots
+// scanning the lists every time gets very slow. Each kind gets an
+// open addressed table of {hash, value}; the name is never copied,
+// it's read back from the lists through DEH_ConstantName.
+
+typedef struct
+{
+	uint32_t hash;
+	int32_t value; // -1 if the slot is empty
+} dehconst_t;
+
+static struct
+{
+	dehconst_t *slots;
+	size_t size; // always a power of two
+	size_t count;
+	dboolean built;
+} dehconsts[NUMDEHCONSTKINDS];
+
+static const char *DEH_ConstantName(dehconstkind_t kind, int32_t value)
+{
+	switch (kind)
+	{
+		case DEHCONST_STATE:
+			if (value >= S_FIRSTFREESLOT)
+				return FREE_STATES[value - S_FIRSTFREESLOT];
+			return STATE_LIST[value] + 2;
+		case DEHCONST_MOBJ:
+			if (value >= MT_FIRSTFREESLOT)
+				return FREE_MOBJS[value - MT_FIRSTFREESLOT];
+			return MOBJTYPE_LIST[value] + 3;
+		case DEHCONST_SKINCOLOR:
+			if (value >= SKINCOLOR_FIRSTFREESLOT)
+				return FREE_SKINCOLORS[value - SKINCOLOR_FIRSTFREESLOT];
+			return COLOR_ENUMS[value];
+		case DEHCONST_SFX:
+			return S_sfx[value].name;
+		case DEHCONST_ACTION:
+			return actionpointers[value].name;
+		default:
+			return NULL;
+	}
+}
+
+static dboolean DEH_ConstantMatches(dehconstkind_t kind, int32_t value, const char *name)
+{
+	const char *other = DEH_ConstantName(kind, value);
+
+	if (other == NULL)
+		return false;
+
+	if (kind == DEHCONST_SFX || kind == DEHCONST_ACTION)
+		return fasticmp(name, other);
+
+	return fastcmp(name, other);
+}
+
+// Returns the slot holding name, or the empty slot it would go in.
+static dehconst_t *DEH_ConstantSlot(dehconstkind_t kind, const char *name, uint32_t hash)
+{
+	const size_t mask = dehconsts[kind].size - 1;
+	size_t i = hash & mask;
+
+	while (dehconsts[kind].slots[i].value != -1)
+	{
+		dehconst_t *slot = &dehconsts[kind].slots[i];
+
+		if (slot->hash == hash && DEH_ConstantMatches(kind, slot->value, name))
+			return slot;
+
+		i = (i + 1) & mask;
+	}
+
+	return &dehconsts[kind].slots[i];
+}
+
+static void DEH_GrowConstants(dehconstkind_t kind)
+{
+	dehconst_t *old = dehconsts[kind].slots;
+	const size_t oldsize = dehconsts[kind].size;
+	size_t i;
+
+	dehconsts[kind].size = oldsize ? oldsize * 2 : 1024;
+	dehconsts[kind].slots = Z_Malloc(dehconsts[kind].size * sizeof (dehconst_t), PU_STATIC, NULL);
+
+	for (i = 0; i < dehconsts[kind].size; i++)
+		dehconsts[kind].slots[i].value = -1;
+
+	for (i = 0; i < oldsize; i++)
+	{
+		const size_t mask = dehconsts[kind].size - 1;
+		size_t j;
+
+		if (old[i].value == -1)
+			continue;
+
+		// Every name is distinct, so just find an empty slot.
+		for (j = old[i].hash & mask; dehconsts[kind].slots[j].value != -1; j = (j + 1) & mask)
+			;
+
+		dehconsts[kind].slots[j] = old[i];
+	}
+
+	Z_Free(old);
+}
+
+// Freeslots shadow builtins, but the first freeslot with a
+// name shadows later ones. Otherwise the first value stays.
+static dboolean DEH_ConstantReplaces(dehconstkind_t kind, int32_t old, int32_t value)
+{
+	switch (kind)
+	{
+		case DEHCONST_STATE:
+			return (old < S_FIRSTFREESLOT && value >= S_FIRSTFREESLOT);
+		case DEHCONST_MOBJ:
+			return (old < MT_FIRSTFREESLOT && value >= MT_FIRSTFREESLOT);
+		case DEHCONST_SKINCOLOR:
+			return (old < SKINCOLOR_FIRSTFREESLOT && value >= SKINCOLOR_FIRSTFREESLOT);
+		case DEHCONST_SFX:
+			return (value < old);
+		default:
+			return false;
+	}
+}
+
+static void DEH_InsertConstant(dehconstkind_t kind, const char *name, int32_t value)
+{
+	const uint32_t hash = quickncasehash(name, strlen(name));
+	dehconst_t *slot;
+
+	if ((dehconsts[kind].count + 1) * 2 > dehconsts[kind].size)
+		DEH_GrowConstants(kind);
+
+	slot = DEH_ConstantSlot(kind, name, hash);
+
+	if (slot->value == -1)
+	{
+		slot->hash = hash;
+		slot->value = value;
+		dehconsts[kind].count++;
+	}
+	else if (DEH_ConstantReplaces(kind, slot->value, value))
+	{
+		slot->value = value;
+	}
+}
+
+static void DEH_BuildConstants(dehconstkind_t kind)
+{
+	int32_t i;
+
+	dehconsts[kind].built = true;
+
+	if (dehconsts[kind].size == 0)
+		DEH_GrowConstants(kind);
+
+	switch (kind)
+	{
+		case DEHCONST_STATE:
+			for (i = 0; i < S_FIRSTFREESLOT; i++)
+				DEH_InsertConstant(kind, STATE_LIST[i] + 2, i);
+			for (i = 0; i < NUMSTATEFREESLOTS && FREE_STATES[i]; i++)
+				DEH_InsertConstant(kind, FREE_STATES[i], S_FIRSTFREESLOT + i);
+			break;
+		case DEHCONST_MOBJ:
+			for (i = 0; i < MT_FIRSTFREESLOT; i++)
+				DEH_InsertConstant(kind, MOBJTYPE_LIST[i] + 3, i);
+			for (i = 0; i < NUMMOBJFREESLOTS && FREE_MOBJS[i]; i++)
+				DEH_InsertConstant(kind, FREE_MOBJS[i], MT_FIRSTFREESLOT + i);
+			break;
+		case DEHCONST_SKINCOLOR:
+			for (i = 0; i < SKINCOLOR_FIRSTFREESLOT; i++)
+				DEH_InsertConstant(kind, COLOR_ENUMS[i], i);
+			for (i = 0; i < NUMCOLORFREESLOTS && FREE_SKINCOLORS[i]; i++)
+				DEH_InsertConstant(kind, FREE_SKINCOLORS[i], SKINCOLOR_FIRSTFREESLOT + i);
+			break;
+		case DEHCONST_SFX:
+			for (i = 0; i < NUMSFX; i++)
+				if (S_sfx[i].name)
+					DEH_InsertConstant(kind, S_sfx[i].name, i);
+			break;
+		case DEHCONST_ACTION:
+			for (i = 0; actionpointers[i].name; i++)
+				DEH_InsertConstant(kind, actionpointers[i].name, i);
+			break;
+		default:
+			break;
+	}
+}
+
+int32_t DEH_FindConstant(dehconstkind_t kind, const char *name)
+{
+	dehconst_t *slot;
+	int32_t i;
+
+	if (!dehconsts[kind].built)
+		DEH_BuildConstants(kind);
+
+	slot = DEH_ConstantSlot(kind, name, quickncasehash(name, strlen(name)));
+
+	if (kind != DEHCONST_SFX)
+		return slot->value;
+
+	// Sound slots get renamed behind our back (skin sounds,
+	// S_StartSoundName), so only trust a hit whose name still
+	// matches, and go back to the old scan for anything else.
+	if (slot->value != -1 && DEH_ConstantMatches(kind, slot->value, name))
+		return slot->value;
+
+	for (i = 0; i < NUMSFX; i++)
+	{
+		if (S_sfx[i].name && fasticmp(name, S_sfx[i].name))
+		{
+			DEH_InsertConstant(kind, S_sfx[i].name, i);
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+void DEH_AddConstant(dehconstkind_t kind, const char *name, int32_t value)
+{
+	if (!dehconsts[kind].built)
+	{
+		// Building reads the freeslots, including this one.
+		DEH_BuildConstants(kind);
+		return;
+	}
+
+	DEH_InsertConstant(kind, name, value);
+}
+
+void DEH_ClearConstants(void)
+{
+	size_t kind;
+
+	for (kind = 0; kind < NUMDEHCONSTKINDS; kind++)
+	{
+		Z_Free(dehconsts[kind].slots);
+		dehconsts[kind].slots = NULL;
+		dehconsts[kind].size = dehconsts[kind].count = 0;
+		dehconsts[kind].built = false;
+	}
+}
+
 // For this to work compile-time without being in this file,
 // this function would need to check sizes at runtime, without sizeof
 void DEH_TableCheck(void)
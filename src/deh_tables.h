@@ -35,8 +35,32 @@ extern uint8_t used_spr[(NUMSPRITEFREESLOTS / 8) + 1]; // Bitwise flag for sprit
 	memset(FREE_MOBJS,0,sizeof(char *) * NUMMOBJFREESLOTS);\
 	memset(FREE_SKINCOLORS,0,sizeof(char *) * NUMCOLORFREESLOTS);\
 	memset(used_spr,0,sizeof(uint8_t) * ((NUMSPRITEFREESLOTS / 8) + 1));\
+	DEH_ClearConstants();\
 }
 
+// Kinds of constant that can be looked up by name
+typedef enum
+{
+	DEHCONST_STATE,     // S_, case sensitive
+	DEHCONST_MOBJ,      // MT_, case sensitive
+	DEHCONST_SKINCOLOR, // SKINCOLOR_, case sensitive
+	DEHCONST_SFX,       // sfx_, case insensitive
+	DEHCONST_ACTION,    // A_, case insensitive
+	NUMDEHCONSTKINDS
+} dehconstkind_t;
+
+// Name (without prefix) to value, through a hash table per kind.
+// Returns -1 if there is no such constant. Freeslots take priority
+// over builtins, otherwise the lowest value with the name wins,
+// same as scanning the lists in order.
+int32_t DEH_FindConstant(dehconstkind_t kind, const char *name);
+
+// Call after a freeslot has been named so lookups can find it.
+void DEH_AddConstant(dehconstkind_t kind, const char *name, int32_t value);
+
+// Forget everything, the tables are rebuilt on the next lookup.
+void DEH_ClearConstants(void);
+
 struct flickytypes_s {
 	const char *name;
 	const mobjtype_t type;
@@ -49,6 +49,7 @@
 #include "p_saveg.h" // savebuffer_t
 #include "g_party.h"
 #include "k_director.h" // K_DirectorIsEnabled
+#include "m_benchtics.h"
 #include "core/json.hpp"
 
 // SRB2Kart
@@ -4132,7 +4133,9 @@ static void G_StopTimingDemo(void)
 	if (restorecv_vidwait != cv_vidwait.value)
 		CV_SetValue(&cv_vidwait, restorecv_vidwait);
 
-	if (timedemo_quit)
+	if (M_BenchTicsActive())
+		M_BenchTicsNextDemo();
+	else if (timedemo_quit)
 		COM_ImmedExecute("quit");
 	else
 		D_StartTitle();
@@ -4645,8 +4645,8 @@ static void HWR_AddPrecipitationSprites(void)
 {
 	const fixed_t drawdist = cv_drawdist_precip.value * mapobjectscale;
 
-	int32_t xl, xh, yl, yh, bx, by;
-	precipmobj_t *th;
+	precipmobj_t **drops;
+	size_t count, i;
 
 	// no, no infinite draw distance for precipitation. this option at zero is supposed to turn it off
 	if (drawdist == 0)
@@ -4654,19 +4654,13 @@ static void HWR_AddPrecipitationSprites(void)
 		return;
 	}
 
-	R_GetRenderBlockMapDimensions(drawdist, &xl, &xh, &yl, &yh);
+	count = R_GatherPrecipitation(drawdist, &drops);
 
-	for (bx = xl; bx <= xh; bx++)
+	for (i = 0; i < count; i++)
 	{
-		for (by = yl; by <= yh; by++)
+		if (drops[i] != NULL)
 		{
-			for (th = precipblocklinks[(by * bmapwidth) + bx]; th; th = th->bnext)
-			{
-				if (R_PrecipThingVisible(th))
-				{
-					HWR_ProjectPrecipitationSprite(th);
-				}
-			}
+			HWR_ProjectPrecipitationSprite(drops[i]);
 		}
 	}
 }
@@ -5233,12 +5227,6 @@ static void HWR_ProjectPrecipitationSprite(precipmobj_t *thing)
 	// uncapped/interpolation
 	interpmobjstate_t interp = {0};
 
-	// okay... this is a hack, but weather isn't networked, so it should be ok
-	if (!P_PrecipThinker(thing))
-	{
-		return;
-	}
-
 	// do interpolation
 	if (R_UsingFrameInterpolation() && !paused)
 	{
@@ -112,6 +112,10 @@ extern void (*I_NetSend)(void);
 */
 extern dboolean (*I_NetCanSend)(void);
 
+/**	\brief send everything the driver has queued up, may be NULL if it sends right away
+*/
+extern void (*I_NetFlush)(void);
+
 /**	\brief	close a connection
 
 	\param	nodenum	node to be closed
@@ -13,6 +13,10 @@
 ///        This is not really OS-dependent because all OSes have the same socket API.
 ///        Just use ifdef for OS-dependent parts.
 
+#if defined (__linux__) && !defined (_GNU_SOURCE)
+	#define _GNU_SOURCE // recvmmsg and sendmmsg
+#endif
+
 #include "i_tcp_detail.h"
 #include "i_system.h"
 #include "i_time.h"
@@ -38,6 +42,15 @@
 
 #define DEFAULTPORT "5029"
 
+// Read and write many datagrams per syscall
+#if defined (__linux__) && !defined (NOMMSG)
+	#define USE_MMSG
+#endif
+
+#define SOCK_RECVQUEUESIZE 32
+#define SOCK_SENDQUEUESIZE 32
+#define SOCK_NODEHASHSIZE 256
+
 #ifdef USE_WINSOCK
 	typedef SOCKET SOCKET_TYPE;
 	#define ERRSOCKET (SOCKET_ERROR)
@@ -69,6 +82,40 @@ static size_t broadcastaddresses = 0;
 static dboolean nodeconnected[MAXNETNODES+1];
 static const int32_t hole_punch_magic = MSBF_LONG (0x52eb11);
 
+// Packets read off of the sockets that SOCK_Get hasn't handed out yet
+typedef struct
+{
+	SOCKET_TYPE socket;
+	mysockaddr_t address;
+	socklen_t addresslen;
+	ptrdiff_t length;
+	char data[MAXPACKETLENGTH];
+} sockpacket_t;
+
+static sockpacket_t recvqueue[SOCK_RECVQUEUESIZE];
+static size_t recvqueue_head = 0, recvqueue_tail = 0;
+
+#ifdef USE_MMSG
+// Packets SOCK_Send has been given but not sent yet, see SOCK_Flush
+typedef struct
+{
+	SOCKET_TYPE socket;
+	mysockaddr_t address;
+	socklen_t addresslen;
+	int16_t node; // -1 if errors shouldn't be reported
+	int16_t length;
+	char data[MAXPACKETLENGTH];
+} socksendpacket_t;
+
+static socksendpacket_t sendqueue[SOCK_SENDQUEUESIZE];
+static size_t sendqueue_len = 0;
+#endif
+
+// Address hash -> node, chained through nodehashnext. Only ever a shortcut, every hit gets checked against clientaddress.
+// Ports aren't hashed, since a node without a port matches any port from its address.
+static int16_t nodehashhead[SOCK_NODEHASHSIZE];
+static int16_t nodehashnext[MAXNETNODES+1];
+
 static bannednode_t SOCK_bannednode[MAXNETNODES+1]; /// \note do we really need the +1?
 static dboolean init_tcp_driver = false;
 
@@ -304,13 +351,82 @@ dboolean SOCK_cmpaddr(mysockaddr_t *a, mysockaddr_t *b, uint8_t mask)
 			&& (b->ip4.sin_port == 0 || (a->ip4.sin_port == b->ip4.sin_port));
 #ifdef HAVE_IPV6
 	else if (b->any.sa_family == AF_INET6)
-		return memcmp(&a->ip6.sin6_addr, &b->ip6.sin6_addr, sizeof(b->ip6.sin6_addr))
+		return !memcmp(&a->ip6.sin6_addr, &b->ip6.sin6_addr, sizeof(b->ip6.sin6_addr))
 			&& (b->ip6.sin6_port == 0 || (a->ip6.sin6_port == b->ip6.sin6_port));
 #endif
 	else
 		return false;
 }
 
+static size_t SOCK_HashAddr(const mysockaddr_t *addr)
+{
+	uint32_t hash;
+
+	if (addr->any.sa_family == AF_INET)
+		hash = addr->ip4.sin_addr.s_addr;
+#ifdef HAVE_IPV6
+	else if (addr->any.sa_family == AF_INET6)
+	{
+		uint32_t words[4];
+		memcpy(words, &addr->ip6.sin6_addr, sizeof(words));
+		hash = words[0] ^ words[1] ^ words[2] ^ words[3];
+	}
+#endif
+	else
+		return 0;
+
+	hash *= 0x9E3779B1u;
+	return (hash >> 24) % SOCK_NODEHASHSIZE;
+}
+
+static void SOCK_ClearNodeHash(void)
+{
+	size_t i;
+	for (i = 0; i < SOCK_NODEHASHSIZE; i++)
+		nodehashhead[i] = -1;
+	for (i = 0; i <= MAXNETNODES; i++)
+		nodehashnext[i] = -1;
+}
+
+static void SOCK_UnhashNode(int32_t node)
+{
+	int16_t *link = &nodehashhead[SOCK_HashAddr(&clientaddress[node])];
+
+	while (*link != -1)
+	{
+		if (*link == node)
+		{
+			*link = nodehashnext[node];
+			break;
+		}
+		link = &nodehashnext[*link];
+	}
+
+	nodehashnext[node] = -1;
+}
+
+static void SOCK_HashNode(int32_t node)
+{
+	size_t hash = SOCK_HashAddr(&clientaddress[node]);
+	nodehashnext[node] = nodehashhead[hash];
+	nodehashhead[hash] = (int16_t)node;
+}
+
+// Same result as checking every node with SOCK_cmpaddr, lowest node first, but only
+// looks at the nodes sharing the address's hash. Every node from 1 up is hashed.
+static int32_t SOCK_FindNode(mysockaddr_t *address)
+{
+	int32_t j, found = -1;
+
+	for (j = nodehashhead[SOCK_HashAddr(address)]; j != -1; j = nodehashnext[j])
+	{
+		if (SOCK_cmpaddr(address, &clientaddress[j], 0) && (found == -1 || j < found))
+			found = j;
+	}
+
+	return found;
+}
+
 // This is a hack. For some reason, nodes aren't being freed properly.
 // This goes through and cleans up what nodes were supposed to be freed.
 /** \warning This function causes the file downloading to stop if someone joins.
@@ -415,66 +531,226 @@ static dboolean hole_punch(ptrdiff_t c)
 	}
 }
 
-// Returns true if a packet was received from a new node, false in all other cases
-static dboolean SOCK_Get(void)
+static socklen_t SOCK_AddrLen(const mysockaddr_t *sockaddr)
 {
-	size_t n;
-	int j;
-	ptrdiff_t c;
-	mysockaddr_t fromaddress;
-	socklen_t fromlen;
+	switch (sockaddr->any.sa_family)
+	{
+		case AF_INET:  return (socklen_t)sizeof(struct sockaddr_in);
+#ifdef HAVE_IPV6
+		case AF_INET6: return (socklen_t)sizeof(struct sockaddr_in6);
+#endif
+		default:       return (socklen_t)sizeof(mysockaddr_t);
+	}
+}
 
-	for (n = 0; n < mysocketses; n++)
+#ifdef USE_MMSG
+static void SOCK_SendError(int32_t node, int e)
+{
+	if (node != -1 && e != ECONNREFUSED && e != EWOULDBLOCK)
+		I_Error("SOCK_Send, error sending to node %d (%s) #%u: %s", node,
+			SOCK_GetNodeAddress(node), e, strerror(e));
+}
+
+// Sends everything in sendqueue, a run of packets on the same socket at a time
+static void SOCK_Flush(void)
+{
+	struct mmsghdr msgs[SOCK_SENDQUEUESIZE];
+	struct iovec iovs[SOCK_SENDQUEUESIZE];
+	size_t i, first, count;
+	int sent;
+
+	for (i = 0; i < sendqueue_len; i++)
+	{
+		iovs[i].iov_base = sendqueue[i].data;
+		iovs[i].iov_len = sendqueue[i].length;
+		memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+		msgs[i].msg_hdr.msg_name = &sendqueue[i].address;
+		msgs[i].msg_hdr.msg_namelen = sendqueue[i].addresslen;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	for (first = 0; first < sendqueue_len; first += count)
 	{
-		fromlen = (socklen_t)sizeof(fromaddress);
-		c = recvfrom(mysockets[n], (char *)&doomcom->data, MAXPACKETLENGTH, 0,
-			(void *)&fromaddress, &fromlen);
-		if (c > 0)
+		size_t done = 0;
+
+		for (count = 1; first + count < sendqueue_len; count++)
 		{
-#ifdef USE_STUN
-			if (STUN_got_response(doomcom->data, c))
-			{
+			if (sendqueue[first + count].socket != sendqueue[first].socket)
 				break;
-			}
-#endif
+		}
 
-			if (hole_punch(c))
-			{
-				break;
-			}
+		while (done < count)
+		{
+			sent = sendmmsg(sendqueue[first].socket, &msgs[first + done], (unsigned int)(count - done), 0);
 
-			// find remote node number
-			for (j = 1; j <= MAXNETNODES; j++) //include LAN
+			if (sent <= 0)
 			{
-				if (SOCK_cmpaddr(&fromaddress, &clientaddress[j], 0))
-				{
-					doomcom->remotenode = (int16_t)j; // good packet from a game player
-					doomcom->datalength = (int16_t)c;
-					nodesocket[j] = mysockets[n];
-					return false;
-				}
+				// The first one that didn't go out failed, skip it like a failed sendto
+				SOCK_SendError(sendqueue[first + done].node, errno);
+				done++;
 			}
-			// not found
+			else
+				done += (size_t)sent;
+		}
+	}
+
+	sendqueue_len = 0;
+}
+
+static void SOCK_QueueSend(SOCKET_TYPE socket, mysockaddr_t *sockaddr, int32_t node)
+{
+	socksendpacket_t *packet;
+
+	if (sendqueue_len == SOCK_SENDQUEUESIZE)
+		SOCK_Flush();
+
+	packet = &sendqueue[sendqueue_len++];
+	packet->socket = socket;
+	packet->address = *sockaddr;
+	packet->addresslen = SOCK_AddrLen(sockaddr);
+	packet->node = (int16_t)node;
+	packet->length = doomcom->datalength;
+	M_Memcpy(packet->data, doomcom->data, doomcom->datalength);
+}
+#endif
+
+// Reads whatever is waiting on the sockets into recvqueue, returns false if there was nothing
+static dboolean SOCK_FillRecvQueue(void)
+{
+	size_t n;
+
+	recvqueue_head = recvqueue_tail = 0;
 
-			// find a free slot
-			j = getfreenode();
-			if (j > 0)
+	for (n = 0; n < mysocketses && recvqueue_tail < SOCK_RECVQUEUESIZE; n++)
+	{
+#ifdef USE_MMSG
+		struct mmsghdr msgs[SOCK_RECVQUEUESIZE];
+		struct iovec iovs[SOCK_RECVQUEUESIZE];
+		const size_t space = SOCK_RECVQUEUESIZE - recvqueue_tail;
+		size_t i;
+		int got;
+
+		for (i = 0; i < space; i++)
+		{
+			sockpacket_t *packet = &recvqueue[recvqueue_tail + i];
+
+			iovs[i].iov_base = packet->data;
+			iovs[i].iov_len = MAXPACKETLENGTH;
+			memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+			msgs[i].msg_hdr.msg_name = &packet->address;
+			msgs[i].msg_hdr.msg_namelen = (socklen_t)sizeof(packet->address);
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		got = recvmmsg(mysockets[n], msgs, (unsigned int)space, MSG_DONTWAIT, NULL);
+
+		for (i = 0; got > 0 && i < (size_t)got; i++)
+		{
+			sockpacket_t *packet = &recvqueue[recvqueue_tail];
+
+			if (msgs[i].msg_len == 0)
+				continue; // recvfrom returning 0 was never a packet either
+
+			packet->socket = mysockets[n];
+			packet->addresslen = msgs[i].msg_hdr.msg_namelen;
+			packet->length = (ptrdiff_t)msgs[i].msg_len;
+
+			if (packet != &recvqueue[recvqueue_tail + i])
 			{
-				M_Memcpy(&clientaddress[j], &fromaddress, fromlen);
-				nodesocket[j] = mysockets[n];
-				DEBFILE(va("New node detected: node:%d address:%s\n", j,
-						SOCK_GetNodeAddress(j)));
-				doomcom->remotenode = (int16_t)j; // good packet from a game player
-				doomcom->datalength = (int16_t)c;
-
-				return true;
+				// Close the gap left by an empty one
+				const sockpacket_t *from = &recvqueue[recvqueue_tail + i];
+				memcpy(&packet->address, &from->address, sizeof(packet->address));
+				memcpy(packet->data, from->data, packet->length);
 			}
-			else
-				DEBFILE("New node detected: No more free slots\n");
+
+			recvqueue_tail++;
 		}
+#else
+		sockpacket_t *packet = &recvqueue[recvqueue_tail];
+
+		packet->addresslen = (socklen_t)sizeof(packet->address);
+		packet->length = recvfrom(mysockets[n], packet->data, MAXPACKETLENGTH, 0,
+			(void *)&packet->address, &packet->addresslen);
+
+		if (packet->length > 0)
+		{
+			// One at a time, just like before there was a queue
+			packet->socket = mysockets[n];
+			recvqueue_tail++;
+			break;
+		}
+#endif
+	}
+
+	return (recvqueue_tail > 0);
+}
+
+// Returns true if a packet was received from a new node, false in all other cases
+static dboolean SOCK_Get(void)
+{
+	int j;
+	sockpacket_t *packet;
+
+#ifdef USE_MMSG
+	// Anything waiting to go out goes before we look for replies
+	SOCK_Flush();
+#endif
+
+	if (recvqueue_head == recvqueue_tail && !SOCK_FillRecvQueue())
+	{
+		doomcom->remotenode = -1; // no packet
+		return false;
 	}
 
+	packet = &recvqueue[recvqueue_head++];
+	M_Memcpy(doomcom->data, packet->data, packet->length);
+
 	doomcom->remotenode = -1; // no packet
+
+#ifdef USE_STUN
+	if (STUN_got_response(doomcom->data, packet->length))
+	{
+		return false;
+	}
+#endif
+
+	if (hole_punch(packet->length))
+	{
+		return false;
+	}
+
+	// find remote node number
+	j = SOCK_FindNode(&packet->address);
+
+	if (j != -1)
+	{
+		doomcom->remotenode = (int16_t)j; // good packet from a game player
+		doomcom->datalength = (int16_t)packet->length;
+		nodesocket[j] = packet->socket;
+		return false;
+	}
+	// not found
+
+	// find a free slot
+	j = getfreenode();
+	if (j > 0)
+	{
+		SOCK_UnhashNode(j);
+		M_Memcpy(&clientaddress[j], &packet->address, packet->addresslen);
+		SOCK_HashNode(j);
+		nodesocket[j] = packet->socket;
+		DEBFILE(va("New node detected: node:%d address:%s\n", j,
+				SOCK_GetNodeAddress(j)));
+		doomcom->remotenode = (int16_t)j; // good packet from a game player
+		doomcom->datalength = (int16_t)packet->length;
+
+		return true;
+	}
+	else
+		DEBFILE("New node detected: No more free slots\n");
+
 	return false;
 }
 
@@ -529,25 +805,20 @@ static dboolean SOCK_CanGet(void)
 }
 #endif
 
-static inline ptrdiff_t SOCK_SendToAddr(SOCKET_TYPE socket, mysockaddr_t* sockaddr)
+#ifdef USE_MMSG
+// Errors are reported when the queue is sent instead
+static inline ptrdiff_t SOCK_SendToAddr(SOCKET_TYPE socket, mysockaddr_t* sockaddr, int32_t node)
 {
-	socklen_t d4 = (socklen_t)sizeof(struct sockaddr_in);
-#ifdef HAVE_IPV6
-	socklen_t d6 = (socklen_t)sizeof(struct sockaddr_in6);
-#endif
-	socklen_t d, da = (socklen_t)sizeof(mysockaddr_t);
-
-	switch (sockaddr->any.sa_family)
-	{
-		case AF_INET:  d = d4; break;
-#ifdef HAVE_IPV6
-		case AF_INET6: d = d6; break;
-#endif
-		default:       d = da; break;
-	}
-
-	return sendto(socket, (char *)&doomcom->data, doomcom->datalength, 0, &sockaddr->any, d);
+	SOCK_QueueSend(socket, sockaddr, node);
+	return 0;
 }
+#else
+static inline ptrdiff_t SOCK_SendToAddr(SOCKET_TYPE socket, mysockaddr_t* sockaddr, int32_t node)
+{
+	(void)node;
+	return sendto(socket, (char *)&doomcom->data, doomcom->datalength, 0, &sockaddr->any, SOCK_AddrLen(sockaddr));
+}
+#endif
 
 static void SOCK_Send(void)
 {
@@ -564,7 +835,7 @@ static void SOCK_Send(void)
 			for (j = 0; j < broadcastaddresses; j++)
 			{
 				if (myfamily[i] == broadcastaddress[j].any.sa_family)
-					SOCK_SendToAddr(mysockets[i], &broadcastaddress[j]);
+					SOCK_SendToAddr(mysockets[i], &broadcastaddress[j], -1);
 			}
 		}
 		return;
@@ -574,13 +845,13 @@ static void SOCK_Send(void)
 		for (i = 0; i < mysocketses; i++)
 		{
 			if (myfamily[i] == clientaddress[doomcom->remotenode].any.sa_family)
-				SOCK_SendToAddr(mysockets[i], &clientaddress[doomcom->remotenode]);
+				SOCK_SendToAddr(mysockets[i], &clientaddress[doomcom->remotenode], -1);
 		}
 		return;
 	}
 	else
 	{
-		c = SOCK_SendToAddr(nodesocket[doomcom->remotenode], &clientaddress[doomcom->remotenode]);
+		c = SOCK_SendToAddr(nodesocket[doomcom->remotenode], &clientaddress[doomcom->remotenode], doomcom->remotenode);
 	}
 
 	if (c == ERRSOCKET)
@@ -604,6 +875,7 @@ static void SOCK_FreeNodenum(int32_t numnode)
 	nodesocket[numnode] = ERRSOCKET;
 
 	// put invalid address
+	SOCK_UnhashNode(numnode);
 	memset(&clientaddress[numnode], 0, sizeof (clientaddress[numnode]));
 }
 
@@ -865,6 +1137,8 @@ static dboolean UDP_Socket(void)
 		while (runp != NULL && s < MAXNETNODES+1)
 		{
 			memcpy(&clientaddress[s], runp->ai_addr, runp->ai_addrlen);
+			if (s > 0) // self is never looked up
+				SOCK_HashNode(s);
 			s++;
 			runp = runp->ai_next;
 		}
@@ -986,6 +1260,12 @@ dboolean I_InitTcpDriver(void)
 static void SOCK_CloseSocket(void)
 {
 	size_t i;
+
+#ifdef USE_MMSG
+	SOCK_Flush();
+#endif
+	recvqueue_head = recvqueue_tail = 0;
+
 	for (i=0; i < MAXNETNODES+1; i++)
 	{
 		if (mysockets[i] != (SOCKET_TYPE)ERRSOCKET
@@ -1062,11 +1342,13 @@ static int8_t SOCK_NetMakeNodewPort(const char *address, const char *port)
 
 	if (newnode != -1)
 	{
+		SOCK_UnhashNode(newnode);
 		if (!SOCK_GetAddr(&clientaddress[newnode].ip4, address, port, true))
 		{
 			nodeconnected[newnode] = false;
 			return -1;
 		}
+		SOCK_HashNode(newnode);
 	}
 
 	return newnode;
@@ -1129,6 +1411,7 @@ static dboolean SOCK_OpenSocket(void)
 	size_t i;
 
 	memset(clientaddress, 0, sizeof (clientaddress));
+	SOCK_ClearNodeHash();
 
 	nodeconnected[0] = true; // always connected to self
 	for (i = 1; i < MAXNETNODES; i++)
@@ -1146,6 +1429,10 @@ static dboolean SOCK_OpenSocket(void)
 	I_NetCanGet = SOCK_CanGet;
 #endif
 
+#ifdef USE_MMSG
+	I_NetFlush = SOCK_Flush;
+#endif
+
 	I_NetRequestHolePunch = SOCK_RequestHolePunch;
 	I_NetRegisterHolePunch = SOCK_RegisterHolePunch;
 
@@ -240,8 +240,6 @@ void K_InitBrightmapsPwad(int32_t wadNum)
 		}
 	}
 
-	R_ClearTextureNumCache(false);
-
 	// Clear brightmapStorage now that we're done with it.
 	Z_Free(brightmapStorage);
 	brightmapStorage = NULL;
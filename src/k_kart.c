@@ -12425,10 +12425,10 @@ static void K_UpdateDistanceFromFinishLine(player_t *const player)
 			const dboolean useshortcuts = false;
 			const dboolean huntbackwards = false;
 			dboolean pathfindsuccess = false;
-			path_t pathtofinish = {0};
+			uint32_t disttofinish = 0U;
 
 			pathfindsuccess =
-				K_PathfindToWaypoint(player->nextwaypoint, finishline, &pathtofinish, useshortcuts, huntbackwards);
+				K_GetWaypointRouteDistance(player->nextwaypoint, finishline, useshortcuts, huntbackwards, &disttofinish);
 
 			// Update the player's distance to the finish line if a path was found.
 			// Using shortcuts won't find a path, so distance won't be updated until the player gets back on track
@@ -12555,9 +12555,9 @@ static void K_UpdateDistanceFromFinishLine(player_t *const player)
 
 				if (pathBackwardsReverse == false)
 				{
-					if (pathtofinish.totaldist > adddist)
+					if (disttofinish > adddist)
 					{
-						player->distancetofinish = pathtofinish.totaldist - adddist;
+						player->distancetofinish = disttofinish - adddist;
 					}
 					else
 					{
@@ -12566,9 +12566,8 @@ static void K_UpdateDistanceFromFinishLine(player_t *const player)
 				}
 				else
 				{
-					player->distancetofinish = pathtofinish.totaldist + adddist;
+					player->distancetofinish = disttofinish + adddist;
 				}
-				Z_Free(pathtofinish.array);
 
 				// distancetofinish is currently a flat distance to the finish line, but in order to be fully
 				// correct we need to add to it the length of the entire circuit multiplied by the number of laps
@@ -18,7 +18,26 @@
 
 static const size_t DEFAULT_NODEARRAY_CAPACITY = 8U;
 static const size_t DEFAULT_OPENSET_CAPACITY   = 8U;
-static const size_t DEFAULT_CLOSEDSET_CAPACITY = 8U;
+
+// A node slot per pathfinding node index. A slot only belongs to the current search when its generation matches,
+// so starting a new search clears the whole table by bumping the generation.
+typedef struct
+{
+	uint32_t generation;
+	dboolean closed;     // The node has been evaluated, replaces the old closed set
+	size_t   nodeindex;  // Index into the arena nodes array
+} pathfindslot_t;
+
+// Storage kept between searches. Bots pathfind every tic, so this avoids reallocating everything each call.
+static struct
+{
+	pathfindnode_t *nodes;
+	size_t         nodescapacity;
+	pathfindslot_t *slots;
+	size_t         slotscapacity;
+	bheap_t        openset;
+	uint32_t       generation;
+} pathfindarena;
 
 
 /*--------------------------------------------------
@@ -70,79 +89,160 @@ static void K_NodeUpdateHeapIndex(void *const node, const size_t newheapindex)
 }
 
 /*--------------------------------------------------
-	static pathfindnode_t *K_NodesArrayContainsNodeData(
-		pathfindnode_t *nodesarray,
-		void* nodedata,
-		size_t nodesarraycount)
+	static void K_PathfindArenaBegin(pathfindsetup_t *const pathfindsetup)
 
-		Checks whether the Nodes Array contains a node with a waypoint. Searches from the end to the start for speed
-			reasons.
+		Prepares the persistent pathfinding storage for a new search, growing it if needed.
 
 	Input Arguments:-
-		nodesarray      - The nodes array within the A* algorithm
-		waypoint        - The waypoint to check is within the nodes array
-		nodesarraycount - The current size of the nodes array
+		pathfindsetup - The setup for this search, capacities are read from and written back to it
 
 	Return:-
-		The pathfind node that has the waypoint if there is one. NULL if the waypoint is not in the nodes array.
+		None
 --------------------------------------------------*/
-static pathfindnode_t *K_NodesArrayContainsNodeData(
-	pathfindnode_t *nodesarray,
-	void* nodedata,
-	size_t nodesarraycount)
+static void K_PathfindArenaBegin(pathfindsetup_t *const pathfindsetup)
 {
-	pathfindnode_t *foundnode = NULL;
-	size_t i = 0U;
+	I_Assert(pathfindsetup != NULL);
 
-	I_Assert(nodesarray != NULL);
-	I_Assert(nodedata != NULL);
+	if (pathfindsetup->nodesarraycapacity == 0U)
+	{
+		pathfindsetup->nodesarraycapacity = DEFAULT_NODEARRAY_CAPACITY;
+	}
+	if (pathfindsetup->opensetcapacity == 0U)
+	{
+		pathfindsetup->opensetcapacity = DEFAULT_OPENSET_CAPACITY;
+	}
 
-	// It is more likely that we'll find the node we are looking for from the end of the array
-	// Yes, the for loop looks weird, remember that size_t is unsigned and we want to check 0, after it hits 0 it
-	// will loop back up to SIZE_MAX
-	for (i = nodesarraycount - 1U; i < nodesarraycount; i--)
+	if (pathfindarena.nodescapacity < pathfindsetup->nodesarraycapacity)
 	{
-		if (nodesarray[i].nodedata == nodedata)
+		pathfindarena.nodescapacity = pathfindsetup->nodesarraycapacity;
+		pathfindarena.nodes = Z_Realloc(pathfindarena.nodes, pathfindarena.nodescapacity * sizeof(pathfindnode_t), PU_STATIC, NULL);
+		if (pathfindarena.nodes == NULL)
 		{
-			foundnode = &nodesarray[i];
-			break;
+			I_Error("K_PathfindAStar: Out of memory allocating nodes array.");
 		}
 	}
-	return foundnode;
+	pathfindsetup->nodesarraycapacity = pathfindarena.nodescapacity;
+
+	if (pathfindarena.openset.array == NULL)
+	{
+		K_BHeapInit(&pathfindarena.openset, pathfindsetup->opensetcapacity);
+	}
+	pathfindarena.openset.count = 0U;
+	pathfindsetup->opensetcapacity = pathfindarena.openset.capacity;
+
+	if (pathfindarena.slotscapacity < pathfindsetup->numnodeslots)
+	{
+		pathfindarena.slots = Z_Realloc(pathfindarena.slots, pathfindsetup->numnodeslots * sizeof(pathfindslot_t), PU_STATIC, NULL);
+		if (pathfindarena.slots == NULL)
+		{
+			I_Error("K_PathfindAStar: Out of memory allocating node slots.");
+		}
+
+		// Z_Realloc doesn't clear the new part, stale generations could match
+		memset(&pathfindarena.slots[pathfindarena.slotscapacity], 0,
+			(pathfindsetup->numnodeslots - pathfindarena.slotscapacity) * sizeof(pathfindslot_t));
+		pathfindarena.slotscapacity = pathfindsetup->numnodeslots;
+	}
+
+	pathfindarena.generation++;
+	if (pathfindarena.generation == 0U)
+	{
+		// Wrapped around, old slots could look current again
+		memset(pathfindarena.slots, 0, pathfindarena.slotscapacity * sizeof(pathfindslot_t));
+		pathfindarena.generation = 1U;
+	}
 }
 
 /*--------------------------------------------------
-	static dboolean K_ClosedsetContainsNode(pathfindnode_t **closedset, pathfindnode_t *node, size_t closedsetcount)
+	static pathfindslot_t *K_PathfindGetSlot(const pathfindsetup_t *const pathfindsetup, void *const nodedata)
 
-		Checks whether the Closedset contains a node. Searches from the end to the start for speed reasons.
+		Gets the slot of a node's data.
 
 	Input Arguments:-
-		closedset      - The closed set within the A* algorithm
-		node           - The node to check is within the closed set
-		closedsetcount - The current size of the closedset
+		pathfindsetup - The setup for this search
+		nodedata      - The node data to get the slot of
 
 	Return:-
-		True if the node is in the closed set, false if it isn't
+		The slot, or NULL if the node data gave an index out of range.
 --------------------------------------------------*/
-static dboolean K_ClosedsetContainsNode(pathfindnode_t **closedset, pathfindnode_t *node, size_t closedsetcount)
+static pathfindslot_t *K_PathfindGetSlot(const pathfindsetup_t *const pathfindsetup, void *const nodedata)
 {
-	dboolean nodeisinclosedset = false;
-	size_t i = 0U;
+	const size_t slotindex = pathfindsetup->getnodeindex(nodedata);
 
-	I_Assert(closedset != NULL);
-	I_Assert(node != NULL);
-	// It is more likely that we'll find the node we are looking for from the end of the array
-	// Yes, the for loop looks weird, remember that size_t is unsigned and we want to check 0, after it hits 0 it
-	// will loop back up to SIZE_MAX
-	for (i = closedsetcount - 1U; i < closedsetcount; i--)
+	if (slotindex >= pathfindsetup->numnodeslots)
 	{
-		if (closedset[i] == node)
+		CONS_Debug(DBG_GAMELOGIC, "K_PathfindGetSlot: Node index %s is out of range.\n", sizeu1(slotindex));
+		return NULL;
+	}
+
+	return &pathfindarena.slots[slotindex];
+}
+
+/*--------------------------------------------------
+	static pathfindnode_t *K_PathfindNewNode(
+		pathfindsetup_t *const pathfindsetup,
+		size_t *const nodesarraycount,
+		pathfindnode_t **const currentnode)
+
+		Takes the next node from the arena nodes array, growing it and fixing up pointers into it if it's full.
+
+	Input Arguments:-
+		pathfindsetup   - The setup for this search
+		nodesarraycount - The number of nodes used so far, is incremented
+		currentnode     - The node being evaluated, is moved along with the array. May point to NULL.
+
+	Return:-
+		The new node.
+--------------------------------------------------*/
+static pathfindnode_t *K_PathfindNewNode(
+	pathfindsetup_t *const pathfindsetup,
+	size_t *const nodesarraycount,
+	pathfindnode_t **const currentnode)
+{
+	if (*nodesarraycount >= pathfindarena.nodescapacity)
+	{
+		pathfindnode_t *oldnodes = pathfindarena.nodes;
+		pathfindnode_t *newnodes = NULL;
+
+		pathfindarena.nodescapacity *= 2;
+		newnodes = Z_Realloc(oldnodes, pathfindarena.nodescapacity * sizeof(pathfindnode_t), PU_STATIC, NULL);
+
+		if (newnodes == NULL)
+		{
+			I_Error("K_PathfindAStar: Out of memory reallocating nodes array.");
+		}
+
+		// Need to update pointers in openset and node "camefrom" if nodesarray moved.
+		if (newnodes != oldnodes)
 		{
-			nodeisinclosedset = true;
-			break;
+			size_t j = 0U;
+			size_t arrayindex = 0U;
+			for (j = 0U; j < pathfindarena.openset.count; j++)
+			{
+				arrayindex = ((pathfindnode_t *)(pathfindarena.openset.array[j].data)) - oldnodes;
+				pathfindarena.openset.array[j].data = &newnodes[arrayindex];
+			}
+			for (j = 0U; j < *nodesarraycount; j++)
+			{
+				if (newnodes[j].camefrom != NULL)
+				{
+					arrayindex = newnodes[j].camefrom - oldnodes;
+					newnodes[j].camefrom = &newnodes[arrayindex];
+				}
+			}
+
+			if (*currentnode != NULL)
+			{
+				arrayindex = *currentnode - oldnodes;
+				*currentnode = &newnodes[arrayindex];
+			}
 		}
+
+		pathfindarena.nodes = newnodes;
+		pathfindsetup->nodesarraycapacity = pathfindarena.nodescapacity;
 	}
-	return nodeisinclosedset;
+
+	return &pathfindarena.nodes[(*nodesarraycount)++];
 }
 
 /*--------------------------------------------------
@@ -194,6 +294,14 @@ static dboolean K_PathfindSetupValid(const pathfindsetup_t *const pathfindsetup)
 	{
 		CONS_Debug(DBG_GAMELOGIC, "Pathfindsetup has NULL getfinished function.\n");
 	}
+	else if (pathfindsetup->getnodeindex == NULL)
+	{
+		CONS_Debug(DBG_GAMELOGIC, "Pathfindsetup has NULL getnodeindex function.\n");
+	}
+	else if (pathfindsetup->getnodeindex(pathfindsetup->startnodedata) >= pathfindsetup->numnodeslots)
+	{
+		CONS_Debug(DBG_GAMELOGIC, "K_PathfindSetupValid: Source node index is out of range.\n");
+	}
 	else if (pathfindsetup->getconnectednodes(pathfindsetup->startnodedata, &sourcenodenumconnectednodes) == NULL)
 	{
 		CONS_Debug(DBG_GAMELOGIC, "K_PathfindSetupValid: Source node returned NULL connecting nodes.\n");
@@ -316,72 +424,44 @@ dboolean K_PathfindAStar(path_t *const path, pathfindsetup_t *const pathfindsetu
 		}
 		else
 		{
-			bheap_t        openset                 = {0};
+			bheap_t        *openset                = &pathfindarena.openset;
 			bheapitem_t    poppedbheapitem         = {0};
-			pathfindnode_t *nodesarray             = NULL;
-			pathfindnode_t **closedset             = NULL;
 			pathfindnode_t *newnode                = NULL;
 			pathfindnode_t *currentnode            = NULL;
 			pathfindnode_t *connectingnode         = NULL;
+			pathfindslot_t *slot                   = NULL;
 			void           **connectingnodesdata   = NULL;
 			void           *checknodedata          = NULL;
 			uint32_t         *connectingnodecosts    = NULL;
 			size_t         numconnectingnodes      = 0U;
 			size_t         connectingnodeheapindex = 0U;
 			size_t         nodesarraycount         = 0U;
-			size_t         closedsetcount          = 0U;
 			size_t         i                       = 0U;
 			uint32_t         tentativegscore         = 0U;
 
-			// Set the dynamic structure capacites to defaults if they are 0
-			if (pathfindsetup->nodesarraycapacity == 0U)
-			{
-				pathfindsetup->nodesarraycapacity = DEFAULT_NODEARRAY_CAPACITY;
-			}
-			if (pathfindsetup->opensetcapacity == 0U)
-			{
-				pathfindsetup->opensetcapacity = DEFAULT_OPENSET_CAPACITY;
-			}
-			if (pathfindsetup->closedsetcapacity == 0U)
-			{
-				pathfindsetup->closedsetcapacity = DEFAULT_CLOSEDSET_CAPACITY;
-			}
-
-			// Allocate the necessary memory
-			nodesarray = Z_Calloc(pathfindsetup->nodesarraycapacity * sizeof(pathfindnode_t), PU_STATIC, NULL);
-			if (nodesarray == NULL)
-			{
-				I_Error("K_PathfindAStar: Out of memory allocating nodes array.");
-			}
-			closedset = Z_Calloc(pathfindsetup->closedsetcapacity * sizeof(pathfindnode_t*), PU_STATIC, NULL);
-			if (closedset == NULL)
-			{
-				I_Error("K_PathfindAStar: Out of memory allocating closed set.");
-			}
-			K_BHeapInit(&openset, pathfindsetup->opensetcapacity);
+			K_PathfindArenaBegin(pathfindsetup);
 
 			// Create the first node and add it to the open set
-			newnode            = &nodesarray[nodesarraycount];
+			slot = K_PathfindGetSlot(pathfindsetup, pathfindsetup->startnodedata);
+			I_Assert(slot != NULL);
+
+			newnode            = K_PathfindNewNode(pathfindsetup, &nodesarraycount, &currentnode);
 			newnode->heapindex = SIZE_MAX;
 			newnode->nodedata  = pathfindsetup->startnodedata;
 			newnode->camefrom  = NULL;
 			newnode->gscore    = 0U;
 			newnode->hscore    = pathfindsetup->getheuristic(newnode->nodedata, pathfindsetup->endnodedata);
-			nodesarraycount++;
-			K_BHeapPush(&openset, newnode, K_NodeGetFScore(newnode), K_NodeUpdateHeapIndex);
-
-			// update openset capacity if it changed
-			if (openset.capacity != pathfindsetup->opensetcapacity)
-			{
-				pathfindsetup->opensetcapacity = openset.capacity;
-			}
+			slot->generation   = pathfindarena.generation;
+			slot->closed       = false;
+			slot->nodeindex    = nodesarraycount - 1U;
+			K_BHeapPush(openset, newnode, K_NodeGetFScore(newnode), K_NodeUpdateHeapIndex);
 
 			// Go through each node in the openset, adding new ones from each node to it
 			// this continues until a path is found or there are no more nodes to check
-			while (openset.count > 0U)
+			while (openset->count > 0U)
 			{
 				// pop the best node off of the openset
-				K_BHeapPop(&openset, &poppedbheapitem);
+				K_BHeapPop(openset, &poppedbheapitem);
 				currentnode = (pathfindnode_t*)poppedbheapitem.data;
 
 				if (pathfindsetup->getfinished(currentnode, pathfindsetup) == true)
@@ -390,20 +470,9 @@ dboolean K_PathfindAStar(path_t *const path, pathfindsetup_t *const pathfindsetu
 					break;
 				}
 
-				// Place the node we just popped into the closed set, as we are now evaluating it
-				if (closedsetcount >= pathfindsetup->closedsetcapacity)
-				{
-					// Need to reallocate closedset to fit another node
-					pathfindsetup->closedsetcapacity = pathfindsetup->closedsetcapacity * 2;
-					closedset =
-						Z_Realloc(closedset, pathfindsetup->closedsetcapacity * sizeof(pathfindnode_t*), PU_STATIC, NULL);
-					if (closedset == NULL)
-					{
-						I_Error("K_PathfindAStar: Out of memory reallocating closed set.");
-					}
-				}
-				closedset[closedsetcount] = currentnode;
-				closedsetcount++;
+				// Mark the node we just popped as closed, as we are now evaluating it
+				slot = K_PathfindGetSlot(pathfindsetup, currentnode->nodedata);
+				slot->closed = true;
 
 				// Get the needed data for the next nodes from the current node
 				connectingnodesdata = pathfindsetup->getconnectednodes(currentnode->nodedata, &numconnectingnodes);
@@ -420,7 +489,7 @@ dboolean K_PathfindAStar(path_t *const path, pathfindsetup_t *const pathfindsetu
 				else
 				{
 					// For each connecting node add it to the openset if it's unevaluated and not there,
-					// skip it if it's in the closedset or not traversable
+					// skip it if it's closed or not traversable
 					for (i = 0; i < numconnectingnodes; i++)
 					{
 						checknodedata = connectingnodesdata[i];
@@ -437,32 +506,37 @@ dboolean K_PathfindAStar(path_t *const path, pathfindsetup_t *const pathfindsetu
 								continue;
 							}
 
+							slot = K_PathfindGetSlot(pathfindsetup, checknodedata);
+							if (slot == NULL)
+							{
+								continue;
+							}
+
 							// Figure out what the gscore of this route for the connecting node is
 							tentativegscore = currentnode->gscore + connectingnodecosts[i];
 
-							// find this data in the nodes array if it's been generated before
-							connectingnode = K_NodesArrayContainsNodeData(nodesarray, checknodedata, nodesarraycount);
-
-							if (connectingnode != NULL)
+							if (slot->generation == pathfindarena.generation)
 							{
-								// The connecting node has been seen before, so it must be in either the closedset (skip it)
-								// or the openset (re-evaluate it's gscore)
-								if (K_ClosedsetContainsNode(closedset, connectingnode, closedsetcount) == true)
+								// The connecting node has been seen before, so it must be either closed (skip it)
+								// or in the openset (re-evaluate it's gscore)
+								connectingnode = &pathfindarena.nodes[slot->nodeindex];
+
+								if (slot->closed == true)
 								{
 									continue;
 								}
 								else if (tentativegscore < connectingnode->gscore)
 								{
-									// The node is not in the closedset, update it's gscore if this path to it is faster
+									// The node is not closed, update it's gscore if this path to it is faster
 									connectingnode->gscore   = tentativegscore;
 									connectingnode->camefrom = currentnode;
 
 									connectingnodeheapindex =
-										K_BHeapContains(&openset, connectingnode, connectingnode->heapindex);
+										K_BHeapContains(openset, connectingnode, connectingnode->heapindex);
 									if (connectingnodeheapindex != SIZE_MAX)
 									{
 										K_UpdateBHeapItemValue(
-											&openset.array[connectingnodeheapindex], K_NodeGetFScore(connectingnode));
+											&openset->array[connectingnodeheapindex], K_NodeGetFScore(connectingnode));
 									}
 									else
 									{
@@ -474,68 +548,26 @@ dboolean K_PathfindAStar(path_t *const path, pathfindsetup_t *const pathfindsetu
 							else
 							{
 								// Node is not created yet, so it hasn't been seen so far
-								// Reallocate nodesarray if it's full
-								if (nodesarraycount >= pathfindsetup->nodesarraycapacity)
-								{
-									pathfindnode_t *nodesarrayrealloc = NULL;
-									pathfindsetup->nodesarraycapacity = pathfindsetup->nodesarraycapacity * 2;
-									nodesarrayrealloc = Z_Realloc(nodesarray, pathfindsetup->nodesarraycapacity * sizeof(pathfindnode_t), PU_STATIC, NULL);
-
-									if (nodesarrayrealloc == NULL)
-									{
-										I_Error("K_PathfindAStar: Out of memory reallocating nodes array.");
-									}
-
-									// Need to update pointers in closedset, openset, and node "camefrom" if nodesarray moved.
-									if (nodesarray != nodesarrayrealloc)
-									{
-										size_t j = 0U;
-										size_t arrayindex = 0U;
-										for (j = 0U; j < closedsetcount; j++)
-										{
-											arrayindex = closedset[j] - nodesarray;
-											closedset[j] = &nodesarrayrealloc[arrayindex];
-										}
-										for (j = 0U; j < openset.count; j++)
-										{
-											arrayindex = ((pathfindnode_t *)(openset.array[j].data)) - nodesarray;
-											openset.array[j].data = &nodesarrayrealloc[arrayindex];
-										}
-										for (j = 0U; j < nodesarraycount; j++)
-										{
-											if (nodesarrayrealloc[j].camefrom != NULL)
-											{
-												arrayindex = nodesarrayrealloc[j].camefrom - nodesarray;
-												nodesarrayrealloc[j].camefrom = &nodesarrayrealloc[arrayindex];
-											}
-										}
-
-										arrayindex = currentnode - nodesarray;
-										currentnode = &nodesarrayrealloc[arrayindex];
-									}
-
-									nodesarray = nodesarrayrealloc;
-								}
-
 								// Create the new node and add it to the nodes array and open set
-								newnode            = &nodesarray[nodesarraycount];
+								newnode            = K_PathfindNewNode(pathfindsetup, &nodesarraycount, &currentnode);
 								newnode->heapindex = SIZE_MAX;
 								newnode->nodedata  = checknodedata;
 								newnode->camefrom  = currentnode;
 								newnode->gscore    = tentativegscore;
 								newnode->hscore    = pathfindsetup->getheuristic(newnode->nodedata, pathfindsetup->endnodedata);
-								nodesarraycount++;
-								K_BHeapPush(&openset, newnode, K_NodeGetFScore(newnode), K_NodeUpdateHeapIndex);
+								slot->generation   = pathfindarena.generation;
+								slot->closed       = false;
+								slot->nodeindex    = nodesarraycount - 1U;
+								K_BHeapPush(openset, newnode, K_NodeGetFScore(newnode), K_NodeUpdateHeapIndex);
 							}
 						}
 					}
 				}
 			}
 
-			// Clean up the memory
-			K_BHeapFree(&openset);
-			Z_Free(closedset);
-			Z_Free(nodesarray);
+			// The arena is kept for the next search, just report how big it got
+			pathfindsetup->opensetcapacity = openset->capacity;
+			openset->count = 0U;
 		}
 	}
 
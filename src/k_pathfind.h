@@ -36,6 +36,9 @@ typedef dboolean(*getnodetraversablefunc)(void*, void*);
 // function pointer for getting if a node is our pathfinding end point
 typedef dboolean(*getpathfindfinishedfunc)(void*, void*);
 
+// function pointer for getting a node's unique index from its base data, must be less than numnodeslots
+typedef size_t(*getnodeindexfunc)(void*);
+
 
 // A pathfindnode contains information about a node from the pathfinding
 // heapindex is only used within the pathfinding algorithm itself, and is always 0 after it is completed
@@ -58,11 +61,12 @@ struct path_t {
 // (e.g. the base capacities of the dynamically allocated arrays)
 // should be setup by the caller before starting pathfinding
 // base capacities will be 8 if they aren't setup, missing callback functions will cause an error.
+// The arrays are kept between searches and only grow, so the capacities are a hint for the first search.
 // Can be accessed after the pathfinding is complete to get the final capacities of them
 struct pathfindsetup_t {
 	size_t opensetcapacity;
-	size_t closedsetcapacity;
 	size_t nodesarraycapacity;
+	size_t numnodeslots;    // One more than the highest index getnodeindex can return
 	void   *startnodedata;
 	void   *endnodedata;
 	uint32_t endgscore;
@@ -71,6 +75,7 @@ struct pathfindsetup_t {
 	getnodeheuristicfunc getheuristic;
 	getnodetraversablefunc gettraversable;
 	getpathfindfinishedfunc getfinished;
+	getnodeindexfunc getnodeindex;
 };
 
 
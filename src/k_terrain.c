@@ -44,6 +44,7 @@ static size_t numTerrainDefs = 0;
 
 static t_floor_t *terrainFloorDefs = NULL;
 static size_t numTerrainFloorDefs = 0;
+static texnameindex_t terrainFloorIndex; // first floor definition for each texture name
 
 static size_t defaultTerrain = SIZE_MAX;
 static size_t defaultOffroadFootstep = SIZE_MAX;
@@ -349,20 +350,12 @@ size_t K_GetDefaultTerrainID(void)
 --------------------------------------------------*/
 terrain_t *K_GetTerrainForTextureName(const char *checkName)
 {
-	uint32_t checkHash = quickncasehash(checkName, 8);
-	size_t i;
+	const int32_t i = R_FindInNameIndex(&terrainFloorIndex, checkName);
 
-	if (numTerrainFloorDefs > 0)
+	if (i != -1)
 	{
-		for (i = 0; i < numTerrainFloorDefs; i++)
-		{
-			t_floor_t *f = &terrainFloorDefs[i];
-
-			if (checkHash == f->textureHash && !strncasecmp(checkName, f->textureName, 8))
-			{
-				return K_GetTerrainByIndex(f->terrainID);
-			}
-		}
+		t_floor_t *f = &terrainFloorDefs[i];
+		return K_GetTerrainByIndex(f->terrainID);
 	}
 
 	// This texture doesn't have a terrain directly applied to it,
@@ -377,20 +370,12 @@ terrain_t *K_GetTerrainForTextureName(const char *checkName)
 --------------------------------------------------*/
 size_t K_GetTerrainIDForTextureName(const char *checkName)
 {
-	uint32_t checkHash = quickncasehash(checkName, 8);
-	size_t i;
+	const int32_t i = R_FindInNameIndex(&terrainFloorIndex, checkName);
 
-	if (numTerrainFloorDefs > 0)
+	if (i != -1)
 	{
-		for (i = 0; i < numTerrainFloorDefs; i++)
-		{
-			t_floor_t *f = &terrainFloorDefs[i];
-
-			if (checkHash == f->textureHash && !strncasecmp(checkName, f->textureName, 8))
-			{
-				return f->terrainID;
-			}
-		}
+		t_floor_t *f = &terrainFloorDefs[i];
+		return f->terrainID;
 	}
 
 	// This texture doesn't have a terrain directly applied to it,
@@ -2049,26 +2034,29 @@ static dboolean K_TERRAINLumpParser(char *data, size_t size)
 				if (tkn && pos <= size)
 				{
 					t_floor_t *f = NULL;
+					int32_t floorID = R_FindInNameIndex(&terrainFloorIndex, tkn);
 
 					tknHash = quickncasehash(tkn, 8);
 
-					for (i = 0; i < numTerrainFloorDefs; i++)
+					if (floorID != -1 && !strncmp(tkn, terrainFloorDefs[floorID].textureName, 8))
 					{
-						f = &terrainFloorDefs[i];
-
-						if (f->textureHash == tknHash && !strncmp(tkn, f->textureName, 8))
-						{
-							break;
-						}
+						f = &terrainFloorDefs[floorID];
 					}
-
-					if (i == numTerrainFloorDefs)
+					else
 					{
+						i = numTerrainFloorDefs;
 						K_NewTerrainFloorDefs();
 						f = &terrainFloorDefs[i];
 
 						strncpy(f->textureName, tkn, 8);
 						f->textureHash = tknHash;
+
+						// Lookups ignore case, so only the first
+						// definition for a name is ever found.
+						if (floorID == -1)
+						{
+							R_AddToNameIndex(&terrainFloorIndex, f->textureName, (int32_t)i);
+						}
 					}
 
 					Z_Free(tkn);
@@ -2268,6 +2256,4 @@ void K_InitTerrain(uint16_t wadNum)
 			free(name);
 		}
 	}
-
-	R_ClearTextureNumCache(false);
 }
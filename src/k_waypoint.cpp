@@ -36,7 +36,6 @@ static const uint32_t SPARKLES_PER_CONNECTION = 16U;
 // Some defaults for the size of the dynamically allocated sets for pathfinding. These are kept for the purpose of
 // allocating a size that is less likely to need reallocating again during the pathfinding.
 #define OPENSET_BASE_SIZE    (16U)
-#define CLOSEDSET_BASE_SIZE  (256U)
 #define NODESARRAY_BASE_SIZE (256U)
 
 static waypoint_t *waypointheap  = NULL;
@@ -52,9 +51,12 @@ static int32_t trackcomplexity = 0;
 static size_t numwaypoints       = 0U;
 static size_t numwaypointmobjs   = 0U;
 static size_t baseopensetsize    = OPENSET_BASE_SIZE;
-static size_t baseclosedsetsize  = CLOSEDSET_BASE_SIZE;
 static size_t basenodesarraysize = NODESARRAY_BASE_SIZE;
 
+static void K_ClearWaypointRoutes(void);
+static void K_BuildWaypointRoutes(void);
+static void K_WaypointRouteStateChanged(waypoint_t *const waypoint);
+
 
 /*--------------------------------------------------
 	waypoint_t *K_GetFinishLineWaypoint(void)
@@ -168,7 +170,14 @@ void K_SetWaypointIsEnabled(waypoint_t *waypoint, dboolean enabled)
 	}
 	else
 	{
+		const dboolean wasenabled = (waypoint->mobj->extravalue1 == 1);
+
 		waypoint->mobj->extravalue1 = enabled ? 1 : 0;
+
+		if (wasenabled != (enabled ? true : false))
+		{
+			K_WaypointRouteStateChanged(waypoint);
+		}
 	}
 }
 
@@ -322,6 +331,334 @@ int32_t K_GetTrackComplexity(void)
 	return trackcomplexity;
 }
 
+// Waypoints bucketed into a uniform grid, so the closest waypoint searches only look at waypoints that could possibly
+// win instead of all of them. The result is exactly the same as checking every waypoint in heap order.
+// Positions and radii are taken when the waypoints are setup, and the grid is built again if Lua moves any of them.
+#define WAYPOINTGRID_MINCELLSIZE   (512)
+#define WAYPOINTGRID_MAXCELLS      (128) // Per axis, the cells get bigger on huge maps instead
+#define WAYPOINTGRID_MAXCOVERCELLS (64)  // Waypoints with radii covering more cells than this are always checked
+#define WAYPOINTGRID_SLACK         (4)   // P_AproxDistance can round down a little from the real distance
+
+namespace
+{
+
+struct waypointgrid_t
+{
+	int32_t originx, originy;
+	int32_t cellsize;
+	int32_t width, height;
+	srb2::Vector<uint32_t> cellstarts;     // Offsets into cellwaypoints for each cell, plus one for the end
+	srb2::Vector<uint32_t> cellwaypoints;  // Heap indices of the waypoints positioned in each cell
+	srb2::Vector<uint32_t> coverstarts;    // Offsets into coverwaypoints for each cell, plus one for the end
+	srb2::Vector<uint32_t> coverwaypoints; // Heap indices of the waypoints whose radius reaches into each cell
+	srb2::Vector<uint32_t> hugewaypoints;  // Heap indices of the waypoints whose radius is too big to bucket
+	srb2::Vector<uint32_t> stamps;         // Per waypoint, to only gather each one once per search
+	srb2::Vector<uint32_t> candidates;
+	srb2::Vector<int32_t> positions;       // Per waypoint, the x, y and radius it was bucketed with
+	uint32_t stamp;
+	dboolean checked;
+	tic_t checkedtic;
+};
+
+waypointgrid_t waypointgrid;
+
+} // namespace
+
+static int32_t K_WaypointGridCellX(int32_t x)
+{
+	return std::clamp((x - waypointgrid.originx) / waypointgrid.cellsize, 0, waypointgrid.width - 1);
+}
+
+static int32_t K_WaypointGridCellY(int32_t y)
+{
+	return std::clamp((y - waypointgrid.originy) / waypointgrid.cellsize, 0, waypointgrid.height - 1);
+}
+
+/*--------------------------------------------------
+	static dboolean K_WaypointGridCoverBox(
+		const waypoint_t *const waypoint,
+		int32_t *const          box)
+
+		Gets the cells a waypoint's radius reaches into.
+
+	Input Arguments:-
+		waypoint - The waypoint to get the cells of
+		box      - Return location for the first and last cell, as x1, y1, x2, y2
+
+	Return:-
+		True if the waypoint should be bucketed by its radius, false if it covers too many cells.
+--------------------------------------------------*/
+static dboolean K_WaypointGridCoverBox(const waypoint_t *const waypoint, int32_t *const box)
+{
+	const int32_t x = waypoint->mobj->x / FRACUNIT;
+	const int32_t y = waypoint->mobj->y / FRACUNIT;
+	const int32_t rad = (waypoint->mobj->radius / FRACUNIT) + WAYPOINTGRID_SLACK;
+
+	box[0] = K_WaypointGridCellX(x - rad);
+	box[1] = K_WaypointGridCellY(y - rad);
+	box[2] = K_WaypointGridCellX(x + rad);
+	box[3] = K_WaypointGridCellY(y + rad);
+
+	return ((box[2] - box[0] + 1) * (box[3] - box[1] + 1) <= WAYPOINTGRID_MAXCOVERCELLS);
+}
+
+/*--------------------------------------------------
+	static void K_BuildWaypointGrid(void)
+
+		Builds the waypoint grid from the waypoint heap.
+--------------------------------------------------*/
+static void K_BuildWaypointGrid(void)
+{
+	waypointgrid_t &grid = waypointgrid;
+	int32_t minx = INT32_MAX, miny = INT32_MAX;
+	int32_t maxx = INT32_MIN, maxy = INT32_MIN;
+	int32_t box[4];
+
+	if (numwaypoints == 0U)
+	{
+		return;
+	}
+
+	for (size_t i = 0U; i < numwaypoints; i++)
+	{
+		const mobj_t *mo = waypointheap[i].mobj;
+
+		minx = std::min(minx, mo->x / FRACUNIT);
+		miny = std::min(miny, mo->y / FRACUNIT);
+		maxx = std::max(maxx, mo->x / FRACUNIT);
+		maxy = std::max(maxy, mo->y / FRACUNIT);
+	}
+
+	grid.originx  = minx;
+	grid.originy  = miny;
+	grid.cellsize = std::max(WAYPOINTGRID_MINCELLSIZE, (std::max(maxx - minx, maxy - miny) / WAYPOINTGRID_MAXCELLS) + 1);
+	grid.width    = ((maxx - minx) / grid.cellsize) + 1;
+	grid.height   = ((maxy - miny) / grid.cellsize) + 1;
+
+	const size_t numcells = (size_t)(grid.width * grid.height);
+
+	grid.cellstarts.clear();
+	grid.cellstarts.resize(numcells + 1, 0U);
+	grid.coverstarts.clear();
+	grid.coverstarts.resize(numcells + 1, 0U);
+	grid.hugewaypoints.clear();
+
+	// Count how many go into each cell, then turn the counts into offsets and fill them in
+	for (size_t i = 0U; i < numwaypoints; i++)
+	{
+		const mobj_t *mo = waypointheap[i].mobj;
+
+		grid.cellstarts[K_WaypointGridCellY(mo->y / FRACUNIT) * grid.width + K_WaypointGridCellX(mo->x / FRACUNIT) + 1]++;
+
+		if (K_WaypointGridCoverBox(&waypointheap[i], box) == true)
+		{
+			for (int32_t cy = box[1]; cy <= box[3]; cy++)
+			{
+				for (int32_t cx = box[0]; cx <= box[2]; cx++)
+				{
+					grid.coverstarts[cy * grid.width + cx + 1]++;
+				}
+			}
+		}
+		else
+		{
+			grid.hugewaypoints.push_back((uint32_t)i);
+		}
+	}
+
+	for (size_t i = 0U; i < numcells; i++)
+	{
+		grid.cellstarts[i + 1] += grid.cellstarts[i];
+		grid.coverstarts[i + 1] += grid.coverstarts[i];
+	}
+
+	grid.cellwaypoints.resize(grid.cellstarts[numcells]);
+	grid.coverwaypoints.resize(grid.coverstarts[numcells]);
+
+	{
+		srb2::Vector<uint32_t> cellfill(grid.cellstarts.begin(), grid.cellstarts.end() - 1);
+		srb2::Vector<uint32_t> coverfill(grid.coverstarts.begin(), grid.coverstarts.end() - 1);
+
+		// Heap order, so every cell's list is sorted by heap index
+		for (size_t i = 0U; i < numwaypoints; i++)
+		{
+			const mobj_t *mo = waypointheap[i].mobj;
+			const int32_t cell = K_WaypointGridCellY(mo->y / FRACUNIT) * grid.width + K_WaypointGridCellX(mo->x / FRACUNIT);
+
+			grid.cellwaypoints[cellfill[cell]++] = (uint32_t)i;
+
+			if (K_WaypointGridCoverBox(&waypointheap[i], box) == true)
+			{
+				for (int32_t cy = box[1]; cy <= box[3]; cy++)
+				{
+					for (int32_t cx = box[0]; cx <= box[2]; cx++)
+					{
+						grid.coverwaypoints[coverfill[cy * grid.width + cx]++] = (uint32_t)i;
+					}
+				}
+			}
+		}
+	}
+
+	grid.stamps.clear();
+	grid.stamps.resize(numwaypoints, 0U);
+	grid.stamp = 0U;
+
+	grid.positions.clear();
+	grid.positions.resize(numwaypoints * 3, 0);
+
+	for (size_t i = 0U; i < numwaypoints; i++)
+	{
+		const mobj_t *mo = waypointheap[i].mobj;
+
+		grid.positions[i * 3]     = mo->x / FRACUNIT;
+		grid.positions[i * 3 + 1] = mo->y / FRACUNIT;
+		grid.positions[i * 3 + 2] = mo->radius / FRACUNIT;
+	}
+
+	grid.checked = false;
+}
+
+/*--------------------------------------------------
+	static void K_ClearWaypointGrid(void)
+
+		Throws away the waypoint grid.
+--------------------------------------------------*/
+static void K_ClearWaypointGrid(void)
+{
+	waypointgrid.width = waypointgrid.height = 0;
+	waypointgrid.cellstarts.clear();
+	waypointgrid.cellwaypoints.clear();
+	waypointgrid.coverstarts.clear();
+	waypointgrid.coverwaypoints.clear();
+	waypointgrid.hugewaypoints.clear();
+	waypointgrid.stamps.clear();
+	waypointgrid.candidates.clear();
+	waypointgrid.positions.clear();
+	waypointgrid.checked = false;
+}
+
+/*--------------------------------------------------
+	static void K_CheckWaypointGridPositions(void)
+
+		Builds the grid again if any waypoint has moved or changed radius since it was bucketed, which
+		only happens if Lua moves them. Only checks once per tic.
+--------------------------------------------------*/
+static void K_CheckWaypointGridPositions(void)
+{
+	waypointgrid_t &grid = waypointgrid;
+
+	if (grid.checked == true && grid.checkedtic == leveltime)
+	{
+		return;
+	}
+
+	for (size_t i = 0U; i < numwaypoints; i++)
+	{
+		const mobj_t *mo = waypointheap[i].mobj;
+
+		if (grid.positions[i * 3] != mo->x / FRACUNIT
+			|| grid.positions[i * 3 + 1] != mo->y / FRACUNIT
+			|| grid.positions[i * 3 + 2] != mo->radius / FRACUNIT)
+		{
+			K_BuildWaypointGrid();
+			break;
+		}
+	}
+
+	grid.checked = true;
+	grid.checkedtic = leveltime;
+}
+
+/*--------------------------------------------------
+	static dboolean K_WaypointGridValid(void)
+
+		Returns true if the grid matches the current waypoints and can be searched.
+--------------------------------------------------*/
+static dboolean K_WaypointGridValid(void)
+{
+	if (waypointgrid.width <= 0 || waypointgrid.stamps.size() != numwaypoints)
+	{
+		return false;
+	}
+
+	K_CheckWaypointGridPositions();
+	return true;
+}
+
+/*--------------------------------------------------
+	static void K_WaypointGridNextStamp(void)
+
+		Starts a new search, so waypoints gathered by the last one can be gathered again.
+--------------------------------------------------*/
+static void K_WaypointGridNextStamp(void)
+{
+	waypointgrid.candidates.clear();
+	waypointgrid.stamp++;
+
+	if (waypointgrid.stamp == 0U)
+	{
+		std::fill(waypointgrid.stamps.begin(), waypointgrid.stamps.end(), 0U);
+		waypointgrid.stamp = 1U;
+	}
+}
+
+static void K_WaypointGridGather(uint32_t index)
+{
+	if (waypointgrid.stamps[index] != waypointgrid.stamp)
+	{
+		waypointgrid.stamps[index] = waypointgrid.stamp;
+		waypointgrid.candidates.push_back(index);
+	}
+}
+
+/*--------------------------------------------------
+	static void K_WaypointGridGatherBox(int32_t x, int32_t y, int32_t dist)
+
+		Gathers every waypoint positioned within dist units of a point on either axis. Can gather a few extra.
+--------------------------------------------------*/
+static void K_WaypointGridGatherBox(int32_t x, int32_t y, int32_t dist)
+{
+	const int32_t x1 = K_WaypointGridCellX(x - dist);
+	const int32_t y1 = K_WaypointGridCellY(y - dist);
+	const int32_t x2 = K_WaypointGridCellX(x + dist);
+	const int32_t y2 = K_WaypointGridCellY(y + dist);
+
+	for (int32_t cy = y1; cy <= y2; cy++)
+	{
+		for (int32_t cx = x1; cx <= x2; cx++)
+		{
+			const int32_t cell = cy * waypointgrid.width + cx;
+
+			for (uint32_t i = waypointgrid.cellstarts[cell]; i < waypointgrid.cellstarts[cell + 1]; i++)
+			{
+				K_WaypointGridGather(waypointgrid.cellwaypoints[i]);
+			}
+		}
+	}
+}
+
+/*--------------------------------------------------
+	static void K_WaypointGridGatherCovering(int32_t x, int32_t y)
+
+		Gathers every waypoint whose radius could reach a point. Can gather a few extra.
+--------------------------------------------------*/
+static void K_WaypointGridGatherCovering(int32_t x, int32_t y)
+{
+	// Both the cover boxes and the point are clamped into the grid the same way, so points outside of it still work
+	const int32_t cell = K_WaypointGridCellY(y) * waypointgrid.width + K_WaypointGridCellX(x);
+
+	for (uint32_t i = waypointgrid.coverstarts[cell]; i < waypointgrid.coverstarts[cell + 1]; i++)
+	{
+		K_WaypointGridGather(waypointgrid.coverwaypoints[i]);
+	}
+
+	for (uint32_t index : waypointgrid.hugewaypoints)
+	{
+		K_WaypointGridGather(index);
+	}
+}
+
 /*--------------------------------------------------
 	waypoint_t *K_GetClosestWaypointToMobj(mobj_t *const mobj)
 
@@ -342,20 +679,57 @@ waypoint_t *K_GetClosestWaypointToMobj(mobj_t *const mobj)
 		fixed_t    closestdist    = INT32_MAX;
 		fixed_t    checkdist      = INT32_MAX;
 
-		for (i = 0; i < numwaypoints; i++)
+		auto check_waypoint = [&](waypoint_t *const checkwaypoint)
 		{
-			checkwaypoint = &waypointheap[i];
-
 			checkdist = P_AproxDistance(
 				(mobj->x / FRACUNIT) - (checkwaypoint->mobj->x / FRACUNIT),
 				(mobj->y / FRACUNIT) - (checkwaypoint->mobj->y / FRACUNIT));
 			checkdist = P_AproxDistance(checkdist, (mobj->z / FRACUNIT) - (checkwaypoint->mobj->z / FRACUNIT));
 
-			if (checkdist < closestdist)
+			// Ties go to the earliest in the heap, same as checking them in order
+			if (checkdist < closestdist
+				|| (checkdist == closestdist && checkwaypoint < closestwaypoint))
 			{
 				closestwaypoint = checkwaypoint;
 				closestdist = checkdist;
 			}
+		};
+
+		if (K_WaypointGridValid() == true)
+		{
+			const int32_t x = mobj->x / FRACUNIT;
+			const int32_t y = mobj->y / FRACUNIT;
+			int32_t searchdist = waypointgrid.cellsize;
+			size_t checked = 0U;
+
+			K_WaypointGridNextStamp();
+
+			// Grow the search box until nothing outside of it could be closer
+			while (true)
+			{
+				K_WaypointGridGatherBox(x, y, searchdist);
+
+				for (; checked < waypointgrid.candidates.size(); checked++)
+				{
+					check_waypoint(&waypointheap[waypointgrid.candidates[checked]]);
+				}
+
+				if (waypointgrid.candidates.size() == numwaypoints
+					|| (closestwaypoint != NULL && closestdist < searchdist - WAYPOINTGRID_SLACK))
+				{
+					break;
+				}
+
+				searchdist *= 2;
+			}
+		}
+		else
+		{
+			for (i = 0; i < numwaypoints; i++)
+			{
+				checkwaypoint = &waypointheap[i];
+				check_waypoint(checkwaypoint);
+			}
 		}
 	}
 
@@ -517,9 +891,31 @@ waypoint_t *K_GetBestWaypointForMobj(mobj_t *const mobj, waypoint_t *const hint)
 			sort_waypoint(hint);
 		}
 
-		for (size_t i = 0U; i < numwaypoints; i++)
+		if (closestdist != INT32_MAX && K_WaypointGridValid() == true)
 		{
-			sort_waypoint(&waypointheap[i]);
+			const int32_t x = mobj->x / FRACUNIT;
+			const int32_t y = mobj->y / FRACUNIT;
+
+			// closestdist only ever goes down from here, so the only waypoints that can change anything are
+			// ones closer than it is now, or ones whose radius the mobj is inside of. Everything else would
+			// fall through both checks, so skip it and go through the rest in heap order like normal.
+			K_WaypointGridNextStamp();
+			K_WaypointGridGatherBox(x, y, closestdist + WAYPOINTGRID_SLACK);
+			K_WaypointGridGatherCovering(x, y);
+
+			std::sort(waypointgrid.candidates.begin(), waypointgrid.candidates.end());
+
+			for (uint32_t index : waypointgrid.candidates)
+			{
+				sort_waypoint(&waypointheap[index]);
+			}
+		}
+		else
+		{
+			for (size_t i = 0U; i < numwaypoints; i++)
+			{
+				sort_waypoint(&waypointheap[i]);
+			}
 		}
 	}
 
@@ -861,26 +1257,6 @@ static size_t K_GetOpensetBaseSize(void)
 	return returnsize;
 }
 
-/*--------------------------------------------------
-	static size_t K_GetClosedsetBaseSize(void)
-
-		Gets the base size the Closedset heap should have
-
-	Input Arguments:-
-		None
-
-	Return:-
-		The base size the Closedset heap should have
---------------------------------------------------*/
-static size_t K_GetClosedsetBaseSize(void)
-{
-	size_t returnsize = 0;
-
-	returnsize = baseclosedsetsize;
-
-	return returnsize;
-}
-
 /*--------------------------------------------------
 	static size_t K_GetNodesArrayBaseSize(void)
 
@@ -920,25 +1296,6 @@ static void K_UpdateOpensetBaseSize(size_t newbaseopensetsize)
 	}
 }
 
-/*--------------------------------------------------
-	static void K_UpdateClosedsetBaseSize(size_t newbaseclosedsetsize)
-
-		Sets the new base size of the closedset heap, if it is bigger than before.
-
-	Input Arguments:-
-		newbaseclosedsetsize - The size to try and set the base Closedset size to
-
-	Return:-
-		None
---------------------------------------------------*/
-static void K_UpdateClosedsetBaseSize(size_t newbaseclosedsetsize)
-{
-	if (newbaseclosedsetsize > baseopensetsize)
-	{
-		baseclosedsetsize = newbaseclosedsetsize;
-	}
-}
-
 /*--------------------------------------------------
 	static void K_UpdateNodesArrayBaseSize(size_t newnodesarraysize)
 
@@ -1082,6 +1439,22 @@ static uint32_t *K_WaypointPathfindGetPrevCosts(void* data)
 	return connectingnodecosts;
 }
 
+/*--------------------------------------------------
+	static size_t K_WaypointPathfindGetIndex(void *data)
+
+		Gets the index of a waypoint in the waypoint heap. For pathfinding only.
+
+	Input Arguments:-
+		data - Should point to a waypoint_t
+
+	Return:-
+		The waypoint's heap index.
+--------------------------------------------------*/
+static size_t K_WaypointPathfindGetIndex(void *data)
+{
+	return K_GetWaypointHeapIndex((waypoint_t *)data);
+}
+
 /*--------------------------------------------------
 	static uint32_t K_WaypointPathfindGetHeuristic(void *data1, void *data2)
 
@@ -1379,8 +1752,8 @@ dboolean K_PathfindToWaypoint(
 		}
 
 		pathfindsetup.opensetcapacity    = K_GetOpensetBaseSize();
-		pathfindsetup.closedsetcapacity  = K_GetClosedsetBaseSize();
 		pathfindsetup.nodesarraycapacity = K_GetNodesArrayBaseSize();
+		pathfindsetup.numnodeslots       = numwaypoints;
 		pathfindsetup.startnodedata      = sourcewaypoint;
 		pathfindsetup.endnodedata        = destinationwaypoint;
 		pathfindsetup.getconnectednodes  = nextnodesfunc;
@@ -1388,11 +1761,11 @@ dboolean K_PathfindToWaypoint(
 		pathfindsetup.getheuristic       = heuristicfunc;
 		pathfindsetup.gettraversable     = traversablefunc;
 		pathfindsetup.getfinished        = finishedfunc;
+		pathfindsetup.getnodeindex       = K_WaypointPathfindGetIndex;
 
 		pathfound = K_PathfindAStar(returnpath, &pathfindsetup);
 
 		K_UpdateOpensetBaseSize(pathfindsetup.opensetcapacity);
-		K_UpdateClosedsetBaseSize(pathfindsetup.closedsetcapacity);
 		K_UpdateNodesArrayBaseSize(pathfindsetup.nodesarraycapacity);
 	}
 
@@ -1454,8 +1827,8 @@ dboolean K_PathfindThruCircuit(
 		}
 
 		pathfindsetup.opensetcapacity    = K_GetOpensetBaseSize();
-		pathfindsetup.closedsetcapacity  = K_GetClosedsetBaseSize();
 		pathfindsetup.nodesarraycapacity = K_GetNodesArrayBaseSize();
+		pathfindsetup.numnodeslots       = numwaypoints;
 		pathfindsetup.startnodedata      = sourcewaypoint;
 		pathfindsetup.endnodedata        = finishline;
 		pathfindsetup.endgscore          = traveldistance;
@@ -1464,11 +1837,11 @@ dboolean K_PathfindThruCircuit(
 		pathfindsetup.getheuristic       = heuristicfunc;
 		pathfindsetup.gettraversable     = traversablefunc;
 		pathfindsetup.getfinished        = finishedfunc;
+		pathfindsetup.getnodeindex       = K_WaypointPathfindGetIndex;
 
 		pathfound = K_PathfindAStar(returnpath, &pathfindsetup);
 
 		K_UpdateOpensetBaseSize(pathfindsetup.opensetcapacity);
-		K_UpdateClosedsetBaseSize(pathfindsetup.closedsetcapacity);
 		K_UpdateNodesArrayBaseSize(pathfindsetup.nodesarraycapacity);
 	}
 
@@ -1530,8 +1903,8 @@ dboolean K_PathfindThruCircuitSpawnable(
 		}
 
 		pathfindsetup.opensetcapacity    = K_GetOpensetBaseSize();
-		pathfindsetup.closedsetcapacity  = K_GetClosedsetBaseSize();
 		pathfindsetup.nodesarraycapacity = K_GetNodesArrayBaseSize();
+		pathfindsetup.numnodeslots       = numwaypoints;
 		pathfindsetup.startnodedata      = sourcewaypoint;
 		pathfindsetup.endnodedata        = finishline;
 		pathfindsetup.endgscore          = traveldistance;
@@ -1540,17 +1913,447 @@ dboolean K_PathfindThruCircuitSpawnable(
 		pathfindsetup.getheuristic       = heuristicfunc;
 		pathfindsetup.gettraversable     = traversablefunc;
 		pathfindsetup.getfinished        = finishedfunc;
+		pathfindsetup.getnodeindex       = K_WaypointPathfindGetIndex;
 
 		pathfound = K_PathfindAStar(returnpath, &pathfindsetup);
 
 		K_UpdateOpensetBaseSize(pathfindsetup.opensetcapacity);
-		K_UpdateClosedsetBaseSize(pathfindsetup.closedsetcapacity);
 		K_UpdateNodesArrayBaseSize(pathfindsetup.nodesarraycapacity);
 	}
 
 	return pathfound;
 }
 
+// Route tables remember what K_PathfindToWaypoint found from each waypoint to one destination, for one pathfinding
+// policy. Every entry is the result of running that same search, so the tables can only ever give the answers the
+// search would. The tables to the finish line are filled in for every waypoint when the waypoints are setup, tables
+// to anything else fill each entry the first time it's asked for.
+//
+// Enabling or disabling a waypoint through K_SetWaypointIsEnabled, or calling K_InvalidateWaypointRoutes, bumps
+// routegeneration, and every entry from an older generation is searched again when it's next asked for. Lua can
+// change waypoints without going through either, so everything the search reads (whether waypoints are enabled or
+// shortcuts, and their positions for the heuristic) is also compared once per tic.
+#define MAXROUTETABLES (16U)
+#define ROUTE_UNKNOWN (UINT32_MAX)
+#define ROUTE_UNREACHABLE (UINT32_MAX - 1U)
+
+#define ROUTESTATE_ENABLED  (1U)
+#define ROUTESTATE_SHORTCUT (2U)
+
+namespace
+{
+
+struct waypointroute_t
+{
+	uint32_t nexthop;  // Heap index of the next waypoint, or ROUTE_UNKNOWN / ROUTE_UNREACHABLE
+	uint32_t distance; // totaldist of the path
+};
+
+struct waypointroutetable_t
+{
+	waypoint_t *destination;
+	dboolean useshortcuts;
+	dboolean huntbackwards;
+	dboolean pinned; // Built at setup, never reused for another destination
+	uint32_t generation;
+	tic_t lastused;
+	srb2::Vector<waypointroute_t> routes; // One for every waypoint, by heap index
+};
+
+struct waypointroutestate_t
+{
+	uint8_t flags; // ROUTESTATE_ flags
+	fixed_t x, y, z;
+};
+
+srb2::Vector<waypointroutetable_t> routetables;
+srb2::Vector<waypointroutestate_t> routestates; // Every waypoint, as the route tables last saw them
+uint32_t routegeneration = 0U;
+dboolean routestateschecked = false;
+tic_t routestatestic = 0U; // leveltime routestates were last compared on
+
+} // namespace
+
+/*--------------------------------------------------
+	void K_InvalidateWaypointRoutes(void)
+
+		See header file for description.
+--------------------------------------------------*/
+void K_InvalidateWaypointRoutes(void)
+{
+	routegeneration++;
+}
+
+/*--------------------------------------------------
+	static waypointroutestate_t K_GetWaypointRouteState(waypoint_t *const waypoint)
+
+		Gets the state of a waypoint that pathfinding depends on.
+
+	Input Arguments:-
+		waypoint - The waypoint to get the state of
+
+	Return:-
+		The state of the waypoint.
+--------------------------------------------------*/
+static waypointroutestate_t K_GetWaypointRouteState(waypoint_t *const waypoint)
+{
+	waypointroutestate_t state = {0};
+
+	if (K_GetWaypointIsEnabled(waypoint) == true)
+	{
+		state.flags |= ROUTESTATE_ENABLED;
+	}
+	if (K_GetWaypointIsShortcut(waypoint) == true)
+	{
+		state.flags |= ROUTESTATE_SHORTCUT;
+	}
+
+	if (waypoint->mobj != NULL)
+	{
+		state.x = waypoint->mobj->x;
+		state.y = waypoint->mobj->y;
+		state.z = waypoint->mobj->z;
+	}
+
+	return state;
+}
+
+/*--------------------------------------------------
+	static void K_WaypointRouteStateChanged(waypoint_t *const waypoint)
+
+		Invalidates the route tables after a waypoint was changed, and remembers its new state so the next
+		K_CheckWaypointRouteStates doesn't invalidate them again for it.
+
+	Input Arguments:-
+		waypoint - The waypoint that changed
+--------------------------------------------------*/
+static void K_WaypointRouteStateChanged(waypoint_t *const waypoint)
+{
+	const size_t i = K_GetWaypointHeapIndex(waypoint);
+
+	if (i < routestates.size())
+	{
+		routestates[i] = K_GetWaypointRouteState(waypoint);
+	}
+
+	K_InvalidateWaypointRoutes();
+}
+
+/*--------------------------------------------------
+	static void K_CheckWaypointRouteStates(void)
+
+		Invalidates the route tables if any waypoint changed since they were last checked. Waypoint mobjs can be
+		changed without going through K_SetWaypointIsEnabled (e.g. by Lua), so this looks at all of them, but only
+		once per tic.
+--------------------------------------------------*/
+static void K_CheckWaypointRouteStates(void)
+{
+	dboolean changed = false;
+
+	if (routestateschecked == true && routestatestic == leveltime)
+	{
+		return;
+	}
+
+	routestateschecked = true;
+	routestatestic = leveltime;
+
+	if (routestates.size() != numwaypoints)
+	{
+		routestates.resize(numwaypoints);
+		changed = true;
+	}
+
+	for (size_t i = 0U; i < numwaypoints; i++)
+	{
+		const waypointroutestate_t state = K_GetWaypointRouteState(&waypointheap[i]);
+		waypointroutestate_t &old = routestates[i];
+
+		if (state.flags != old.flags || state.x != old.x || state.y != old.y || state.z != old.z)
+		{
+			old = state;
+			changed = true;
+		}
+	}
+
+	if (changed == true)
+	{
+		K_InvalidateWaypointRoutes();
+	}
+}
+
+/*--------------------------------------------------
+	static void K_ClearWaypointRoutes(void)
+
+		Throws away all of the route tables, for when the waypoints are setup again.
+--------------------------------------------------*/
+static void K_ClearWaypointRoutes(void)
+{
+	routetables.clear();
+	routestates.clear();
+	routestateschecked = false;
+}
+
+/*--------------------------------------------------
+	static waypointroutetable_t *K_AddWaypointRouteTable(
+		waypoint_t *const destinationwaypoint,
+		const dboolean     useshortcuts,
+		const dboolean     huntbackwards,
+		const dboolean     pinned)
+
+		Gets an empty route table to a destination, reusing the least recently used one if there are too many.
+
+	Input Arguments:-
+		destinationwaypoint - The waypoint the routes go to
+		useshortcuts        - Whether the routes use waypoints that are marked as being shortcuts
+		huntbackwards       - Whether the routes go through the waypoints backwards
+		pinned              - Whether the table should never be reused
+
+	Return:-
+		The route table, with every entry unknown.
+--------------------------------------------------*/
+static waypointroutetable_t *K_AddWaypointRouteTable(
+	waypoint_t *const destinationwaypoint,
+	const dboolean     useshortcuts,
+	const dboolean     huntbackwards,
+	const dboolean     pinned)
+{
+	waypointroutetable_t *table = NULL;
+
+	if (routetables.size() < MAXROUTETABLES)
+	{
+		routetables.push_back({});
+		table = &routetables.back();
+	}
+	else
+	{
+		// Reuse the least recently used table. Entries are always what the search gives, so which one goes
+		// doesn't change any results.
+		for (waypointroutetable_t &it : routetables)
+		{
+			if (it.pinned == false && (table == NULL || it.lastused < table->lastused))
+			{
+				table = &it;
+			}
+		}
+
+		I_Assert(table != NULL);
+	}
+
+	table->destination   = destinationwaypoint;
+	table->useshortcuts  = useshortcuts;
+	table->huntbackwards = huntbackwards;
+	table->pinned        = pinned;
+	table->generation    = routegeneration;
+	table->lastused      = leveltime;
+	table->routes.clear();
+	table->routes.resize(numwaypoints, {ROUTE_UNKNOWN, ROUTE_UNKNOWN});
+
+	return table;
+}
+
+/*--------------------------------------------------
+	static const waypointroute_t *K_FillWaypointRoute(
+		waypointroutetable_t *const table,
+		waypoint_t *const           sourcewaypoint)
+
+		Gets the route from a waypoint in a route table, pathfinding it if it isn't known yet.
+
+	Input Arguments:-
+		table          - The route table to look in
+		sourcewaypoint - The waypoint to start from
+
+	Return:-
+		The route, nexthop is ROUTE_UNREACHABLE if no path was found.
+--------------------------------------------------*/
+static const waypointroute_t *K_FillWaypointRoute(
+	waypointroutetable_t *const table,
+	waypoint_t *const           sourcewaypoint)
+{
+	waypointroute_t &route = table->routes[K_GetWaypointHeapIndex(sourcewaypoint)];
+
+	if (route.nexthop == ROUTE_UNKNOWN)
+	{
+		path_t path = {0};
+
+		route.nexthop = ROUTE_UNREACHABLE;
+		route.distance = ROUTE_UNREACHABLE;
+
+		if (K_PathfindToWaypoint(sourcewaypoint, table->destination, &path, table->useshortcuts, table->huntbackwards) == true)
+		{
+			waypoint_t *nextwaypoint = NULL;
+
+			if (path.numnodes > 1)
+			{
+				nextwaypoint = (waypoint_t*)path.array[1].nodedata;
+			}
+			else
+			{
+				// Shouldn't happen, as this is the source waypoint.
+				CONS_Debug(DBG_GAMELOGIC, "Only one waypoint pathfound in K_FillWaypointRoute.\n");
+				nextwaypoint = (waypoint_t*)path.array[0].nodedata;
+			}
+
+			route.nexthop = (uint32_t)K_GetWaypointHeapIndex(nextwaypoint);
+			route.distance = path.totaldist;
+
+			Z_Free(path.array);
+		}
+	}
+
+	return &route;
+}
+
+/*--------------------------------------------------
+	static const waypointroute_t *K_GetWaypointRoute(
+		waypoint_t *const sourcewaypoint,
+		waypoint_t *const destinationwaypoint,
+		const dboolean     useshortcuts,
+		const dboolean     huntbackwards)
+
+		Gets the route from a waypoint to a destination, pathfinding it if it isn't cached. The waypoints need to
+		pass the same checks as K_PathfindToWaypoint.
+
+	Input Arguments:-
+		sourcewaypoint      - The waypoint to start from
+		destinationwaypoint - The waypoint the route goes to
+		useshortcuts        - Whether the route uses waypoints that are marked as being shortcuts
+		huntbackwards       - Whether the route goes through the waypoints backwards
+
+	Return:-
+		The route, nexthop is ROUTE_UNREACHABLE if no path was found.
+--------------------------------------------------*/
+static const waypointroute_t *K_GetWaypointRoute(
+	waypoint_t *const sourcewaypoint,
+	waypoint_t *const destinationwaypoint,
+	const dboolean     useshortcuts,
+	const dboolean     huntbackwards)
+{
+	waypointroutetable_t *table = NULL;
+
+	I_Assert(sourcewaypoint != NULL);
+	I_Assert(destinationwaypoint != NULL);
+
+	K_CheckWaypointRouteStates();
+
+	for (waypointroutetable_t &it : routetables)
+	{
+		if (it.destination == destinationwaypoint
+			&& it.useshortcuts == useshortcuts
+			&& it.huntbackwards == huntbackwards)
+		{
+			table = &it;
+			break;
+		}
+	}
+
+	if (table == NULL)
+	{
+		table = K_AddWaypointRouteTable(destinationwaypoint, useshortcuts, huntbackwards, false);
+	}
+	else if (table->generation != routegeneration)
+	{
+		table->generation = routegeneration;
+		table->routes.clear();
+		table->routes.resize(numwaypoints, {ROUTE_UNKNOWN, ROUTE_UNKNOWN});
+	}
+
+	table->lastused = leveltime;
+
+	return K_FillWaypointRoute(table, sourcewaypoint);
+}
+
+/*--------------------------------------------------
+	static void K_BuildWaypointRoutes(void)
+
+		Fills in the route tables to the finish line, with and without shortcuts, from every waypoint that can have
+		one. Every player and bot asks for these each tic.
+--------------------------------------------------*/
+static void K_BuildWaypointRoutes(void)
+{
+	K_ClearWaypointRoutes();
+	K_CheckWaypointRouteStates();
+
+	if (finishline == NULL || finishline->numprevwaypoints == 0)
+	{
+		return;
+	}
+
+	for (int shortcuts = 0; shortcuts < 2; shortcuts++)
+	{
+		waypointroutetable_t *table = K_AddWaypointRouteTable(finishline, (shortcuts == 1), false, true);
+
+		for (size_t i = 0U; i < numwaypoints; i++)
+		{
+			if (waypointheap[i].numnextwaypoints > 0)
+			{
+				K_FillWaypointRoute(table, &waypointheap[i]);
+			}
+		}
+	}
+}
+
+/*--------------------------------------------------
+	dboolean K_GetWaypointRouteDistance(
+		waypoint_t *const sourcewaypoint,
+		waypoint_t *const destinationwaypoint,
+		const dboolean     useshortcuts,
+		const dboolean     huntbackwards,
+		uint32_t *const    returndistance)
+
+		See header file for description.
+--------------------------------------------------*/
+dboolean K_GetWaypointRouteDistance(
+	waypoint_t *const sourcewaypoint,
+	waypoint_t *const destinationwaypoint,
+	const dboolean     useshortcuts,
+	const dboolean     huntbackwards,
+	uint32_t *const    returndistance)
+{
+	dboolean routefound = false;
+
+	if (sourcewaypoint == NULL)
+	{
+		CONS_Debug(DBG_GAMELOGIC, "NULL sourcewaypoint in K_GetWaypointRouteDistance.\n");
+	}
+	else if (destinationwaypoint == NULL)
+	{
+		CONS_Debug(DBG_GAMELOGIC, "NULL destinationwaypoint in K_GetWaypointRouteDistance.\n");
+	}
+	else if (returndistance == NULL)
+	{
+		CONS_Debug(DBG_GAMELOGIC, "NULL returndistance in K_GetWaypointRouteDistance.\n");
+	}
+	// Same requirements as K_PathfindToWaypoint, so the results match
+	else if (((huntbackwards == false) && (sourcewaypoint->numnextwaypoints == 0))
+		|| ((huntbackwards == true) && (sourcewaypoint->numprevwaypoints == 0)))
+	{
+		CONS_Debug(DBG_GAMELOGIC,
+			"K_GetWaypointRouteDistance: sourcewaypoint with ID %d has no next waypoint\n",
+			K_GetWaypointID(sourcewaypoint));
+	}
+	else if (((huntbackwards == false) && (destinationwaypoint->numprevwaypoints == 0))
+		|| ((huntbackwards == true) && (destinationwaypoint->numnextwaypoints == 0)))
+	{
+		CONS_Debug(DBG_GAMELOGIC,
+			"K_GetWaypointRouteDistance: destinationwaypoint with ID %d has no previous waypoint\n",
+			K_GetWaypointID(destinationwaypoint));
+	}
+	else
+	{
+		const waypointroute_t *route =
+			K_GetWaypointRoute(sourcewaypoint, destinationwaypoint, useshortcuts, huntbackwards);
+
+		if (route->nexthop != ROUTE_UNREACHABLE)
+		{
+			*returndistance = route->distance;
+			routefound = true;
+		}
+	}
+
+	return routefound;
+}
+
 /*--------------------------------------------------
 	waypoint_t *K_GetNextWaypointToDestination(
 		waypoint_t *const sourcewaypoint,
@@ -1608,58 +2411,13 @@ waypoint_t *K_GetNextWaypointToDestination(
 		}
 		else
 		{
-			path_t                     pathtowaypoint  = {0};
-			pathfindsetup_t            pathfindsetup   = {0};
-			dboolean                    pathfindsuccess = false;
-			getconnectednodesfunc      nextnodesfunc   = K_WaypointPathfindGetNext;
-			getnodeconnectioncostsfunc nodecostsfunc   = K_WaypointPathfindGetNextCosts;
-			getnodeheuristicfunc       heuristicfunc   = K_WaypointPathfindGetHeuristic;
-			getnodetraversablefunc     traversablefunc = K_WaypointPathfindTraversableNoShortcuts;
-			getpathfindfinishedfunc    finishedfunc    = K_WaypointPathfindReachedEnd;
-
-			if (huntbackwards)
-			{
-				nextnodesfunc = K_WaypointPathfindGetPrev;
-				nodecostsfunc = K_WaypointPathfindGetPrevCosts;
-			}
+			const waypointroute_t *route =
+				K_GetWaypointRoute(sourcewaypoint, destinationwaypoint, useshortcuts, huntbackwards);
 
-			if (useshortcuts)
-			{
-				traversablefunc = K_WaypointPathfindTraversableAllEnabled;
-			}
-
-			pathfindsetup.opensetcapacity    = K_GetOpensetBaseSize();
-			pathfindsetup.closedsetcapacity  = K_GetClosedsetBaseSize();
-			pathfindsetup.nodesarraycapacity = K_GetNodesArrayBaseSize();
-			pathfindsetup.startnodedata      = sourcewaypoint;
-			pathfindsetup.endnodedata        = destinationwaypoint;
-			pathfindsetup.getconnectednodes  = nextnodesfunc;
-			pathfindsetup.getconnectioncosts = nodecostsfunc;
-			pathfindsetup.getheuristic       = heuristicfunc;
-			pathfindsetup.gettraversable     = traversablefunc;
-			pathfindsetup.getfinished        = finishedfunc;
-
-			pathfindsuccess = K_PathfindAStar(&pathtowaypoint, &pathfindsetup);
-
-			K_UpdateOpensetBaseSize(pathfindsetup.opensetcapacity);
-			K_UpdateClosedsetBaseSize(pathfindsetup.closedsetcapacity);
-			K_UpdateNodesArrayBaseSize(pathfindsetup.nodesarraycapacity);
-
-			if (pathfindsuccess)
+			if (route->nexthop != ROUTE_UNREACHABLE)
 			{
 				// A direct path to the destination has been found.
-				if (pathtowaypoint.numnodes > 1)
-				{
-					nextwaypoint = (waypoint_t*)pathtowaypoint.array[1].nodedata;
-				}
-				else
-				{
-					// Shouldn't happen, as this is the source waypoint.
-					CONS_Debug(DBG_GAMELOGIC, "Only one waypoint pathfound in K_GetNextWaypointToDestination.\n");
-					nextwaypoint = (waypoint_t*)pathtowaypoint.array[0].nodedata;
-				}
-
-				Z_Free(pathtowaypoint.array);
+				nextwaypoint = &waypointheap[route->nexthop];
 			}
 			else
 			{
@@ -2808,6 +3566,12 @@ dboolean K_SetupWaypointList(void)
 					K_CalculateTrackComplexity();
 				}
 
+				// Every player looks for their closest waypoint every tic
+				K_BuildWaypointGrid();
+
+				// And how far they are from the finish line
+				K_BuildWaypointRoutes();
+
 				setupsuccessful = true;
 			}
 		}
@@ -2831,6 +3595,9 @@ void K_ClearWaypoints(void)
 	numwaypointmobjs = 0U;
 	circuitlength    = 0U;
 	trackcomplexity  = 0U;
+
+	K_ClearWaypointRoutes();
+	K_ClearWaypointGrid();
 }
 
 /*--------------------------------------------------
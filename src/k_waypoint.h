@@ -127,6 +127,16 @@ dboolean K_GetWaypointIsEnabled(waypoint_t *waypoint);
 
 void K_SetWaypointIsEnabled(waypoint_t *waypoint, dboolean enabled);
 
+
+/*--------------------------------------------------
+	void K_InvalidateWaypointRoutes(void)
+
+		Makes the cached routes between waypoints be pathfound again. Call this after changing whether
+		waypoints are enabled without going through K_SetWaypointIsEnabled.
+--------------------------------------------------*/
+
+void K_InvalidateWaypointRoutes(void);
+
 /*--------------------------------------------------
 	dboolean K_GetWaypointIsSpawnpoint(waypoint_t *waypoint)
 
@@ -369,6 +379,36 @@ waypoint_t *K_GetNextWaypointToDestination(
 	const dboolean     huntbackwards);
 
 
+/*--------------------------------------------------
+	dboolean K_GetWaypointRouteDistance(
+		waypoint_t *const sourcewaypoint,
+		waypoint_t *const destinationwaypoint,
+		const dboolean     useshortcuts,
+		const dboolean     huntbackwards,
+		uint32_t *const    returndistance)
+
+		Gets the totaldist of the path K_PathfindToWaypoint finds from the source waypoint to the destination
+		waypoint. The result is remembered until any waypoint is enabled, disabled or moved, so asking again is cheap.
+
+	Input Arguments:-
+		sourcewaypoint      - The waypoint to start from
+		destinationwaypoint - The waypoint to get to
+		useshortcuts        - Whether to use waypoints that are marked as being shortcuts
+		huntbackwards       - Goes through the waypoints backwards if true
+		returndistance      - The return location of the distance
+
+	Return:-
+		True if the destination can be reached from the source, false otherwise.
+--------------------------------------------------*/
+
+dboolean K_GetWaypointRouteDistance(
+	waypoint_t *const sourcewaypoint,
+	waypoint_t *const destinationwaypoint,
+	const dboolean     useshortcuts,
+	const dboolean     huntbackwards,
+	uint32_t *const    returndistance);
+
+
 /*--------------------------------------------------
 	waypoint_t *K_SearchWaypointGraphForMobj(mobj_t *const mobj)
 
@@ -0,0 +1,188 @@
+// DR. ROBOTNIK'S RING RACERS
+//-----------------------------------------------------------------------------
+// Copyright (C) 2025 by Kart Krew.
+//
+// This program is free software distributed under the
+// terms of the GNU General Public License, version 2.
+// See the 'LICENSE' file for more details.
+//-----------------------------------------------------------------------------
+/// \file  lua_alloc.c
+/// \brief Lua heap allocator
+///
+/// Nearly every allocation Lua makes is a string, table or
+/// closure of a few dozen bytes. Giving each one its own zone
+/// block costs a malloc and a zone header, so instead blocks up
+/// to ARENA_MAXSMALL bytes are rounded up to a size class and
+/// bump-allocated from big chunks. Freed blocks go onto the free
+/// list of their class and are reused; chunks are only returned
+/// when the state is closed.
+
+#include "doomdef.h"
+#include "z_zone.h"
+
+#include "lua_alloc.h"
+
+#define ARENA_GRANULE 16
+#define ARENA_MAXSMALL 256
+#define ARENA_NUMCLASSES (ARENA_MAXSMALL / ARENA_GRANULE)
+#define ARENA_CHUNKSIZE (64*1024)
+
+#define SIZECLASS(size) (((size) - 1) / ARENA_GRANULE)
+#define CLASSSIZE(cls) (((cls) + 1) * ARENA_GRANULE)
+
+typedef struct arenablock_s
+{
+	struct arenablock_s *next;
+} arenablock_t;
+
+// Padded so blocks keep the alignment of the zone allocation.
+typedef union arenachunk_u
+{
+	union arenachunk_u *next;
+	char pad[ARENA_GRANULE];
+} arenachunk_t;
+
+static struct
+{
+	arenablock_t *freelist[ARENA_NUMCLASSES];
+	arenachunk_t *chunks;
+	uint8_t *cursor, *end; // unused tail of the newest chunk
+} arena;
+
+lua_memstats_t lua_memstats;
+
+static void ArenaFree(void *ptr, size_t size)
+{
+	const size_t cls = SIZECLASS(size);
+	arenablock_t *block = ptr;
+
+	block->next = arena.freelist[cls];
+	arena.freelist[cls] = block;
+
+	lua_memstats.smallbytes -= CLASSSIZE(cls);
+}
+
+static void ArenaNewChunk(void)
+{
+	arenachunk_t *chunk;
+
+	// Don't waste what's left of the old chunk. Chunks and
+	// blocks are both multiples of the granule, so this
+	// always fits a class exactly.
+	if (arena.cursor < arena.end)
+	{
+		const size_t left = arena.end - arena.cursor;
+		arenablock_t *block = (arenablock_t *)arena.cursor;
+
+		block->next = arena.freelist[SIZECLASS(left)];
+		arena.freelist[SIZECLASS(left)] = block;
+	}
+
+	chunk = Z_Malloc(ARENA_CHUNKSIZE, PU_LUA, NULL);
+	chunk->next = arena.chunks;
+	arena.chunks = chunk;
+
+	arena.cursor = (uint8_t *)(chunk + 1);
+	arena.end = (uint8_t *)chunk + ARENA_CHUNKSIZE;
+
+	lua_memstats.arenabytes += ARENA_CHUNKSIZE;
+	lua_memstats.numchunks++;
+}
+
+static void *ArenaMalloc(size_t size)
+{
+	const size_t cls = SIZECLASS(size);
+	arenablock_t *block = arena.freelist[cls];
+
+	if (block != NULL)
+	{
+		arena.freelist[cls] = block->next;
+	}
+	else
+	{
+		if ((size_t)(arena.end - arena.cursor) < CLASSSIZE(cls))
+			ArenaNewChunk();
+
+		block = (arenablock_t *)arena.cursor;
+		arena.cursor += CLASSSIZE(cls);
+	}
+
+	lua_memstats.smallbytes += CLASSSIZE(cls);
+
+	return block;
+}
+
+static void *LargeMalloc(size_t size)
+{
+	lua_memstats.largebytes += size;
+	return Z_Malloc(size, PU_LUA, NULL);
+}
+
+static void LargeFree(void *ptr, size_t size)
+{
+	lua_memstats.largebytes -= size;
+	Z_Free(ptr);
+}
+
+// Lua always passes the size it asked for last time as osize,
+// so that alone tells which kind of block ptr is.
+void *LUA_ArenaAlloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+	void *block;
+
+	(void)ud;
+
+	if (nsize == 0)
+	{
+		if (osize > ARENA_MAXSMALL)
+			LargeFree(ptr, osize);
+		else if (osize != 0)
+			ArenaFree(ptr, osize);
+		return NULL;
+	}
+
+	if (osize > ARENA_MAXSMALL && nsize > ARENA_MAXSMALL)
+	{
+		lua_memstats.largebytes += nsize - osize;
+		return Z_Realloc(ptr, nsize, PU_LUA, NULL);
+	}
+
+	if (osize != 0 && osize <= ARENA_MAXSMALL && nsize <= ARENA_MAXSMALL
+		&& SIZECLASS(osize) == SIZECLASS(nsize))
+	{
+		return ptr;
+	}
+
+	if (nsize > ARENA_MAXSMALL)
+		block = LargeMalloc(nsize);
+	else
+		block = ArenaMalloc(nsize);
+
+	if (osize != 0)
+	{
+		M_Memcpy(block, ptr, min(osize, nsize));
+
+		if (osize > ARENA_MAXSMALL)
+			LargeFree(ptr, osize);
+		else
+			ArenaFree(ptr, osize);
+	}
+
+	return block;
+}
+
+void LUA_ResetArena(void)
+{
+	while (arena.chunks != NULL)
+	{
+		arenachunk_t *next = arena.chunks->next;
+		Z_Free(arena.chunks);
+		arena.chunks = next;
+	}
+
+	memset(&arena, 0, sizeof arena);
+
+	lua_memstats.smallbytes = 0;
+	lua_memstats.arenabytes = 0;
+	lua_memstats.numchunks = 0;
+}
@@ -0,0 +1,50 @@
+// DR. ROBOTNIK'S RING RACERS
+//-----------------------------------------------------------------------------
+// Copyright (C) 2025 by Kart Krew.
+//
+// This program is free software distributed under the
+// terms of the GNU General Public License, version 2.
+// See the 'LICENSE' file for more details.
+//-----------------------------------------------------------------------------
+/// \file  lua_alloc.h
+/// \brief Lua heap allocator
+
+#ifndef LUA_ALLOC_H
+#define LUA_ALLOC_H
+
+#include "doomtype.h"
+#include "typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lua_memstats_t
+{
+	size_t smallbytes; // in use by size-class blocks
+	size_t largebytes; // in use by blocks too big for the arena
+	size_t arenabytes; // reserved by arena chunks
+	uint32_t numchunks;
+
+	// Running totals, see LUA_Step
+	precise_t gctime;
+	uint32_t gcsteps;
+	uint32_t gccycles;
+};
+
+extern lua_memstats_t lua_memstats;
+
+// lua_Alloc for the main Lua state. Small blocks are served
+// from size-class free lists carved out of large chunks,
+// everything else goes through the zone.
+void *LUA_ArenaAlloc(void *ud, void *ptr, size_t osize, size_t nsize);
+
+// Release every arena chunk. Only call this once the state
+// using LUA_ArenaAlloc has been closed.
+void LUA_ResetArena(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif/*LUA_ALLOC_H*/
@@ -60,12 +60,14 @@ static const char *const botvars_opt[] = {
 	NULL
 };
 
+static int botvars_fields_ref = LUA_NOREF;
+
 #define UNIMPLEMENTED luaL_error(L, LUA_QL("botvars_t") " field " LUA_QS " is not implemented for Lua and cannot be accessed.", follower_opt[field])
 
 static int botvars_get(lua_State *L)
 {
 	botvars_t *botvars = *((botvars_t **)luaL_checkudata(L, 1, META_BOTVARS));
-	enum botvars field = luaL_checkoption(L, 2, NULL, botvars_opt);
+	enum botvars field = Lua_checkoption(L, 2, -1, botvars_fields_ref);
 
 	// This is a property that always exists in a player.
 	I_Assert(botvars != NULL);
@@ -135,7 +137,7 @@ static int botvars_get(lua_State *L)
 static int botvars_set(lua_State *L)
 {
 	botvars_t *botvars = *((botvars_t **)luaL_checkudata(L, 1, META_BOTVARS));
-	enum botvars field = luaL_checkoption(L, 2, botvars_opt[0], botvars_opt);
+	enum botvars field = Lua_checkoption(L, 2, 0, botvars_fields_ref);
 
 	// This is a property that always exists in a player.
 	I_Assert(botvars != NULL);
@@ -205,6 +207,8 @@ static int botvars_set(lua_State *L)
 
 int LUA_BotVarsLib(lua_State *L)
 {
+	botvars_fields_ref = Lua_CreateFieldTable(L, botvars_opt);
+
 	luaL_newmetatable(L, META_BOTVARS);
 		lua_pushcfunction(L, botvars_get);
 		lua_setfield(L, -2, "__index");
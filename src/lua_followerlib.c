@@ -84,12 +84,14 @@ static const char *const follower_opt[] = {
 	NULL
 };
 
+static int follower_fields_ref = LUA_NOREF;
+
 #define UNIMPLEMENTED luaL_error(L, LUA_QL("follower_t") " field " LUA_QS " is not implemented for Lua and cannot be accessed.", follower_opt[field])
 
 static int follower_get(lua_State *L)
 {
 	follower_t *follower = *((follower_t **)luaL_checkudata(L, 1, META_FOLLOWER));
-	enum follower field = luaL_checkoption(L, 2, NULL, follower_opt);
+	enum follower field = Lua_checkoption(L, 2, -1, follower_fields_ref);
 
 	// followers are always valid, only added, never removed
 	I_Assert(follower != NULL);
@@ -271,6 +273,8 @@ static int lib_numFollowers(lua_State *L)
 
 int LUA_FollowerLib(lua_State *L)
 {
+	follower_fields_ref = Lua_CreateFieldTable(L, follower_opt);
+
 	luaL_newmetatable(L, META_FOLLOWER);
 		lua_pushcfunction(L, follower_get);
 		lua_setfield(L, -2, "__index");
@@ -149,6 +149,8 @@ static const char *const grandprix_opt[] = {
 	NULL
 };
 
+static int grandprix_fields_ref = LUA_NOREF;
+
 static const char *const cup_opt[] = {
 	"valid",
 	"id",
@@ -170,6 +172,8 @@ static const char *const cup_opt[] = {
 	NULL
 };
 
+static int cup_fields_ref = LUA_NOREF;
+
 static const char *const gprank_opt[] = {
 	"valid",
 	"numplayers",
@@ -198,6 +202,8 @@ static const char *const gprank_opt[] = {
 	NULL
 };
 
+static int gprank_fields_ref = LUA_NOREF;
+
 static const char *const gprank_level_opt[] = {
 	"valid",
 	"id",
@@ -210,6 +216,8 @@ static const char *const gprank_level_opt[] = {
 	NULL
 };
 
+static int gprank_level_fields_ref = LUA_NOREF;
+
 static const char *const gprank_level_perplayer_opt[] = {
 	"valid",
 	"position",
@@ -221,6 +229,8 @@ static const char *const gprank_level_perplayer_opt[] = {
 	NULL
 };
 
+static int gprank_level_perplayer_fields_ref = LUA_NOREF;
+
 static const char *const roundcue_opt[] = {
 	"size",
 	"roundnum",
@@ -232,6 +242,8 @@ static const char *const roundcue_opt[] = {
 	NULL
 };
 
+static int roundcue_fields_ref = LUA_NOREF;
+
 static const char *const roundentry_opt[] = {
 	"valid",
 	"mapnum",
@@ -242,9 +254,11 @@ static const char *const roundentry_opt[] = {
 	NULL
 };
 
+static int roundentry_fields_ref = LUA_NOREF;
+
 static int grandprix_get(lua_State *L)
 {
-	enum grandprix field = luaL_checkoption(L, 2, grandprix_opt[0], grandprix_opt);
+	enum grandprix field = Lua_checkoption(L, 2, 0, grandprix_fields_ref);
 	
 	// Don't return any grandprixinfo values while not in a GP.
 	if (!grandprixinfo.gp)
@@ -307,7 +321,7 @@ static int grandprix_set(lua_State *L)
 static int cup_get(lua_State *L)
 {
 	cupheader_t *cup = *((cupheader_t **)luaL_checkudata(L, 1, META_CUP));
-	enum cup field = luaL_checkoption(L, 2, cup_opt[0], cup_opt);
+	enum cup field = Lua_checkoption(L, 2, 0, cup_fields_ref);
 	
 	if (!cup)
 	{
@@ -399,7 +413,7 @@ static int cup_set(lua_State *L)
 static int gprank_get(lua_State *L)
 {
 	gpRank_t *gprank = *((gpRank_t **)luaL_checkudata(L, 1, META_GPRANK));
-	enum gprank field = luaL_checkoption(L, 2, gprank_opt[0], gprank_opt);
+	enum gprank field = Lua_checkoption(L, 2, 0, gprank_fields_ref);
 	
 	if (!gprank)
 	{
@@ -507,7 +521,7 @@ static int gprank_set(lua_State *L)
 static int gprank_level_get(lua_State *L)
 {
 	gpRank_level_t *gprank_level = *((gpRank_level_t **)luaL_checkudata(L, 1, META_GPRANKLEVEL));
-	enum gprank_level field = luaL_checkoption(L, 2, gprank_level_opt[0], gprank_level_opt);
+	enum gprank_level field = Lua_checkoption(L, 2, 0, gprank_level_fields_ref);
 	
 	if (!gprank_level)
 	{
@@ -568,7 +582,7 @@ static int gprank_level_perplayer_get(lua_State *L)
 {
 	// "perplaya" to avoid shadowed declaration
 	gpRank_level_perplayer_t *gprank_level_perplaya = *((gpRank_level_perplayer_t **)luaL_checkudata(L, 1, META_GPRANKLEVELPERPLAYER));
-	enum gprank_level_perplayer field = luaL_checkoption(L, 2, gprank_level_perplayer_opt[0], gprank_level_perplayer_opt);
+	enum gprank_level_perplayer field = Lua_checkoption(L, 2, 0, gprank_level_perplayer_fields_ref);
 	
 	if (!gprank_level_perplaya)
 	{
@@ -619,7 +633,7 @@ static int gprank_level_perplayer_set(lua_State *L)
 
 static int roundcue_get(lua_State *L)
 {
-	enum roundcue field = luaL_checkoption(L, 2, roundcue_opt[0], roundcue_opt);
+	enum roundcue field = Lua_checkoption(L, 2, 0, roundcue_fields_ref);
 	
 	// Don't return any grandprixinfo values while not in a GP.
 	if (!roundqueue.size)
@@ -677,7 +691,7 @@ static int roundcue_set(lua_State *L)
 static int roundentry_get(lua_State *L)
 {
 	roundentry_t *roundentry = *((roundentry_t **)luaL_checkudata(L, 1, META_ROUNDENTRY));
-	enum roundentry field = luaL_checkoption(L, 2, roundentry_opt[0], roundentry_opt);
+	enum roundentry field = Lua_checkoption(L, 2, 0, roundentry_fields_ref);
 	
 	if (!roundentry)
 	{
@@ -894,6 +908,14 @@ static int lib_getCupheader(lua_State *L)
 
 int LUA_GrandPrixLib(lua_State *L)
 {
+	grandprix_fields_ref = Lua_CreateFieldTable(L, grandprix_opt);
+	cup_fields_ref = Lua_CreateFieldTable(L, cup_opt);
+	gprank_fields_ref = Lua_CreateFieldTable(L, gprank_opt);
+	gprank_level_fields_ref = Lua_CreateFieldTable(L, gprank_level_opt);
+	gprank_level_perplayer_fields_ref = Lua_CreateFieldTable(L, gprank_level_perplayer_opt);
+	roundcue_fields_ref = Lua_CreateFieldTable(L, roundcue_opt);
+	roundentry_fields_ref = Lua_CreateFieldTable(L, roundentry_opt);
+
 	lua_newuserdata(L, 0);
 		lua_createtable(L, 0, 2);
 			lua_pushcfunction(L, grandprix_get);
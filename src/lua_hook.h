@@ -117,6 +117,19 @@ ENUM (STRING_HOOK);
 
 #undef ENUM
 
+// Bit n of luamobjhooks[type] is set when any MOBJ_HOOK n is
+// registered for that type, or generically. Test this before
+// calling a mobj hook from a hot path.
+extern uint32_t luamobjhooks[NUMMOBJTYPES];
+
+#ifdef __cplusplus
+static_assert(MOBJ_HOOK(MAX) <= 32, "luamobjhooks has one bit per mobj hook");
+#else
+_Static_assert(MOBJ_HOOK(MAX) <= 32, "luamobjhooks has one bit per mobj hook");
+#endif
+
+#define LUA_MobjHookAvailable(type, hook) (luamobjhooks[(type)] & (1u << (hook)))
+
 /* dead simple, LUA_HOOK(GameQuit) */
 #define LUA_HOOK(type) LUA_HookVoid(HOOK(type))
 //#define LUA_HUDHOOK(type) LUA_HookHUD(HUD_HOOK(type))
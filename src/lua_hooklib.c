@@ -28,6 +28,7 @@
 
 #include "command.h"
 #include "m_perfstats.h"
+#include "m_benchtics.h"
 #include "d_netcmd.h" // for cv_perfstats
 #include "i_system.h" // I_GetPreciseTime
 
@@ -61,6 +62,10 @@ static hook_t hookIds[HOOK(MAX)];
 static hook_t hudHookIds[HUD_HOOK(MAX)];
 static hook_t mobjHookIds[NUMMOBJTYPES][MOBJ_HOOK(MAX)];
 
+// One bit per mobj hook, generic hooks included, so callers can skip
+// types nobody hooked without pushing any userdata.
+uint32_t luamobjhooks[NUMMOBJTYPES];
+
 // Lua tables are used to lookup string hook ids.
 static stringhook_t stringHooks[STRING_HOOK(MAX)];
 
@@ -75,11 +80,7 @@ static int errorRef;
 
 static dboolean mobj_hook_available(int hook_type, mobjtype_t mobj_type)
 {
-	return
-		(
-				mobjHookIds [MT_NULL] [hook_type].numHooks > 0 ||
-				mobjHookIds[mobj_type][hook_type].numHooks > 0
-		);
+	return LUA_MobjHookAvailable(mobj_type, hook_type) != 0;
 }
 
 static int hook_in_list
@@ -168,6 +169,17 @@ static void add_mobj_hook(lua_State *L, int hook_type)
 	luaL_argcheck(L, mobj_type < NUMMOBJTYPES, 3, "invalid mobjtype_t");
 
 	add_hook(&mobjHookIds[mobj_type][hook_type]);
+
+	if (mobj_type == MT_NULL)
+	{
+		mobjtype_t i;
+
+		// generic hooks run for every type
+		for (i = 0; i < NUMMOBJTYPES; ++i)
+			luamobjhooks[i] |= 1u << hook_type;
+	}
+	else
+		luamobjhooks[mobj_type] |= 1u << hook_type;
 }
 
 static void add_hud_hook(lua_State *L, int idx)
@@ -735,7 +747,7 @@ void LUA_HookThinkFrame(void)
 		{
 			get_hook(&hook, map->ids, k);
 
-			if (cv_perfstats.value == PS_THINKFRAME)
+			if (cv_perfstats.value == PS_THINKFRAME || M_BenchTicsActive())
 			{
 				lua_pushvalue(gL, -1);/* need the function again */
 				time_taken = I_GetPreciseTime();
@@ -743,7 +755,7 @@ void LUA_HookThinkFrame(void)
 
 			call_single_hook(&hook);
 
-			if (cv_perfstats.value == PS_THINKFRAME)
+			if (cv_perfstats.value == PS_THINKFRAME || M_BenchTicsActive())
 			{
 				lua_Debug ar;
 				time_taken = I_GetPreciseTime() - time_taken;
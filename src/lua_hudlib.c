@@ -80,6 +80,8 @@ static const char *const patch_opt[] = {
 	"topoffset",
 	NULL};
 
+static int patch_fields_ref = LUA_NOREF;
+
 // alignment types for v.drawString
 enum align {
 	align_left = 0,
@@ -157,6 +159,8 @@ static const char *const camera_opt[] = {
 	"pnum",
 	NULL};
 
+static int camera_fields_ref = LUA_NOREF;
+
 static int colormap_get(lua_State *L)
 {
 	const uint8_t *colormap = *((uint8_t **)luaL_checkudata(L, 1, META_COLORMAP));
@@ -170,7 +174,7 @@ static int colormap_get(lua_State *L)
 static int patch_get(lua_State *L)
 {
 	patch_t *patch = *((patch_t **)luaL_checkudata(L, 1, META_PATCH));
-	enum patch field = luaL_checkoption(L, 2, NULL, patch_opt);
+	enum patch field = Lua_checkoption(L, 2, -1, patch_fields_ref);
 
 	// patches are invalidated when switching renderers
 	if (!patch) {
@@ -210,7 +214,7 @@ static int patch_set(lua_State *L)
 static int camera_get(lua_State *L)
 {
 	camera_t *cam = *((camera_t **)luaL_checkudata(L, 1, META_CAMERA));
-	enum cameraf field = luaL_checkoption(L, 2, NULL, camera_opt);
+	enum cameraf field = Lua_checkoption(L, 2, -1, camera_fields_ref);
 
 	// cameras should always be valid unless I'm a nutter
 	I_Assert(cam != NULL);
@@ -1251,6 +1255,9 @@ static luaL_Reg lib_hud[] = {
 
 int LUA_HudLib(lua_State *L)
 {
+	patch_fields_ref = Lua_CreateFieldTable(L, patch_opt);
+	camera_fields_ref = Lua_CreateFieldTable(L, camera_opt);
+
 	memset(hud_enabled, 0xff, (hud_MAX/8)+1);
 
 	lua_newtable(L);
@@ -59,6 +59,8 @@ const char *const sfxinfo_ropt[] = {
 	"string",
 	NULL};
 
+static int sfxinfo_read_fields_ref = LUA_NOREF;
+
 enum sfxinfo_write {
 	sfxinfow_singular = 0,
 	sfxinfow_priority,
@@ -74,6 +76,8 @@ const char *const sfxinfo_wopt[] = {
 	"caption",
 	NULL};
 
+static int sfxinfo_write_fields_ref = LUA_NOREF;
+
 dboolean actionsoverridden[NUMACTIONS] = {false};
 
 //
@@ -470,19 +474,35 @@ static int lib_spriteinfolen(lua_State *L)
 }
 
 // spriteinfo_t
+enum spriteinfo_e {
+	spriteinfo_pivot = 0,
+	spriteinfo_brightmap,
+};
+
+static const char *const spriteinfo_opt[] = {
+	"pivot",
+	"brightmap",
+	NULL};
+
+static int spriteinfo_fields_ref = LUA_NOREF;
+
 static int spriteinfo_get(lua_State *L)
 {
 	const char *field = luaL_checkstring(L, 2);
+	enum spriteinfo_e fieldid = Lua_optoption(L, 2, -1, spriteinfo_fields_ref);
 
 	luaL_checkudata(L, 1, META_SPRITEINFO);
 
+	switch (fieldid)
+	{
 	// push spriteframepivot_t userdata
-	if (fastcmp(field, "pivot"))
+	case spriteinfo_pivot:
 		return PushCast(L, META_PIVOTLIST);
-	else if (fastcmp(field, "brightmap"))
+	case spriteinfo_brightmap:
 		return PushCast(L, META_SPRITEBRIGHTLIST);
-	else
+	default:
 		return luaL_error(L, LUA_QL("spriteinfo_t") " has no field named " LUA_QS, field);
+	}
 
 	return 0;
 }
@@ -491,6 +511,7 @@ static int spriteinfo_set(lua_State *L)
 {
 	spriteinfo_t *sprinfo = *((spriteinfo_t **)luaL_checkudata(L, 1, META_SPRITEINFO));
 	const char *field = luaL_checkstring(L, 2);
+	enum spriteinfo_e fieldid = Lua_optoption(L, 2, -1, spriteinfo_fields_ref);
 
 	if (!lua_lumploading)
 		return luaL_error(L, "Do not alter spriteinfo_t from within a hook or coroutine!");
@@ -505,7 +526,7 @@ static int spriteinfo_set(lua_State *L)
 	lua_remove(L, 1); // remove field
 	lua_settop(L, 1); // leave only one value
 
-	if (fastcmp(field, "pivot"))
+	if (fieldid == spriteinfo_pivot)
 	{
 		// pivot[] is a table
 		if (lua_istable(L, 1))
@@ -590,20 +611,38 @@ static int pivotlist_num(lua_State *L)
 	return 1;
 }
 
+enum framepivot_e {
+	framepivot_x = 0,
+	framepivot_y,
+};
+
+static const char *const framepivot_opt[] = {
+	"x",
+	"y",
+	NULL};
+
+static int framepivot_fields_ref = LUA_NOREF;
+
 static int framepivot_get(lua_State *L)
 {
 	struct PivotFrame *container = luaL_checkudata(L, 1, META_FRAMEPIVOT);
 	spriteframepivot_t *framepivot = &container->sprinfo->pivot[container->frame];
 	const char *field = luaL_checkstring(L, 2);
+	enum framepivot_e fieldid = Lua_optoption(L, 2, -1, framepivot_fields_ref);
 
 	I_Assert(framepivot != NULL);
 
-	if (fastcmp("x", field))
+	switch (fieldid)
+	{
+	case framepivot_x:
 		lua_pushinteger(L, framepivot->x);
-	else if (fastcmp("y", field))
+		break;
+	case framepivot_y:
 		lua_pushinteger(L, framepivot->y);
-	else
+		break;
+	default:
 		return luaL_error(L, va("Field %s does not exist in spriteframepivot_t", field));
+	}
 
 	return 1;
 }
@@ -614,6 +653,7 @@ static int framepivot_set(lua_State *L)
 	spriteframepivot_t *framepivot = &container->sprinfo->pivot[container->frame];
 	uint8_t *available = container->sprinfo->available;
 	const char *field = luaL_checkstring(L, 2);
+	enum framepivot_e fieldid = Lua_optoption(L, 2, -1, framepivot_fields_ref);
 
 	if (!lua_lumploading)
 		return luaL_error(L, "Do not alter spriteframepivot_t from within a hook or coroutine!");
@@ -624,18 +664,19 @@ static int framepivot_set(lua_State *L)
 
 	I_Assert(framepivot != NULL);
 
-	if (fastcmp("x", field))
+	switch (fieldid)
 	{
+	case framepivot_x:
 		framepivot->x = luaL_checkinteger(L, 3);
 		set_bit_array(available, container->frame);
-	}
-	else if (fastcmp("y", field))
-	{
+		break;
+	case framepivot_y:
 		framepivot->y = luaL_checkinteger(L, 3);
 		set_bit_array(available, container->frame);
-	}
-	else
+		break;
+	default:
 		return luaL_error(L, va("Field %s does not exist in spriteframepivot_t", field));
+	}
 
 	return 0;
 }
@@ -918,19 +959,52 @@ dboolean LUA_CallAction(enum actionnum actionnum, mobj_t *actor)
 }
 
 // state_t *, field -> number
+enum state_e {
+	state_sprite = 0,
+	state_frame,
+	state_tics,
+	state_action,
+	state_actionname,
+	state_var1,
+	state_var2,
+	state_nextstate,
+	state_string,
+};
+
+static const char *const state_opt[] = {
+	"sprite",
+	"frame",
+	"tics",
+	"action",
+	"actionname",
+	"var1",
+	"var2",
+	"nextstate",
+	"string",
+	NULL};
+
+static int state_fields_ref = LUA_NOREF;
+
 static int state_get(lua_State *L)
 {
 	state_t *st = *((state_t **)luaL_checkudata(L, 1, META_STATE));
 	const char *field = luaL_checkstring(L, 2);
+	enum state_e fieldid = Lua_optoption(L, 2, -1, state_fields_ref);
 	lua_Integer number;
 
-	if (fastcmp(field,"sprite"))
+	switch (fieldid)
+	{
+	case state_sprite:
 		number = st->sprite;
-	else if (fastcmp(field,"frame"))
+		break;
+	case state_frame:
 		number = st->frame;
-	else if (fastcmp(field,"tics"))
+		break;
+	case state_tics:
 		number = st->tics;
-	else if (fastcmp(field,"action")) {
+		break;
+	case state_action:
+	{
 		const char *name;
 		if (!st->action.acp1) // Action is NULL.
 			return 0; // return nil.
@@ -949,8 +1023,9 @@ static int state_get(lua_State *L)
 		// because the metatable will trigger.
 		lua_getglobal(L, name); // actually gets from LREG_ACTIONS if applicable, and pushes a META_ACTION userdata if not.
 		return 1; // return just the function
+	}
 #ifdef DEVELOP
-	} else if (fastcmp(field,"actionname")) {
+	case state_actionname:
 		if (!st->action.acp1) { // Action is NULL.
 			lua_pushstring(L, "NULL");
 		} else if (st->action.acp1 == (actionf_p1)A_Lua) { // This is a Lua function?
@@ -971,13 +1046,16 @@ static int state_get(lua_State *L)
 		}
 		return 1;
 #endif
-	} else if (fastcmp(field,"var1"))
+	case state_var1:
 		number = st->var1;
-	else if (fastcmp(field,"var2"))
+		break;
+	case state_var2:
 		number = st->var2;
-	else if (fastcmp(field,"nextstate"))
+		break;
+	case state_nextstate:
 		number = st->nextstate;
-	else if (fastcmp(field,"string"))
+		break;
+	case state_string:
 	{
 		statenum_t id = st-states;
 		if (id < S_FIRSTFREESLOT)
@@ -995,10 +1073,11 @@ static int state_get(lua_State *L)
 
 		return 0;
 	}
-	else if (devparm)
-		return luaL_error(L, LUA_QL("state_t") " has no field named " LUA_QS, field);
-	else
+	default:
+		if (devparm)
+			return luaL_error(L, LUA_QL("state_t") " has no field named " LUA_QS, field);
 		return 0;
+	}
 
 	lua_pushinteger(L, number);
 	return 1;
@@ -1009,6 +1088,7 @@ static int state_set(lua_State *L)
 {
 	state_t *st = *((state_t **)luaL_checkudata(L, 1, META_STATE));
 	const char *field = luaL_checkstring(L, 2);
+	enum state_e fieldid = Lua_optoption(L, 2, -1, state_fields_ref);
 	lua_Integer value;
 
 	if (hud_running)
@@ -1016,16 +1096,21 @@ static int state_set(lua_State *L)
 	if (hook_cmd_running)
 		return luaL_error(L, "Do not alter states in CMD building code!");
 
-	if (fastcmp(field,"sprite")) {
+	switch (fieldid)
+	{
+	case state_sprite:
 		value = luaL_checknumber(L, 3);
 		if (value < SPR_NULL || value >= NUMSPRITES)
 			return luaL_error(L, "sprite number %d is invalid.", value);
 		st->sprite = (spritenum_t)value;
-	} else if (fastcmp(field,"frame"))
+		break;
+	case state_frame:
 		st->frame = (uint32_t)luaL_checknumber(L, 3);
-	else if (fastcmp(field,"tics"))
+		break;
+	case state_tics:
 		st->tics = (int32_t)luaL_checknumber(L, 3);
-	else if (fastcmp(field,"action")) {
+		break;
+	case state_action:
 		switch(lua_type(L, 3))
 		{
 		case LUA_TNIL: // Null? Set the action to nothing, then.
@@ -1058,17 +1143,22 @@ static int state_set(lua_State *L)
 		default: // ?!
 			return luaL_typerror(L, 3, "function");
 		}
-	} else if (fastcmp(field,"var1"))
+		break;
+	case state_var1:
 		st->var1 = (int32_t)luaL_checknumber(L, 3);
-	else if (fastcmp(field,"var2"))
+		break;
+	case state_var2:
 		st->var2 = (int32_t)luaL_checknumber(L, 3);
-	else if (fastcmp(field,"nextstate")) {
+		break;
+	case state_nextstate:
 		value = luaL_checkinteger(L, 3);
 		if (value < S_NULL || value >= NUMSTATES)
 			return luaL_error(L, "nextstate number %d is invalid.", value);
 		st->nextstate = (statenum_t)value;
-	} else
+		break;
+	default:
 		return luaL_error(L, LUA_QL("state_t") " has no field named " LUA_QS, field);
+	}
 
 	return 0;
 }
@@ -1204,63 +1294,149 @@ static int lib_mobjinfolen(lua_State *L)
 }
 
 // mobjinfo_t *, field -> number
+enum mobjinfo_e {
+	mobjinfo_doomednum = 0,
+	mobjinfo_spawnstate,
+	mobjinfo_spawnhealth,
+	mobjinfo_seestate,
+	mobjinfo_seesound,
+	mobjinfo_reactiontime,
+	mobjinfo_attacksound,
+	mobjinfo_painstate,
+	mobjinfo_painchance,
+	mobjinfo_painsound,
+	mobjinfo_meleestate,
+	mobjinfo_missilestate,
+	mobjinfo_deathstate,
+	mobjinfo_xdeathstate,
+	mobjinfo_deathsound,
+	mobjinfo_speed,
+	mobjinfo_radius,
+	mobjinfo_height,
+	mobjinfo_dispoffset,
+	mobjinfo_mass,
+	mobjinfo_damage,
+	mobjinfo_activesound,
+	mobjinfo_flags,
+	mobjinfo_raisestate,
+	mobjinfo_string,
+};
+
+static const char *const mobjinfo_opt[] = {
+	"doomednum",
+	"spawnstate",
+	"spawnhealth",
+	"seestate",
+	"seesound",
+	"reactiontime",
+	"attacksound",
+	"painstate",
+	"painchance",
+	"painsound",
+	"meleestate",
+	"missilestate",
+	"deathstate",
+	"xdeathstate",
+	"deathsound",
+	"speed",
+	"radius",
+	"height",
+	"dispoffset",
+	"mass",
+	"damage",
+	"activesound",
+	"flags",
+	"raisestate",
+	"string",
+	NULL};
+
+static int mobjinfo_fields_ref = LUA_NOREF;
+
 static int mobjinfo_get(lua_State *L)
 {
 	mobjinfo_t *info = *((mobjinfo_t **)luaL_checkudata(L, 1, META_MOBJINFO));
 	const char *field = luaL_checkstring(L, 2);
+	enum mobjinfo_e fieldid = Lua_optoption(L, 2, -1, mobjinfo_fields_ref);
 
 	I_Assert(info != NULL);
 	I_Assert(info >= mobjinfo);
 
-	if (fastcmp(field,"doomednum"))
+	switch (fieldid)
+	{
+	case mobjinfo_doomednum:
 		lua_pushinteger(L, info->doomednum);
-	else if (fastcmp(field,"spawnstate"))
+		break;
+	case mobjinfo_spawnstate:
 		lua_pushinteger(L, info->spawnstate);
-	else if (fastcmp(field,"spawnhealth"))
+		break;
+	case mobjinfo_spawnhealth:
 		lua_pushinteger(L, info->spawnhealth);
-	else if (fastcmp(field,"seestate"))
+		break;
+	case mobjinfo_seestate:
 		lua_pushinteger(L, info->seestate);
-	else if (fastcmp(field,"seesound"))
+		break;
+	case mobjinfo_seesound:
 		lua_pushinteger(L, info->seesound);
-	else if (fastcmp(field,"reactiontime"))
+		break;
+	case mobjinfo_reactiontime:
 		lua_pushinteger(L, info->reactiontime);
-	else if (fastcmp(field,"attacksound"))
+		break;
+	case mobjinfo_attacksound:
 		lua_pushinteger(L, info->attacksound);
-	else if (fastcmp(field,"painstate"))
+		break;
+	case mobjinfo_painstate:
 		lua_pushinteger(L, info->painstate);
-	else if (fastcmp(field,"painchance"))
+		break;
+	case mobjinfo_painchance:
 		lua_pushinteger(L, info->painchance);
-	else if (fastcmp(field,"painsound"))
+		break;
+	case mobjinfo_painsound:
 		lua_pushinteger(L, info->painsound);
-	else if (fastcmp(field,"meleestate"))
+		break;
+	case mobjinfo_meleestate:
 		lua_pushinteger(L, info->meleestate);
-	else if (fastcmp(field,"missilestate"))
+		break;
+	case mobjinfo_missilestate:
 		lua_pushinteger(L, info->missilestate);
-	else if (fastcmp(field,"deathstate"))
+		break;
+	case mobjinfo_deathstate:
 		lua_pushinteger(L, info->deathstate);
-	else if (fastcmp(field,"xdeathstate"))
+		break;
+	case mobjinfo_xdeathstate:
 		lua_pushinteger(L, info->xdeathstate);
-	else if (fastcmp(field,"deathsound"))
+		break;
+	case mobjinfo_deathsound:
 		lua_pushinteger(L, info->deathsound);
-	else if (fastcmp(field,"speed"))
+		break;
+	case mobjinfo_speed:
 		lua_pushinteger(L, info->speed); // sometimes it's fixed_t, sometimes it's not...
-	else if (fastcmp(field,"radius"))
+		break;
+	case mobjinfo_radius:
 		lua_pushfixed(L, info->radius);
-	else if (fastcmp(field,"height"))
+		break;
+	case mobjinfo_height:
 		lua_pushfixed(L, info->height);
-	else if (fastcmp(field,"dispoffset"))
+		break;
+	case mobjinfo_dispoffset:
 		lua_pushinteger(L, info->dispoffset);
-	else if (fastcmp(field,"mass"))
+		break;
+	case mobjinfo_mass:
 		lua_pushinteger(L, info->mass);
-	else if (fastcmp(field,"damage"))
+		break;
+	case mobjinfo_damage:
 		lua_pushinteger(L, info->damage);
-	else if (fastcmp(field,"activesound"))
+		break;
+	case mobjinfo_activesound:
 		lua_pushinteger(L, info->activesound);
-	else if (fastcmp(field,"flags"))
+		break;
+	case mobjinfo_flags:
 		lua_pushinteger(L, info->flags);
-	else if (fastcmp(field,"raisestate"))
+		break;
+	case mobjinfo_raisestate:
 		lua_pushinteger(L, info->raisestate);
-	else if (fastcmp(field,"string")) {
+		break;
+	case mobjinfo_string:
+	{
 		mobjtype_t id = info-mobjinfo;
 		if (id < MT_FIRSTFREESLOT)
 		{
@@ -1277,7 +1453,7 @@ static int mobjinfo_get(lua_State *L)
 
 		return 0;
 	}
-	else {
+	default: // extra custom variables in Lua memory
 		lua_getfield(L, LUA_REGISTRYINDEX, LREG_EXTVARS);
 		I_Assert(lua_istable(L, -1));
 		lua_pushlightuserdata(L, info);
@@ -1289,6 +1465,7 @@ static int mobjinfo_get(lua_State *L)
 		lua_getfield(L, -1, field);
 		if (lua_isnil(L, -1)) // no value for this field
 			CONS_Debug(DBG_LUA, M_GetText("'%s' has no field named '%s'; returning nil.\n"), "mobjinfo_t", field);
+		break;
 	}
 	return 1;
 }
@@ -1298,6 +1475,7 @@ static int mobjinfo_set(lua_State *L)
 {
 	mobjinfo_t *info = *((mobjinfo_t **)luaL_checkudata(L, 1, META_MOBJINFO));
 	const char *field = luaL_checkstring(L, 2);
+	enum mobjinfo_e fieldid = Lua_optoption(L, 2, -1, mobjinfo_fields_ref);
 
 	if (hud_running)
 		return luaL_error(L, "Do not alter mobjinfo in HUD rendering code!");
@@ -1307,57 +1485,83 @@ static int mobjinfo_set(lua_State *L)
 	I_Assert(info != NULL);
 	I_Assert(info >= mobjinfo);
 
-	if (fastcmp(field,"doomednum"))
+	switch (fieldid)
+	{
+	case mobjinfo_doomednum:
 		info->doomednum = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spawnstate"))
+		break;
+	case mobjinfo_spawnstate:
 		info->spawnstate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spawnhealth"))
+		break;
+	case mobjinfo_spawnhealth:
 		info->spawnhealth = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seestate"))
+		break;
+	case mobjinfo_seestate:
 		info->seestate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seesound"))
+		break;
+	case mobjinfo_seesound:
 		info->seesound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"reactiontime"))
+		break;
+	case mobjinfo_reactiontime:
 		info->reactiontime = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"attacksound"))
+		break;
+	case mobjinfo_attacksound:
 		info->attacksound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"painstate"))
+		break;
+	case mobjinfo_painstate:
 		info->painstate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"painchance"))
+		break;
+	case mobjinfo_painchance:
 		info->painchance = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"painsound"))
+		break;
+	case mobjinfo_painsound:
 		info->painsound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"meleestate"))
+		break;
+	case mobjinfo_meleestate:
 		info->meleestate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"missilestate"))
+		break;
+	case mobjinfo_missilestate:
 		info->missilestate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"deathstate"))
+		break;
+	case mobjinfo_deathstate:
 		info->deathstate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"xdeathstate"))
+		break;
+	case mobjinfo_xdeathstate:
 		info->xdeathstate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"deathsound"))
+		break;
+	case mobjinfo_deathsound:
 		info->deathsound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"speed"))
+		break;
+	case mobjinfo_speed:
 		info->speed = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"radius"))
+		break;
+	case mobjinfo_radius:
 		info->radius = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"height"))
+		break;
+	case mobjinfo_height:
 		info->height = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"dispoffset"))
+		break;
+	case mobjinfo_dispoffset:
 		info->dispoffset = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"mass"))
+		break;
+	case mobjinfo_mass:
 		info->mass = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"damage"))
+		break;
+	case mobjinfo_damage:
 		info->damage = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"activesound"))
+		break;
+	case mobjinfo_activesound:
 		info->activesound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flags"))
+		break;
+	case mobjinfo_flags:
 		info->flags = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"raisestate"))
+		break;
+	case mobjinfo_raisestate:
 		info->raisestate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"string"))
+		break;
+	case mobjinfo_string:
 		return luaL_error(L, LUA_QL("mobjinfo_t") " field " LUA_QS " should not be set directly.", field);
-	else {
+	default: // extra custom variables in Lua memory
 		lua_getfield(L, LUA_REGISTRYINDEX, LREG_EXTVARS);
 		I_Assert(lua_istable(L, -1));
 		lua_pushlightuserdata(L, info);
@@ -1374,6 +1578,7 @@ static int mobjinfo_set(lua_State *L)
 		lua_pushvalue(L, 3); // value to store
 		lua_setfield(L, -2, field);
 		lua_pop(L, 2);
+		break;
 	}
 	//else
 		//return luaL_error(L, LUA_QL("mobjinfo_t") " has no field named " LUA_QS, field);
@@ -1437,7 +1642,7 @@ static int lib_setSfxInfo(lua_State *L)
 		if (lua_isnumber(L, 2))
 			i = lua_tointeger(L, 2) - 1; // lua is one based, this enum is zero based.
 		else
-			i = luaL_checkoption(L, 2, NULL, sfxinfo_wopt);
+			i = Lua_checkoption(L, 2, -1, sfxinfo_write_fields_ref);
 
 		switch(i)
 		{
@@ -1475,7 +1680,7 @@ static int lib_sfxlen(lua_State *L)
 static int sfxinfo_get(lua_State *L)
 {
 	sfxinfo_t *sfx = *((sfxinfo_t **)luaL_checkudata(L, 1, META_SFXINFO));
-	enum sfxinfo_read field = luaL_checkoption(L, 2, NULL, sfxinfo_ropt);
+	enum sfxinfo_read field = Lua_checkoption(L, 2, -1, sfxinfo_read_fields_ref);
 
 	I_Assert(sfx != NULL);
 
@@ -1516,7 +1721,7 @@ static int sfxinfo_get(lua_State *L)
 static int sfxinfo_set(lua_State *L)
 {
 	sfxinfo_t *sfx = *((sfxinfo_t **)luaL_checkudata(L, 1, META_SFXINFO));
-	enum sfxinfo_write field = luaL_checkoption(L, 2, NULL, sfxinfo_wopt);
+	enum sfxinfo_write field = Lua_checkoption(L, 2, -1, sfxinfo_write_fields_ref);
 
 	if (hud_running)
 		return luaL_error(L, "Do not alter S_sfx in HUD rendering code!");
@@ -1744,27 +1949,56 @@ static int lib_skincolorslen(lua_State *L)
 }
 
 // skincolor_t *, field -> number
+enum skincolor_e {
+	skincolor_name = 0,
+	skincolor_ramp,
+	skincolor_invcolor,
+	skincolor_invshade,
+	skincolor_chatcolor,
+	skincolor_accessible,
+};
+
+static const char *const skincolor_opt[] = {
+	"name",
+	"ramp",
+	"invcolor",
+	"invshade",
+	"chatcolor",
+	"accessible",
+	NULL};
+
+static int skincolor_fields_ref = LUA_NOREF;
+
 static int skincolor_get(lua_State *L)
 {
 	skincolor_t *info = *((skincolor_t **)luaL_checkudata(L, 1, META_SKINCOLOR));
 	const char *field = luaL_checkstring(L, 2);
+	enum skincolor_e fieldid = Lua_optoption(L, 2, -1, skincolor_fields_ref);
 
 	I_Assert(info != NULL);
 	I_Assert(info >= skincolors);
 
-	if (fastcmp(field,"name"))
+	switch (fieldid)
+	{
+	case skincolor_name:
 		lua_pushstring(L, info->name);
-	else if (fastcmp(field,"ramp"))
+		break;
+	case skincolor_ramp:
 		LUA_PushUserdata(L, info->ramp, META_COLORRAMP);
-	else if (fastcmp(field,"invcolor"))
+		break;
+	case skincolor_invcolor:
 		lua_pushinteger(L, info->invcolor);
-	else if (fastcmp(field,"invshade"))
+		break;
+	case skincolor_invshade:
 		lua_pushinteger(L, info->invshade);
-	else if (fastcmp(field,"chatcolor"))
+		break;
+	case skincolor_chatcolor:
 		lua_pushinteger(L, info->chatcolor);
-	else if (fastcmp(field,"accessible"))
+		break;
+	case skincolor_accessible:
 		lua_pushboolean(L, info->accessible);
-	else {
+		break;
+	default:
 		CONS_Debug(DBG_LUA, M_GetText("'%s' has no field named '%s'; returning nil.\n"), "skincolor_t", field);
 		return 0;
 	}
@@ -1777,6 +2011,7 @@ static int skincolor_set(lua_State *L)
 	uint32_t i;
 	skincolor_t *info = *((skincolor_t **)luaL_checkudata(L, 1, META_SKINCOLOR));
 	const char *field = luaL_checkstring(L, 2);
+	enum skincolor_e fieldid = Lua_optoption(L, 2, -1, skincolor_fields_ref);
 	uint16_t cnum = (uint16_t)(info-skincolors);
 
 	I_Assert(info != NULL);
@@ -1785,7 +2020,10 @@ static int skincolor_set(lua_State *L)
 	if (!cnum || cnum >= numskincolors)
 		return luaL_error(L, "skincolors[] index %d out of range (1 - %d)", cnum, numskincolors-1);
 
-	if (fastcmp(field,"name")) {
+	switch (fieldid)
+	{
+	case skincolor_name:
+	{
 		const char* n = luaL_checkstring(L, 3);
 		strlcpy(info->name, n, MAXCOLORNAME+1);
 		if (strlen(n) > MAXCOLORNAME)
@@ -1801,7 +2039,9 @@ static int skincolor_set(lua_State *L)
 			if (!stricmp(info->name, skincolors[SKINCOLOR_NONE].name) || (dupecheck && (dupecheck != cnum)))
 				CONS_Alert(CONS_WARNING, "skincolor_t field 'name' ('%s') is a duplicate of another skincolor's name.\n", info->name);
 		}
-	} else if (fastcmp(field,"ramp")) {
+		break;
+	}
+	case skincolor_ramp:
 		if (!lua_istable(L, 3) && luaL_checkudata(L, 3, META_COLORRAMP) == NULL)
 			return luaL_error(L, LUA_QL("skincolor_t") " field 'ramp' must be a table or array.");
 		else if (lua_istable(L, 3))
@@ -1810,23 +2050,34 @@ static int skincolor_set(lua_State *L)
 			for (i=0; i<COLORRAMPSIZE; i++)
 				info->ramp[i] = (*((uint8_t **)luaL_checkudata(L, 3, META_COLORRAMP)))[i];
 		skincolor_modified[cnum] = true;
-	} else if (fastcmp(field,"invcolor")) {
+		break;
+	case skincolor_invcolor:
+	{
 		uint16_t v = (uint16_t)luaL_checkinteger(L, 3);
 		if (v >= numskincolors)
 			return luaL_error(L, "skincolor_t field 'invcolor' out of range (1 - %d)", numskincolors-1);
 		info->invcolor = v;
-	} else if (fastcmp(field,"invshade"))
+		break;
+	}
+	case skincolor_invshade:
 		info->invshade = (uint8_t)luaL_checkinteger(L, 3)%COLORRAMPSIZE;
-	else if (fastcmp(field,"chatcolor"))
+		break;
+	case skincolor_chatcolor:
 		info->chatcolor = (uint16_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"accessible")) {
+		break;
+	case skincolor_accessible:
+	{
 		dboolean v = lua_toboolean(L, 3);
 		if (cnum < FIRSTSUPERCOLOR && v != skincolors[cnum].accessible)
 			return luaL_error(L, "skincolors[] index %d is a standard color; accessibility changes are prohibited.", cnum);
 		else
 			info->accessible = v;
-	} else
+		break;
+	}
+	default:
 		CONS_Debug(DBG_LUA, M_GetText("'%s' has no field named '%s'; returning nil.\n"), "skincolor_t", field);
+		break;
+	}
 	return 1;
 }
 
@@ -2032,6 +2283,14 @@ static int precipprops_num(lua_State *L)
 //
 int LUA_InfoLib(lua_State *L)
 {
+	spriteinfo_fields_ref = Lua_CreateFieldTable(L, spriteinfo_opt);
+	framepivot_fields_ref = Lua_CreateFieldTable(L, framepivot_opt);
+	state_fields_ref = Lua_CreateFieldTable(L, state_opt);
+	skincolor_fields_ref = Lua_CreateFieldTable(L, skincolor_opt);
+	mobjinfo_fields_ref = Lua_CreateFieldTable(L, mobjinfo_opt);
+	sfxinfo_write_fields_ref = Lua_CreateFieldTable(L, sfxinfo_wopt);
+	sfxinfo_read_fields_ref = Lua_CreateFieldTable(L, sfxinfo_ropt);
+
 	// index of A_Lua actions to run for each state
 	lua_newtable(L);
 	lua_setfield(L, LUA_REGISTRYINDEX, LREG_STATEACTION);
@@ -70,10 +70,12 @@ static const char *const itemroulette_opt[] = {
 	NULL
 };
 
+static int itemroulette_fields_ref = LUA_NOREF;
+
 static int itemroulette_get(lua_State *L)
 {
 	itemroulette_t *itemroulette = *((itemroulette_t **)luaL_checkudata(L, 1, META_ITEMROULETTE));
-	enum itemroulette field = luaL_checkoption(L, 2, itemroulette_opt[0], itemroulette_opt);
+	enum itemroulette field = Lua_checkoption(L, 2, 0, itemroulette_fields_ref);
 
 	// if this is null, welcome to parking garage rally circuit
 	I_Assert(itemroulette != NULL);
@@ -155,7 +157,7 @@ static int itemroulette_get(lua_State *L)
 static int itemroulette_set(lua_State *L)
 {
 	itemroulette_t *itemroulette = *((itemroulette_t **)luaL_checkudata(L, 1, META_ITEMROULETTE));
-	enum itemroulette field = luaL_checkoption(L, 2, itemroulette_opt[0], itemroulette_opt);
+	enum itemroulette field = Lua_checkoption(L, 2, 0, itemroulette_fields_ref);
 
 	// if this is null, welcome to parking garage rally circuit
 	I_Assert(itemroulette != NULL);
@@ -269,6 +271,8 @@ static int itemrouletteitemlist_len(lua_State* L)
 
 int LUA_ItemRouletteLib(lua_State *L)
 {
+	itemroulette_fields_ref = Lua_CreateFieldTable(L, itemroulette_opt);
+
 	luaL_newmetatable(L, META_ITEMROULETTE);
 		lua_pushcfunction(L, itemroulette_get);
 		lua_setfield(L, -2, "__index");
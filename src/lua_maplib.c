@@ -99,6 +99,8 @@ static const char *const sector_opt[] = {
 	"activation",
 	NULL};
 
+static int sector_fields_ref = LUA_NOREF;
+
 enum subsector_e {
 	subsector_valid = 0,
 	subsector_sector,
@@ -115,6 +117,8 @@ static const char *const subsector_opt[] = {
 	"polyList",
 	NULL};
 
+static int subsector_fields_ref = LUA_NOREF;
+
 enum line_e {
 	line_valid = 0,
 	line_v1,
@@ -167,6 +171,8 @@ static const char *const line_opt[] = {
 	"callcount",
 	NULL};
 
+static int line_fields_ref = LUA_NOREF;
+
 enum side_e {
 	side_valid = 0,
 	side_textureoffset,
@@ -193,6 +199,8 @@ static const char *const side_opt[] = {
 	"repeatcnt",
 	NULL};
 
+static int side_fields_ref = LUA_NOREF;
+
 enum vertex_e {
 	vertex_valid = 0,
 	vertex_x,
@@ -213,6 +221,8 @@ static const char *const vertex_opt[] = {
 	"ceilingzset",
 	NULL};
 
+static int vertex_fields_ref = LUA_NOREF;
+
 enum ffloor_e {
 	ffloor_valid = 0,
 	ffloor_topheight,
@@ -265,6 +275,8 @@ static const char *const ffloor_opt[] = {
 	"bouncestrength",
 	NULL};
 
+static int ffloor_fields_ref = LUA_NOREF;
+
 enum bbox_e {
 	bbox_valid = 0,
 	bbox_top,
@@ -281,6 +293,8 @@ static const char *const bbox_opt[] = {
 	"right",
 	NULL};
 
+static int bbox_fields_ref = LUA_NOREF;
+
 enum slope_e {
 	slope_valid = 0,
 	slope_o,
@@ -303,6 +317,8 @@ static const char *const slope_opt[] = {
 	"flags",
 	NULL};
 
+static int slope_fields_ref = LUA_NOREF;
+
 // shared by both vector2_t and vector3_t
 enum vector_e {
 	vector_x = 0,
@@ -316,6 +332,8 @@ static const char *const vector_opt[] = {
 	"z",
 	NULL};
 
+static int vector_fields_ref = LUA_NOREF;
+
 enum activator_e {
 	activator_valid = 0,
 	activator_mo,
@@ -333,6 +351,8 @@ static const char *const activator_opt[] = {
 	"sector",
 	"po",
 	NULL};
+
+static int activator_fields_ref = LUA_NOREF;
 	
 enum botcontroller_e {
 	botcontroller_valid = 0,
@@ -348,9 +368,85 @@ static const char *const botcontroller_opt[] = {
 	"forceangle",
 	NULL};
 
+static int botcontroller_fields_ref = LUA_NOREF;
+
+enum mapheader_e {
+	mapheader_lvlttl = 0,
+	mapheader_menuttl,
+	mapheader_zonttl,
+	mapheader_actnum,
+	mapheader_typeoflevel,
+	mapheader_keywords,
+	mapheader_musname,
+	mapheader_encoremusname,
+	mapheader_associatedmus,
+	mapheader_mustrack,
+	mapheader_muspos,
+	mapheader_musname_size,
+	mapheader_encoremusname_size,
+	mapheader_associatedmus_size,
+	mapheader_weather,
+	mapheader_skytexture,
+	mapheader_skybox_scalex,
+	mapheader_skybox_scaley,
+	mapheader_skybox_scalez,
+	mapheader_runsoc,
+	mapheader_scriptname,
+	mapheader_precutscenenum,
+	mapheader_cutscenenum,
+	mapheader_palette,
+	mapheader_numlaps,
+	mapheader_lapspersection,
+	mapheader_levelselect,
+	mapheader_levelflags,
+	mapheader_menuflags,
+	mapheader_mobj_scale,
+	mapheader_gravity,
+	mapheader_cameraheight,
+};
+
+static const char *const mapheader_opt[] = {
+	"lvlttl",
+	"menuttl",
+	"zonttl",
+	"actnum",
+	"typeoflevel",
+	"keywords",
+	"musname",
+	"encoremusname",
+	"associatedmus",
+	"mustrack",
+	"muspos",
+	"musname_size",
+	"encoremusname_size",
+	"associatedmus_size",
+	"weather",
+	"skytexture",
+	"skybox_scalex",
+	"skybox_scaley",
+	"skybox_scalez",
+	"runsoc",
+	"scriptname",
+	"precutscenenum",
+	"cutscenenum",
+	"palette",
+	"numlaps",
+	"lapspersection",
+	"levelselect",
+	"levelflags",
+	"menuflags",
+	"mobj_scale",
+	"gravity",
+	"cameraheight",
+	NULL};
+
+static int mapheader_fields_ref = LUA_NOREF;
+
 static const char *const array_opt[] ={"iterate",NULL};
 static const char *const valid_opt[] ={"valid",NULL};
 
+static int valid_fields_ref = LUA_NOREF;
+
 /////////////////////////////////////////////
 // sector/subsector list iterate functions //
 /////////////////////////////////////////////
@@ -487,7 +583,7 @@ static int sectorlines_get(lua_State *L)
 	lua_settop(L, 2);
 	if (!lua_isnumber(L, 2))
 	{
-		int field = luaL_checkoption(L, 2, NULL, valid_opt);
+		int field = Lua_checkoption(L, 2, -1, valid_fields_ref);
 		if (!seclines || !(*seclines))
 		{
 			if (field == 0) {
@@ -590,7 +686,7 @@ static int sectorstringargs_len(lua_State *L)
 static int sector_get(lua_State *L)
 {
 	sector_t *sector = *((sector_t **)luaL_checkudata(L, 1, META_SECTOR));
-	enum sector_e field = luaL_checkoption(L, 2, sector_opt[0], sector_opt);
+	enum sector_e field = Lua_checkoption(L, 2, 0, sector_fields_ref);
 	int16_t i;
 
 	if (!sector)
@@ -727,7 +823,7 @@ static int sector_get(lua_State *L)
 static int sector_set(lua_State *L)
 {
 	sector_t *sector = *((sector_t **)luaL_checkudata(L, 1, META_SECTOR));
-	enum sector_e field = luaL_checkoption(L, 2, sector_opt[0], sector_opt);
+	enum sector_e field = Lua_checkoption(L, 2, 0, sector_fields_ref);
 
 	if (!sector)
 		return luaL_error(L, "accessed sector_t doesn't exist anymore.");
@@ -852,7 +948,7 @@ static int sector_num(lua_State *L)
 static int subsector_get(lua_State *L)
 {
 	subsector_t *subsector = *((subsector_t **)luaL_checkudata(L, 1, META_SUBSECTOR));
-	enum subsector_e field = luaL_checkoption(L, 2, subsector_opt[0], subsector_opt);
+	enum subsector_e field = Lua_checkoption(L, 2, 0, subsector_fields_ref);
 
 	if (!subsector)
 	{
@@ -936,7 +1032,7 @@ static int linestringargs_len(lua_State *L)
 static int line_get(lua_State *L)
 {
 	line_t *line = *((line_t **)luaL_checkudata(L, 1, META_LINE));
-	enum line_e field = luaL_checkoption(L, 2, line_opt[0], line_opt);
+	enum line_e field = Lua_checkoption(L, 2, 0, line_fields_ref);
 
 	if (!line)
 	{
@@ -1067,7 +1163,7 @@ static int sidenum_get(lua_State *L)
 	lua_settop(L, 2);
 	if (!lua_isnumber(L, 2))
 	{
-		int field = luaL_checkoption(L, 2, NULL, valid_opt);
+		int field = Lua_checkoption(L, 2, -1, valid_fields_ref);
 		if (!sidenum)
 		{
 			if (field == 0) {
@@ -1095,7 +1191,7 @@ static int sidenum_get(lua_State *L)
 static int side_get(lua_State *L)
 {
 	side_t *side = *((side_t **)luaL_checkudata(L, 1, META_SIDE));
-	enum side_e field = luaL_checkoption(L, 2, side_opt[0], side_opt);
+	enum side_e field = Lua_checkoption(L, 2, 0, side_fields_ref);
 
 	if (!side)
 	{
@@ -1145,7 +1241,7 @@ static int side_get(lua_State *L)
 static int side_set(lua_State *L)
 {
 	side_t *side = *((side_t **)luaL_checkudata(L, 1, META_SIDE));
-	enum side_e field = luaL_checkoption(L, 2, side_opt[0], side_opt);
+	enum side_e field = Lua_checkoption(L, 2, 0, side_fields_ref);
 
 	if (!side)
 	{
@@ -1200,7 +1296,7 @@ static int side_num(lua_State *L)
 static int vertex_get(lua_State *L)
 {
 	vertex_t *vertex = *((vertex_t **)luaL_checkudata(L, 1, META_VERTEX));
-	enum vertex_e field = luaL_checkoption(L, 2, vertex_opt[0], vertex_opt);
+	enum vertex_e field = Lua_checkoption(L, 2, 0, vertex_fields_ref);
 
 	if (!vertex)
 	{
@@ -1258,7 +1354,7 @@ static int bbox_get(lua_State *L)
 	lua_settop(L, 2);
 	if (!lua_isnumber(L, 2))
 	{
-		enum bbox_e field = luaL_checkoption(L, 2, bbox_opt[0], bbox_opt);
+		enum bbox_e field = Lua_checkoption(L, 2, 0, bbox_fields_ref);
 		if (!bbox)
 		{
 			if (field == bbox_valid) {
@@ -1607,7 +1703,7 @@ static int32_t P_GetOldFOFFlags(ffloor_t *fflr)
 static int ffloor_get(lua_State *L)
 {
 	ffloor_t *ffloor = *((ffloor_t **)luaL_checkudata(L, 1, META_FFLOOR));
-	enum ffloor_e field = luaL_checkoption(L, 2, ffloor_opt[0], ffloor_opt);
+	enum ffloor_e field = Lua_checkoption(L, 2, 0, ffloor_fields_ref);
 	int16_t i;
 
 	if (!ffloor)
@@ -1789,7 +1885,7 @@ static void P_SetOldFOFFlags(ffloor_t *fflr, oldffloortype_e oldflags)
 static int ffloor_set(lua_State *L)
 {
 	ffloor_t *ffloor = *((ffloor_t **)luaL_checkudata(L, 1, META_FFLOOR));
-	enum ffloor_e field = luaL_checkoption(L, 2, ffloor_opt[0], ffloor_opt);
+	enum ffloor_e field = Lua_checkoption(L, 2, 0, ffloor_fields_ref);
 
 	if (!ffloor)
 		return luaL_error(L, "accessed ffloor_t doesn't exist anymore.");
@@ -1884,7 +1980,7 @@ static int ffloor_set(lua_State *L)
 static int slope_get(lua_State *L)
 {
 	pslope_t *slope = *((pslope_t **)luaL_checkudata(L, 1, META_SLOPE));
-	enum slope_e field = luaL_checkoption(L, 2, slope_opt[0], slope_opt);
+	enum slope_e field = Lua_checkoption(L, 2, 0, slope_fields_ref);
 
 	if (!slope)
 	{
@@ -1928,7 +2024,7 @@ static int slope_get(lua_State *L)
 static int slope_set(lua_State *L)
 {
 	pslope_t *slope = *((pslope_t **)luaL_checkudata(L, 1, META_SLOPE));
-	enum slope_e field = luaL_checkoption(L, 2, slope_opt[0], slope_opt);
+	enum slope_e field = Lua_checkoption(L, 2, 0, slope_fields_ref);
 
 	if (!slope)
 		return luaL_error(L, "accessed pslope_t doesn't exist anymore.");
@@ -2018,7 +2114,7 @@ static int slope_set(lua_State *L)
 static int vector2_get(lua_State *L)
 {
 	vector2_t *vec = *((vector2_t **)luaL_checkudata(L, 1, META_VECTOR2));
-	enum vector_e field = luaL_checkoption(L, 2, vector_opt[0], vector_opt);
+	enum vector_e field = Lua_checkoption(L, 2, 0, vector_fields_ref);
 
 	if (!vec)
 		return luaL_error(L, "accessed vector2_t doesn't exist anymore.");
@@ -2036,7 +2132,7 @@ static int vector2_get(lua_State *L)
 static int vector3_get(lua_State *L)
 {
 	vector3_t *vec = *((vector3_t **)luaL_checkudata(L, 1, META_VECTOR3));
-	enum vector_e field = luaL_checkoption(L, 2, vector_opt[0], vector_opt);
+	enum vector_e field = Lua_checkoption(L, 2, 0, vector_fields_ref);
 
 	if (!vec)
 		return luaL_error(L, "accessed vector3_t doesn't exist anymore.");
@@ -2096,19 +2192,29 @@ static int mapheaderinfo_get(lua_State *L)
 {
 	mapheader_t *header = *((mapheader_t **)luaL_checkudata(L, 1, META_MAPHEADER));
 	const char *field = luaL_checkstring(L, 2);
-	if (fastcmp(field,"lvlttl"))
+	enum mapheader_e fieldid = Lua_optoption(L, 2, -1, mapheader_fields_ref);
+
+	switch (fieldid)
+	{
+	case mapheader_lvlttl:
 		lua_pushstring(L, header->lvlttl);
-	else if (fastcmp(field,"menuttl"))
+		break;
+	case mapheader_menuttl:
 		lua_pushstring(L, header->menuttl);
-	else if (fastcmp(field,"zonttl"))
+		break;
+	case mapheader_zonttl:
 		lua_pushstring(L, header->zonttl);
-	else if (fastcmp(field,"actnum"))
+		break;
+	case mapheader_actnum:
 		lua_pushinteger(L, header->actnum);
-	else if (fastcmp(field,"typeoflevel"))
+		break;
+	case mapheader_typeoflevel:
 		lua_pushinteger(L, header->typeoflevel);
-	else if (fastcmp(field,"keywords"))
+		break;
+	case mapheader_keywords:
 		lua_pushstring(L, header->keywords);
-	else if (fastcmp(field,"musname")) // we create a table here because it saves us from a userdata nightmare
+		break;
+	case mapheader_musname: // we create a table here because it saves us from a userdata nightmare
 	{
 		uint8_t i;
 		lua_createtable(L, header->musname_size, 0);
@@ -2117,8 +2223,9 @@ static int mapheaderinfo_get(lua_State *L)
 			lua_pushstring(L, header->musname[i]);
 			lua_rawseti(L, -2, 1 + i);
 		}
+		break;
 	}
-	else if (fastcmp(field,"encoremusname")) // we create a table here because it saves us from a userdata nightmare
+	case mapheader_encoremusname: // we create a table here because it saves us from a userdata nightmare
 	{
 		uint8_t i;
 		lua_createtable(L, header->encoremusname_size, 0);
@@ -2127,8 +2234,9 @@ static int mapheaderinfo_get(lua_State *L)
 			lua_pushstring(L, header->encoremusname[i]);
 			lua_rawseti(L, -2, 1 + i);
 		}
+		break;
 	}
-	else if (fastcmp(field,"associatedmus")) // we create a table here because it saves us from a userdata nightmare
+	case mapheader_associatedmus: // we create a table here because it saves us from a userdata nightmare
 	{
 		uint8_t i;
 		lua_createtable(L, header->associatedmus_size, 0);
@@ -2137,54 +2245,79 @@ static int mapheaderinfo_get(lua_State *L)
 			lua_pushstring(L, header->associatedmus[i]);
 			lua_rawseti(L, -2, 1 + i);
 		}
+		break;
 	}
-	else if (fastcmp(field,"mustrack"))
+	case mapheader_mustrack:
 		lua_pushinteger(L, header->mustrack);
-	else if (fastcmp(field,"muspos"))
+		break;
+	case mapheader_muspos:
 		lua_pushinteger(L, header->muspos);
-	else if (fastcmp(field,"musname_size"))
+		break;
+	case mapheader_musname_size:
 		lua_pushinteger(L, header->musname_size);
-	else if (fastcmp(field,"encoremusname_size"))
+		break;
+	case mapheader_encoremusname_size:
 		lua_pushinteger(L, header->encoremusname_size);
-	else if (fastcmp(field,"associatedmus_size"))
+		break;
+	case mapheader_associatedmus_size:
 		lua_pushinteger(L, header->associatedmus_size);
-	else if (fastcmp(field,"weather"))
+		break;
+	case mapheader_weather:
 		lua_pushinteger(L, header->weather);
-	else if (fastcmp(field,"skytexture"))
+		break;
+	case mapheader_skytexture:
 		lua_pushstring(L, header->skytexture);
-	else if (fastcmp(field,"skybox_scalex"))
+		break;
+	case mapheader_skybox_scalex:
 		lua_pushinteger(L, header->skybox_scalex);
-	else if (fastcmp(field,"skybox_scaley"))
+		break;
+	case mapheader_skybox_scaley:
 		lua_pushinteger(L, header->skybox_scaley);
-	else if (fastcmp(field,"skybox_scalez"))
+		break;
+	case mapheader_skybox_scalez:
 		lua_pushinteger(L, header->skybox_scalez);
-	else if (fastcmp(field,"runsoc"))
+		break;
+	case mapheader_runsoc:
 		lua_pushstring(L, header->runsoc);
-	else if (fastcmp(field,"scriptname"))
+		break;
+	case mapheader_scriptname:
 		lua_pushstring(L, header->scriptname);
-	else if (fastcmp(field,"precutscenenum"))
+		break;
+	case mapheader_precutscenenum:
 		lua_pushinteger(L, header->precutscenenum);
-	else if (fastcmp(field,"cutscenenum"))
+		break;
+	case mapheader_cutscenenum:
 		lua_pushinteger(L, header->cutscenenum);
-	else if (fastcmp(field,"palette"))
+		break;
+	case mapheader_palette:
 		lua_pushinteger(L, header->palette);
-	else if (fastcmp(field,"numlaps"))
+		break;
+	case mapheader_numlaps:
 		lua_pushinteger(L, header->numlaps);
-	else if (fastcmp(field,"lapspersection"))
+		break;
+	case mapheader_lapspersection:
 		lua_pushinteger(L, header->lapspersection);
-	else if (fastcmp(field,"levelselect"))
+		break;
+	case mapheader_levelselect:
 		lua_pushinteger(L, header->levelselect);
-	else if (fastcmp(field,"levelflags"))
+		break;
+	case mapheader_levelflags:
 		lua_pushinteger(L, header->levelflags);
-	else if (fastcmp(field,"menuflags"))
+		break;
+	case mapheader_menuflags:
 		lua_pushinteger(L, header->menuflags);
-	else if (fastcmp(field,"mobj_scale"))
+		break;
+	case mapheader_mobj_scale:
 		lua_pushfixed(L, header->mobj_scale);
-	else if (fastcmp(field, "gravity"))
+		break;
+	case mapheader_gravity:
 		lua_pushfixed(L, header->gravity);
-	else if (fastcmp(field, "cameraheight"))
+		break;
+	case mapheader_cameraheight:
 		lua_pushfixed(L, header->cameraHeight);
-	else {
+		break;
+	default:
+	{
 		// Read custom vars now
 		// (note: don't include the "LUA." in your lua scripts!)
 		uint8_t j = 0;
@@ -2194,6 +2327,8 @@ static int mapheaderinfo_get(lua_State *L)
 			lua_pushstring(L, header->customopts[j].value);
 		else
 			lua_pushnil(L);
+		break;
+	}
 	}
 	return 1;
 }
@@ -2205,7 +2340,7 @@ static int mapheaderinfo_get(lua_State *L)
 static int activator_get(lua_State *L)
 {
 	activator_t *activator = *((activator_t **)luaL_checkudata(L, 1, META_ACTIVATOR));
-	enum activator_e field = luaL_checkoption(L, 2, activator_opt[0], activator_opt);
+	enum activator_e field = Lua_checkoption(L, 2, 0, activator_fields_ref);
 
 	if (activator == NULL)
 	{
@@ -2258,7 +2393,7 @@ static int activator_get(lua_State *L)
 static int botcontroller_get(lua_State *L)
 {
 	botcontroller_t *botcontroller = *((botcontroller_t **)luaL_checkudata(L, 1, META_BOTCONTROLLER));
-	enum botcontroller_e field = luaL_checkoption(L, 2, botcontroller_opt[0], botcontroller_opt);
+	enum botcontroller_e field = Lua_checkoption(L, 2, 0, botcontroller_fields_ref);
 
 	if (!botcontroller)
 	{
@@ -2296,6 +2431,20 @@ static int botcontroller_get(lua_State *L)
 
 int LUA_MapLib(lua_State *L)
 {
+	valid_fields_ref = Lua_CreateFieldTable(L, valid_opt);
+	sector_fields_ref = Lua_CreateFieldTable(L, sector_opt);
+	subsector_fields_ref = Lua_CreateFieldTable(L, subsector_opt);
+	line_fields_ref = Lua_CreateFieldTable(L, line_opt);
+	side_fields_ref = Lua_CreateFieldTable(L, side_opt);
+	vertex_fields_ref = Lua_CreateFieldTable(L, vertex_opt);
+	bbox_fields_ref = Lua_CreateFieldTable(L, bbox_opt);
+	ffloor_fields_ref = Lua_CreateFieldTable(L, ffloor_opt);
+	slope_fields_ref = Lua_CreateFieldTable(L, slope_opt);
+	vector_fields_ref = Lua_CreateFieldTable(L, vector_opt);
+	activator_fields_ref = Lua_CreateFieldTable(L, activator_opt);
+	botcontroller_fields_ref = Lua_CreateFieldTable(L, botcontroller_opt);
+	mapheader_fields_ref = Lua_CreateFieldTable(L, mapheader_opt);
+
 	luaL_newmetatable(L, META_SECTORLINES);
 		lua_pushcfunction(L, sectorlines_get);
 		lua_setfield(L, -2, "__index");
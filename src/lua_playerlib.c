@@ -160,720 +160,1748 @@ static int lib_lenDisplayplayers(lua_State *L)
 	return 1;
 }
 
+enum player_e {
+	player_valid = 0,
+	player_name,
+	player_mo,
+	player_cmd,
+	player_oldcmd,
+	player_respawn,
+	player_playerstate,
+	player_viewz,
+	player_viewheight,
+	player_skybox,
+	player_viewrollangle,
+	player_tilt,
+	player_aiming,
+	player_drawangle,
+	player_karthud,
+	player_nocontrol,
+	player_carry,
+	player_dye,
+	player_position,
+	player_oldposition,
+	player_positiondelay,
+	player_leaderpenalty,
+	player_teamposition,
+	player_teamimportance,
+	player_distancetofinish,
+	player_distancetofinishprev,
+	player_lastpickupdistance,
+	player_lastpickuptype,
+	player_currentwaypoint,
+	player_nextwaypoint,
+	player_ringshooter,
+	player_airtime,
+	player_lastairtime,
+	player_bigwaypointgap,
+	player_flashing,
+	player_spinouttimer,
+	player_spinouttype,
+	player_instashield,
+	player_nullhitlag,
+	player_wipeoutslow,
+	player_justbumped,
+	player_noebrakemagnet,
+	player_wallspikedampen,
+	player_tumblebounces,
+	player_tumbleheight,
+	player_stunned,
+	player_flybot,
+	player_justdi,
+	player_flipdi,
+	player_cangrabitems,
+	player_analoginput,
+	player_transfer,
+	player_markedfordeath,
+	player_mfdfinish,
+	player_incontrol,
+	player_progressivethrust,
+	player_ringvisualwarning,
+	player_bailcharge,
+	player_baildrop,
+	player_bailhitlag,
+	player_dotrickfx,
+	player_stingfx,
+	player_bumperinflate,
+	player_ringboxdelay,
+	player_ringboxaward,
+	player_lastringboost,
+	player_amps,
+	player_recentamps,
+	player_amppickup,
+	player_ampspending,
+	player_itemflags,
+	player_outrun,
+	player_drift,
+	player_driftcharge,
+	player_driftboost,
+	player_strongdriftboost,
+	player_gateboost,
+	player_gatesound,
+	player_startboost,
+	player_neostartboost,
+	player_dropdashboost,
+	player_aciddropdashboost,
+	player_aizdriftstrat,
+	player_aizdriftextend,
+	player_aizdrifttilt,
+	player_aizdriftturn,
+	player_underwatertilt,
+	player_offroad,
+	player_tiregrease,
+	player_springstars,
+	player_springcolor,
+	player_dashpadcooldown,
+	player_spindash,
+	player_spindashspeed,
+	player_spindashboost,
+	player_ringboostinprogress,
+	player_fastfall,
+	player_fastfallbase,
+	player_numboosts,
+	player_boostpower,
+	player_speedboost,
+	player_accelboost,
+	player_handleboost,
+	player_boostangle,
+	player_stonedrag,
+	player_draftpower,
+	player_draftleeway,
+	player_lastdraft,
+	player_tripwirestate,
+	player_tripwirepass,
+	player_fakeboost,
+	player_subsonicleniency,
+	player_tripwireleniency,
+	player_tripwireairleniency,
+	player_tripwirerebounddelay,
+	player_shrinklaserdelay,
+	player_eggmantransferdelay,
+	player_wavedash,
+	player_wavedashleft,
+	player_wavedashright,
+	player_wavedashdelay,
+	player_wavedashboost,
+	player_overdrive,
+	player_overshield,
+	player_wavedashpower,
+	player_overdrivepower,
+	player_overdriveready,
+	player_overdrivelenient,
+	player_trickcharge,
+	player_infinitether,
+	player_finalfailsafe,
+	player_freeringshootercooldown,
+	player_lastsafelap,
+	player_lastsafecheatcheck,
+	player_ignoreairtimeleniency,
+	player_bubbledrag,
+	player_topaccel,
+	player_vortexboost,
+	player_instawhipcharge,
+	player_pitblame,
+	player_defenselockout,
+	player_instawhipchargelockout,
+	player_oldguard,
+	player_powerupvfxtimer,
+	player_preventfailsafe,
+	player_tripwireunstuck,
+	player_bumpunstuck,
+	player_handtimer,
+	player_besthanddirection,
+	player_itemroulette,
+	player_itemtype,
+	player_itemamount,
+	player_backupitemtype,
+	player_backupitemamount,
+	player_throwdir,
+	player_sadtimer,
+	player_rings,
+	player_hudrings,
+	player_pickuprings,
+	player_ringdelay,
+	player_ringboost,
+	player_momentboost,
+	player_sparkleanim,
+	player_superring,
+	player_superringdisplay,
+	player_superringpeak,
+	player_superringalert,
+	player_nextringaward,
+	player_ringvolume,
+	player_ringtransparency,
+	player_ringburst,
+	player_curshield,
+	player_bubblecool,
+	player_bubbleblowup,
+	player_flamedash,
+	player_counterdash,
+	player_flamemeter,
+	player_flamelength,
+	player_lightningcharge,
+	player_ballhogcharge,
+	player_ballhogburst,
+	player_ballhogtap,
+	player_ballhogreticule,
+	player_hyudorotimer,
+	player_stealingtimer,
+	player_hoverhyudoro,
+	player_sneakertimer,
+	player_numsneakers,
+	player_panelsneakertimer,
+	player_numpanelsneakers,
+	player_weaksneakertimer,
+	player_numweaksneakers,
+	player_floorboost,
+	player_growshrinktimer,
+	player_rocketsneakertimer,
+	player_invincibilitytimer,
+	player_invincibilityextensions,
+	player_loneliness,
+	player_eggmanexplode,
+	player_eggmanblame,
+	player_bananadrag,
+	player_lastjawztarget,
+	player_jawztargetdelay,
+	player_confirmvictim,
+	player_confirmvictimdelay,
+	player_glancedir,
+	player_breathtimer,
+	player_trickpanel,
+	player_tricktime,
+	player_trickboostpower,
+	player_trickboostdecay,
+	player_trickboost,
+	player_tricklock,
+	player_dashringpulltics,
+	player_dashringpushtics,
+	player_pullup,
+	player_finalized,
+	player_ebrakefor,
+	player_roundscore,
+	player_emeralds,
+	player_karmadelay,
+	player_spheres,
+	player_spheredigestion,
+	player_pflags,
+	player_pflags2,
+	player_panim,
+	player_flashcount,
+	player_flashpal,
+	player_skincolor,
+	player_skin,
+	player_fakeskin,
+	player_lastfakeskin,
+	player_score,
+	player_kartspeed,
+	player_kartweight,
+	player_followerskin,
+	player_followerready,
+	player_followercolor,
+	player_follower,
+	player_prefskin,
+	player_prefcolor,
+	player_preffollower,
+	player_preffollowercolor,
+	player_rideroid,
+	player_rdnodepull,
+	player_rideroidangle,
+	player_rideroidspeed,
+	player_rideroidrollangle,
+	player_rdaddmomx,
+	player_rdaddmomy,
+	player_rdaddmomz,
+	player_bungee,
+	player_lasthover,
+	player_dlzrocket,
+	player_dlzrocketangle,
+	player_dlzrocketanglev,
+	player_dlzrocketspd,
+	player_seasaw,
+	player_seasawcooldown,
+	player_seasawdist,
+	player_seasawangle,
+	player_seasawangleadd,
+	player_seasawmoreangle,
+	player_seasawdir,
+	player_turbine,
+	player_turbineangle,
+	player_turbineheight,
+	player_turbinespd,
+	player_cloud,
+	player_cloudlaunch,
+	player_cloudbuf,
+	player_tulip,
+	player_tuliplaunch,
+	player_tulipbuf,
+	player_charflags,
+	player_followitem,
+	player_followmobj,
+	player_lives,
+	player_xtralife,
+	player_speed,
+	player_lastspeed,
+	player_deadtimer,
+	player_exiting,
+	player_cmomx,
+	player_cmomy,
+	player_rmomx,
+	player_rmomy,
+	player_totalring,
+	player_realtime,
+	player_laps,
+	player_latestlap,
+	player_exp,
+	player_gradingfactor,
+	player_gradingpointnum,
+	player_checkpointid,
+	player_team,
+	player_checkskip,
+	player_cheatchecknum,
+	player_duelscore,
+	player_lastsidehit,
+	player_lastlinehit,
+	player_timeshit,
+	player_timeshitprev,
+	player_onconveyor,
+	player_awayviewmobj,
+	player_awayviewtics,
+	player_spectator,
+	player_spectatewait,
+	player_bot,
+	player_botvars,
+	player_jointime,
+	player_spectatorreentry,
+	player_griefvalue,
+	player_griefstrikes,
+	player_griefwarned,
+	player_typing_timer,
+	player_typing_duration,
+	player_kickstartaccel,
+	player_autoring,
+	player_stairjank,
+	player_topdriftheld,
+	player_topinfirst,
+	player_splitscreenindex,
+	player_stumbleindicator,
+	player_wavedashindicator,
+	player_trickindicator,
+	player_whip,
+	player_hand,
+	player_flickyattacker,
+	player_stoneshoe,
+	player_toxomistercloud,
+	player_fovadd,
+	player_ping,
+	player_publickey,
+	player_loop,
+	player_powerup,
+	player_icecube,
+	player_darkness_start,
+	player_darkness_end,
+};
+
+static const char *const player_opt[] = {
+	"valid",
+	"name",
+	"mo",
+	"cmd",
+	"oldcmd",
+	"respawn",
+	"playerstate",
+	"viewz",
+	"viewheight",
+	"skybox",
+	"viewrollangle",
+	"tilt",
+	"aiming",
+	"drawangle",
+	"karthud",
+	"nocontrol",
+	"carry",
+	"dye",
+	"position",
+	"oldposition",
+	"positiondelay",
+	"leaderpenalty",
+	"teamposition",
+	"teamimportance",
+	"distancetofinish",
+	"distancetofinishprev",
+	"lastpickupdistance",
+	"lastpickuptype",
+	"currentwaypoint",
+	"nextwaypoint",
+	"ringshooter",
+	"airtime",
+	"lastairtime",
+	"bigwaypointgap",
+	"flashing",
+	"spinouttimer",
+	"spinouttype",
+	"instashield",
+	"nullhitlag",
+	"wipeoutslow",
+	"justbumped",
+	"noebrakemagnet",
+	"wallspikedampen",
+	"tumblebounces",
+	"tumbleheight",
+	"stunned",
+	"flybot",
+	"justdi",
+	"flipdi",
+	"cangrabitems",
+	"analoginput",
+	"transfer",
+	"markedfordeath",
+	"mfdfinish",
+	"incontrol",
+	"progressivethrust",
+	"ringvisualwarning",
+	"bailcharge",
+	"baildrop",
+	"bailhitlag",
+	"dotrickfx",
+	"stingfx",
+	"bumperinflate",
+	"ringboxdelay",
+	"ringboxaward",
+	"lastringboost",
+	"amps",
+	"recentamps",
+	"amppickup",
+	"ampspending",
+	"itemflags",
+	"outrun",
+	"drift",
+	"driftcharge",
+	"driftboost",
+	"strongdriftboost",
+	"gateboost",
+	"gatesound",
+	"startboost",
+	"neostartboost",
+	"dropdashboost",
+	"aciddropdashboost",
+	"aizdriftstrat",
+	"aizdriftextend",
+	"aizdrifttilt",
+	"aizdriftturn",
+	"underwatertilt",
+	"offroad",
+	"tiregrease",
+	"springstars",
+	"springcolor",
+	"dashpadcooldown",
+	"spindash",
+	"spindashspeed",
+	"spindashboost",
+	"ringboostinprogress",
+	"fastfall",
+	"fastfallbase",
+	"numboosts",
+	"boostpower",
+	"speedboost",
+	"accelboost",
+	"handleboost",
+	"boostangle",
+	"stonedrag",
+	"draftpower",
+	"draftleeway",
+	"lastdraft",
+	"tripwirestate",
+	"tripwirepass",
+	"fakeboost",
+	"subsonicleniency",
+	"tripwireleniency",
+	"tripwireairleniency",
+	"tripwirerebounddelay",
+	"shrinklaserdelay",
+	"eggmantransferdelay",
+	"wavedash",
+	"wavedashleft",
+	"wavedashright",
+	"wavedashdelay",
+	"wavedashboost",
+	"overdrive",
+	"overshield",
+	"wavedashpower",
+	"overdrivepower",
+	"overdriveready",
+	"overdrivelenient",
+	"trickcharge",
+	"infinitether",
+	"finalfailsafe",
+	"freeringshootercooldown",
+	"lastsafelap",
+	"lastsafecheatcheck",
+	"ignoreairtimeleniency",
+	"bubbledrag",
+	"topaccel",
+	"vortexboost",
+	"instawhipcharge",
+	"pitblame",
+	"defenselockout",
+	"instawhipchargelockout",
+	"oldguard",
+	"powerupvfxtimer",
+	"preventfailsafe",
+	"tripwireunstuck",
+	"bumpunstuck",
+	"handtimer",
+	"besthanddirection",
+	"itemroulette",
+	"itemtype",
+	"itemamount",
+	"backupitemtype",
+	"backupitemamount",
+	"throwdir",
+	"sadtimer",
+	"rings",
+	"hudrings",
+	"pickuprings",
+	"ringdelay",
+	"ringboost",
+	"momentboost",
+	"sparkleanim",
+	"superring",
+	"superringdisplay",
+	"superringpeak",
+	"superringalert",
+	"nextringaward",
+	"ringvolume",
+	"ringtransparency",
+	"ringburst",
+	"curshield",
+	"bubblecool",
+	"bubbleblowup",
+	"flamedash",
+	"counterdash",
+	"flamemeter",
+	"flamelength",
+	"lightningcharge",
+	"ballhogcharge",
+	"ballhogburst",
+	"ballhogtap",
+	"ballhogreticule",
+	"hyudorotimer",
+	"stealingtimer",
+	"hoverhyudoro",
+	"sneakertimer",
+	"numsneakers",
+	"panelsneakertimer",
+	"numpanelsneakers",
+	"weaksneakertimer",
+	"numweaksneakers",
+	"floorboost",
+	"growshrinktimer",
+	"rocketsneakertimer",
+	"invincibilitytimer",
+	"invincibilityextensions",
+	"loneliness",
+	"eggmanexplode",
+	"eggmanblame",
+	"bananadrag",
+	"lastjawztarget",
+	"jawztargetdelay",
+	"confirmvictim",
+	"confirmvictimdelay",
+	"glancedir",
+	"breathtimer",
+	"trickpanel",
+	"tricktime",
+	"trickboostpower",
+	"trickboostdecay",
+	"trickboost",
+	"tricklock",
+	"dashringpulltics",
+	"dashringpushtics",
+	"pullup",
+	"finalized",
+	"ebrakefor",
+	"roundscore",
+	"emeralds",
+	"karmadelay",
+	"spheres",
+	"spheredigestion",
+	"pflags",
+	"pflags2",
+	"panim",
+	"flashcount",
+	"flashpal",
+	"skincolor",
+	"skin",
+	"fakeskin",
+	"lastfakeskin",
+	"score",
+	"kartspeed",
+	"kartweight",
+	"followerskin",
+	"followerready",
+	"followercolor",
+	"follower",
+	"prefskin",
+	"prefcolor",
+	"preffollower",
+	"preffollowercolor",
+	"rideroid",
+	"rdnodepull",
+	"rideroidangle",
+	"rideroidspeed",
+	"rideroidrollangle",
+	"rdaddmomx",
+	"rdaddmomy",
+	"rdaddmomz",
+	"bungee",
+	"lasthover",
+	"dlzrocket",
+	"dlzrocketangle",
+	"dlzrocketanglev",
+	"dlzrocketspd",
+	"seasaw",
+	"seasawcooldown",
+	"seasawdist",
+	"seasawangle",
+	"seasawangleadd",
+	"seasawmoreangle",
+	"seasawdir",
+	"turbine",
+	"turbineangle",
+	"turbineheight",
+	"turbinespd",
+	"cloud",
+	"cloudlaunch",
+	"cloudbuf",
+	"tulip",
+	"tuliplaunch",
+	"tulipbuf",
+	"charflags",
+	"followitem",
+	"followmobj",
+	"lives",
+	"xtralife",
+	"speed",
+	"lastspeed",
+	"deadtimer",
+	"exiting",
+	"cmomx",
+	"cmomy",
+	"rmomx",
+	"rmomy",
+	"totalring",
+	"realtime",
+	"laps",
+	"latestlap",
+	"exp",
+	"gradingfactor",
+	"gradingpointnum",
+	"checkpointid",
+	"team",
+	"checkskip",
+	"cheatchecknum",
+	"duelscore",
+	"lastsidehit",
+	"lastlinehit",
+	"timeshit",
+	"timeshitprev",
+	"onconveyor",
+	"awayviewmobj",
+	"awayviewtics",
+	"spectator",
+	"spectatewait",
+	"bot",
+	"botvars",
+	"jointime",
+	"spectatorreentry",
+	"griefvalue",
+	"griefstrikes",
+	"griefwarned",
+	"typing_timer",
+	"typing_duration",
+	"kickstartaccel",
+	"autoring",
+	"stairjank",
+	"topdriftheld",
+	"topinfirst",
+	"splitscreenindex",
+	"stumbleindicator",
+	"wavedashindicator",
+	"trickindicator",
+	"whip",
+	"hand",
+	"flickyattacker",
+	"stoneshoe",
+	"toxomistercloud",
+	"fovadd",
+	"ping",
+	"publickey",
+	"loop",
+	"powerup",
+	"icecube",
+	"darkness_start",
+	"darkness_end",
+	NULL};
+
+static int player_fields_ref = LUA_NOREF;
+
 static int player_get(lua_State *L)
 {
 	player_t *plr = *((player_t **)luaL_checkudata(L, 1, META_PLAYER));
 	const char *field = luaL_checkstring(L, 2);
+	enum player_e fieldid = Lua_optoption(L, 2, -1, player_fields_ref);
 
 	if (!plr) {
-		if (fastcmp(field,"valid")) {
+		if (fieldid == player_valid) {
 			lua_pushboolean(L, false);
 			return 1;
 		}
 		return LUA_ErrInvalid(L, "player_t");
 	}
 
-	if (fastcmp(field,"valid"))
+	switch (fieldid)
+	{
+	case player_valid:
 		lua_pushboolean(L, true);
-	else if (fastcmp(field,"name"))
+		break;
+	case player_name:
 		lua_pushstring(L, player_names[plr-players]);
-	else if (fastcmp(field,"mo"))
+		break;
+	case player_mo:
 		LUA_PushUserdata(L, plr->mo, META_MOBJ);
-	else if (fastcmp(field,"cmd"))
+		break;
+	case player_cmd:
 		LUA_PushUserdata(L, &plr->cmd, META_TICCMD);
-	else if (fastcmp(field,"oldcmd"))
+		break;
+	case player_oldcmd:
 		LUA_PushUserdata(L, &plr->oldcmd, META_TICCMD);
-	else if (fastcmp(field,"respawn"))
+		break;
+	case player_respawn:
 		LUA_PushUserdata(L, &plr->respawn, META_RESPAWN);
-	else if (fastcmp(field,"playerstate"))
+		break;
+	case player_playerstate:
 		lua_pushinteger(L, plr->playerstate);
-	else if (fastcmp(field,"viewz"))
+		break;
+	case player_viewz:
 		lua_pushfixed(L, plr->viewz);
-	else if (fastcmp(field,"viewheight"))
+		break;
+	case player_viewheight:
 		lua_pushfixed(L, plr->viewheight);
-	else if (fastcmp(field,"skybox"))
+		break;
+	case player_skybox:
 		LUA_PushUserdata(L, &plr->skybox, META_SKYBOX);
-	else if (fastcmp(field,"viewrollangle"))
+		break;
+	case player_viewrollangle:
 		lua_pushangle(L, plr->viewrollangle);
-	else if (fastcmp(field, "tilt"))
+		break;
+	case player_tilt:
 		lua_pushangle(L, plr->tilt);
-	else if (fastcmp(field,"aiming"))
+		break;
+	case player_aiming:
 		lua_pushangle(L, plr->aiming);
-	else if (fastcmp(field,"drawangle"))
+		break;
+	case player_drawangle:
 		lua_pushangle(L, plr->drawangle);
-	else if (fastcmp(field,"karthud"))
+		break;
+	case player_karthud:
 		LUA_PushUserdata(L, plr->karthud, META_KARTHUD);
-	else if (fastcmp(field,"nocontrol"))
+		break;
+	case player_nocontrol:
 		lua_pushinteger(L, plr->nocontrol);
-	else if (fastcmp(field,"carry"))
+		break;
+	case player_carry:
 		lua_pushinteger(L, plr->carry);
-	else if (fastcmp(field,"dye"))
+		break;
+	case player_dye:
 		lua_pushinteger(L, plr->dye);
-	else if (fastcmp(field,"position"))
+		break;
+	case player_position:
 		lua_pushinteger(L, plr->position);
-	else if (fastcmp(field,"oldposition"))
+		break;
+	case player_oldposition:
 		lua_pushinteger(L, plr->oldposition);
-	else if (fastcmp(field,"positiondelay"))
+		break;
+	case player_positiondelay:
 		lua_pushinteger(L, plr->positiondelay);
-	else if (fastcmp(field,"leaderpenalty"))
+		break;
+	case player_leaderpenalty:
 		lua_pushinteger(L, plr->leaderpenalty);
-	else if (fastcmp(field,"teamposition"))
+		break;
+	case player_teamposition:
 		lua_pushinteger(L, plr->teamposition);
-	else if (fastcmp(field,"teamimportance"))
+		break;
+	case player_teamimportance:
 		lua_pushinteger(L, plr->teamimportance);
-	else if (fastcmp(field,"distancetofinish"))
+		break;
+	case player_distancetofinish:
 		lua_pushinteger(L, plr->distancetofinish);
-	else if (fastcmp(field,"distancetofinishprev"))
+		break;
+	case player_distancetofinishprev:
 		lua_pushinteger(L, plr->distancetofinishprev);
-	else if (fastcmp(field,"lastpickupdistance"))
+		break;
+	case player_lastpickupdistance:
 		lua_pushinteger(L, plr->lastpickupdistance);
-	else if (fastcmp(field,"lastpickuptype"))
+		break;
+	case player_lastpickuptype:
 		lua_pushinteger(L, plr->lastpickuptype);
-	else if (fastcmp(field,"currentwaypoint"))
+		break;
+	case player_currentwaypoint:
 		LUA_PushUserdata(L, plr->currentwaypoint, META_WAYPOINT);
-	else if (fastcmp(field,"nextwaypoint"))
+		break;
+	case player_nextwaypoint:
 		LUA_PushUserdata(L, plr->nextwaypoint, META_WAYPOINT);
-	else if (fastcmp(field,"ringshooter"))
+		break;
+	case player_ringshooter:
 		LUA_PushUserdata(L, plr->ringShooter, META_MOBJ);
-	else if (fastcmp(field,"airtime"))
+		break;
+	case player_airtime:
 		lua_pushinteger(L, plr->airtime);
-	else if (fastcmp(field,"lastairtime"))
+		break;
+	case player_lastairtime:
 		lua_pushinteger(L, plr->lastairtime);
-	else if (fastcmp(field,"bigwaypointgap"))
+		break;
+	case player_bigwaypointgap:
 		lua_pushinteger(L, plr->bigwaypointgap);
-	else if (fastcmp(field,"flashing"))
+		break;
+	case player_flashing:
 		lua_pushinteger(L, plr->flashing);
-	else if (fastcmp(field,"spinouttimer"))
+		break;
+	case player_spinouttimer:
 		lua_pushinteger(L, plr->spinouttimer);
-	else if (fastcmp(field,"spinouttype"))
+		break;
+	case player_spinouttype:
 		lua_pushinteger(L, plr->spinouttype);
-	else if (fastcmp(field,"instashield"))
+		break;
+	case player_instashield:
 		lua_pushinteger(L, plr->instashield);
-	else if (fastcmp(field,"nullhitlag"))
+		break;
+	case player_nullhitlag:
 		lua_pushinteger(L, plr->nullHitlag);
-	else if (fastcmp(field,"wipeoutslow"))
+		break;
+	case player_wipeoutslow:
 		lua_pushinteger(L, plr->wipeoutslow);
-	else if (fastcmp(field,"justbumped"))
+		break;
+	case player_justbumped:
 		lua_pushinteger(L, plr->justbumped);
-	else if (fastcmp(field,"noebrakemagnet"))
+		break;
+	case player_noebrakemagnet:
 		lua_pushinteger(L, plr->noEbrakeMagnet);
-	else if (fastcmp(field,"wallspikedampen"))
+		break;
+	case player_wallspikedampen:
 		lua_pushinteger(L, plr->wallSpikeDampen);
-	else if (fastcmp(field,"tumblebounces"))
+		break;
+	case player_tumblebounces:
 		lua_pushinteger(L, plr->tumbleBounces);
-	else if (fastcmp(field,"tumbleheight"))
+		break;
+	case player_tumbleheight:
 		lua_pushinteger(L, plr->tumbleHeight);
-	else if (fastcmp(field,"stunned"))
+		break;
+	case player_stunned:
 		lua_pushinteger(L, plr->stunned);
-	else if (fastcmp(field,"flybot"))
+		break;
+	case player_flybot:
 		LUA_PushUserdata(L, plr->flybot, META_MOBJ);
-	else if (fastcmp(field,"justdi"))
+		break;
+	case player_justdi:
 		lua_pushinteger(L, plr->justDI);
-	else if (fastcmp(field,"flipdi"))
+		break;
+	case player_flipdi:
 		lua_pushboolean(L, plr->flipDI);
-	else if (fastcmp(field,"cangrabitems"))
+		break;
+	case player_cangrabitems:
 		lua_pushinteger(L, plr->cangrabitems);
-	else if (fastcmp(field,"analoginput"))
+		break;
+	case player_analoginput:
 		lua_pushboolean(L, plr->analoginput);
-	else if (fastcmp(field,"transfer"))
+		break;
+	case player_transfer:
 		lua_pushfixed(L, plr->transfer);
-	else if (fastcmp(field,"markedfordeath"))
+		break;
+	case player_markedfordeath:
 		lua_pushboolean(L, plr->markedfordeath);
-	else if (fastcmp(field,"mfdfinish"))
+		break;
+	case player_mfdfinish:
 		lua_pushboolean(L, plr->mfdfinish);
-	else if (fastcmp(field,"incontrol"))
+		break;
+	case player_incontrol:
 		lua_pushboolean(L, plr->incontrol);
-	else if (fastcmp(field,"progressivethrust"))
+		break;
+	case player_progressivethrust:
 		lua_pushinteger(L, plr->progressivethrust);
-	else if (fastcmp(field,"ringvisualwarning"))
+		break;
+	case player_ringvisualwarning:
 		lua_pushinteger(L, plr->ringvisualwarning);
-	else if (fastcmp(field,"bailcharge"))
+		break;
+	case player_bailcharge:
 		lua_pushinteger(L, plr->bailcharge);
-	else if (fastcmp(field,"baildrop"))
+		break;
+	case player_baildrop:
 		lua_pushinteger(L, plr->baildrop);
-	else if (fastcmp(field,"bailhitlag"))
+		break;
+	case player_bailhitlag:
 		lua_pushboolean(L, plr->bailhitlag);
-	else if (fastcmp(field,"dotrickfx"))
+		break;
+	case player_dotrickfx:
 		lua_pushboolean(L, plr->dotrickfx);
-	else if (fastcmp(field,"stingfx"))
+		break;
+	case player_stingfx:
 		lua_pushboolean(L, plr->stingfx);
-	else if (fastcmp(field,"bumperinflate"))
+		break;
+	case player_bumperinflate:
 		lua_pushinteger(L, plr->bumperinflate);
-	else if (fastcmp(field,"ringboxdelay"))
+		break;
+	case player_ringboxdelay:
 		lua_pushinteger(L, plr->ringboxdelay);
-	else if (fastcmp(field,"ringboxaward"))
+		break;
+	case player_ringboxaward:
 		lua_pushinteger(L, plr->ringboxaward);
-	else if (fastcmp(field,"lastringboost"))
+		break;
+	case player_lastringboost:
 		lua_pushinteger(L, plr->lastringboost);
-	else if (fastcmp(field,"amps"))
+		break;
+	case player_amps:
 		lua_pushinteger(L, plr->amps);
-	else if (fastcmp(field,"recentamps"))
+		break;
+	case player_recentamps:
 		lua_pushinteger(L, plr->recentamps);
-	else if (fastcmp(field,"amppickup"))
+		break;
+	case player_amppickup:
 		lua_pushinteger(L, plr->amppickup);
-	else if (fastcmp(field,"ampspending"))
+		break;
+	case player_ampspending:
 		lua_pushinteger(L, plr->ampspending);
-	else if (fastcmp(field,"itemflags"))
+		break;
+	case player_itemflags:
 		lua_pushinteger(L, plr->itemflags);
-	else if (fastcmp(field,"outrun"))
+		break;
+	case player_outrun:
 		lua_pushfixed(L, plr->outrun);
-	else if (fastcmp(field,"drift"))
+		break;
+	case player_drift:
 		lua_pushinteger(L, plr->drift);
-	else if (fastcmp(field,"driftcharge"))
+		break;
+	case player_driftcharge:
 		lua_pushinteger(L, plr->driftcharge);
-	else if (fastcmp(field,"driftboost"))
+		break;
+	case player_driftboost:
 		lua_pushinteger(L, plr->driftboost);
-	else if (fastcmp(field,"strongdriftboost"))
+		break;
+	case player_strongdriftboost:
 		lua_pushinteger(L, plr->strongdriftboost);
-	else if (fastcmp(field,"gateboost"))
+		break;
+	case player_gateboost:
 		lua_pushinteger(L, plr->gateBoost);
-	else if (fastcmp(field,"gatesound"))
+		break;
+	case player_gatesound:
 		lua_pushinteger(L, plr->gateSound);
-	else if (fastcmp(field,"startboost"))
+		break;
+	case player_startboost:
 		lua_pushinteger(L, plr->startboost);
-	else if (fastcmp(field,"neostartboost"))
+		break;
+	case player_neostartboost:
 		lua_pushinteger(L, plr->neostartboost);
-	else if (fastcmp(field,"dropdashboost"))
+		break;
+	case player_dropdashboost:
 		lua_pushinteger(L, plr->dropdashboost);
-	else if (fastcmp(field,"aciddropdashboost"))
+		break;
+	case player_aciddropdashboost:
 		lua_pushinteger(L, plr->aciddropdashboost);
-	else if (fastcmp(field,"aizdriftstrat"))
+		break;
+	case player_aizdriftstrat:
 		lua_pushinteger(L, plr->aizdriftstrat);
-	else if (fastcmp(field,"aizdriftextend"))
+		break;
+	case player_aizdriftextend:
 		lua_pushinteger(L, plr->aizdriftextend);
-	else if (fastcmp(field,"aizdrifttilt"))
+		break;
+	case player_aizdrifttilt:
 		lua_pushinteger(L, plr->aizdrifttilt);
-	else if (fastcmp(field,"aizdriftturn"))
+		break;
+	case player_aizdriftturn:
 		lua_pushinteger(L, plr->aizdriftturn);
-	else if (fastcmp(field,"underwatertilt"))
+		break;
+	case player_underwatertilt:
 		lua_pushinteger(L, plr->underwatertilt);
-	else if (fastcmp(field,"offroad"))
+		break;
+	case player_offroad:
 		lua_pushfixed(L, plr->offroad);
-	else if (fastcmp(field,"tiregrease"))
+		break;
+	case player_tiregrease:
 		lua_pushinteger(L, plr->tiregrease);
-	else if (fastcmp(field,"springstars"))
+		break;
+	case player_springstars:
 		lua_pushinteger(L, plr->springstars);
-	else if (fastcmp(field,"springcolor"))
+		break;
+	case player_springcolor:
 		lua_pushinteger(L, plr->springcolor);
-	else if (fastcmp(field,"dashpadcooldown"))
+		break;
+	case player_dashpadcooldown:
 		lua_pushinteger(L, plr->dashpadcooldown);
-	else if (fastcmp(field,"spindash"))
+		break;
+	case player_spindash:
 		lua_pushinteger(L, plr->spindash);
-	else if (fastcmp(field,"spindashspeed"))
+		break;
+	case player_spindashspeed:
 		lua_pushinteger(L, plr->spindashspeed);
-	else if (fastcmp(field,"spindashboost"))
+		break;
+	case player_spindashboost:
 		lua_pushinteger(L, plr->spindashboost);
-	else if (fastcmp(field,"ringboostinprogress"))
+		break;
+	case player_ringboostinprogress:
 		lua_pushinteger(L, plr->ringboostinprogress);
-	else if (fastcmp(field,"fastfall"))
+		break;
+	case player_fastfall:
 		lua_pushfixed(L, plr->fastfall);
-	else if (fastcmp(field,"fastfallbase"))
+		break;
+	case player_fastfallbase:
 		lua_pushfixed(L, plr->fastfallBase);
-	else if (fastcmp(field,"numboosts"))
+		break;
+	case player_numboosts:
 		lua_pushinteger(L, plr->numboosts);
-	else if (fastcmp(field,"boostpower"))
+		break;
+	case player_boostpower:
 		lua_pushinteger(L, plr->boostpower);
-	else if (fastcmp(field,"speedboost"))
+		break;
+	case player_speedboost:
 		lua_pushinteger(L, plr->speedboost);
-	else if (fastcmp(field,"accelboost"))
+		break;
+	case player_accelboost:
 		lua_pushinteger(L, plr->accelboost);
-	else if (fastcmp(field,"handleboost"))
+		break;
+	case player_handleboost:
 		lua_pushinteger(L, plr->handleboost);
-	else if (fastcmp(field,"boostangle"))
+		break;
+	case player_boostangle:
 		lua_pushangle(L, plr->boostangle);
-	else if (fastcmp(field,"stonedrag"))
+		break;
+	case player_stonedrag:
 		lua_pushfixed(L, plr->stonedrag);
-	else if (fastcmp(field,"draftpower"))
+		break;
+	case player_draftpower:
 		lua_pushinteger(L, plr->draftpower);
-	else if (fastcmp(field,"draftleeway"))
+		break;
+	case player_draftleeway:
 		lua_pushinteger(L, plr->draftleeway);
-	else if (fastcmp(field,"lastdraft"))
+		break;
+	case player_lastdraft:
 		lua_pushinteger(L, plr->lastdraft);
-	else if (fastcmp(field,"tripwirestate"))
+		break;
+	case player_tripwirestate:
 		lua_pushinteger(L, plr->tripwireState);
-	else if (fastcmp(field,"tripwirepass"))
+		break;
+	case player_tripwirepass:
 		lua_pushinteger(L, plr->tripwirePass);
-	else if (fastcmp(field,"fakeboost"))
+		break;
+	case player_fakeboost:
 		lua_pushinteger(L, plr->fakeBoost);
-	else if (fastcmp(field,"subsonicleniency"))
+		break;
+	case player_subsonicleniency:
 		lua_pushinteger(L, plr->subsonicleniency);
-	else if (fastcmp(field,"tripwireleniency"))
+		break;
+	case player_tripwireleniency:
 		lua_pushinteger(L, plr->tripwireLeniency);
-	else if (fastcmp(field,"tripwireairleniency"))
+		break;
+	case player_tripwireairleniency:
 		lua_pushinteger(L, plr->tripwireAirLeniency);
-	else if (fastcmp(field,"tripwirerebounddelay"))
+		break;
+	case player_tripwirerebounddelay:
 		lua_pushinteger(L, plr->tripwireReboundDelay);
-	else if (fastcmp(field,"shrinklaserdelay"))
+		break;
+	case player_shrinklaserdelay:
 		lua_pushinteger(L, plr->shrinkLaserDelay);
-	else if (fastcmp(field,"eggmantransferdelay"))
+		break;
+	case player_eggmantransferdelay:
 		lua_pushinteger(L, plr->eggmanTransferDelay);
-	else if (fastcmp(field,"wavedash"))
+		break;
+	case player_wavedash:
 		lua_pushinteger(L, plr->wavedash);
-	else if (fastcmp(field,"wavedashleft"))
+		break;
+	case player_wavedashleft:
 		lua_pushinteger(L, plr->wavedashleft);
-	else if (fastcmp(field,"wavedashright"))
+		break;
+	case player_wavedashright:
 		lua_pushinteger(L, plr->wavedashright);
-	else if (fastcmp(field,"wavedashdelay"))
+		break;
+	case player_wavedashdelay:
 		lua_pushinteger(L, plr->wavedashdelay);
-	else if (fastcmp(field,"wavedashboost"))
+		break;
+	case player_wavedashboost:
 		lua_pushinteger(L, plr->wavedashboost);
-	else if (fastcmp(field,"overdrive"))
+		break;
+	case player_overdrive:
 		lua_pushinteger(L, plr->overdrive);
-	else if (fastcmp(field,"overshield"))
+		break;
+	case player_overshield:
 		lua_pushinteger(L, plr->overshield);
-	else if (fastcmp(field,"wavedashpower"))
+		break;
+	case player_wavedashpower:
 		lua_pushinteger(L, plr->wavedashpower);
-	else if (fastcmp(field,"overdrivepower"))
+		break;
+	case player_overdrivepower:
 		lua_pushfixed(L, plr->overdrivepower);
-	else if (fastcmp(field,"overdriveready"))
+		break;
+	case player_overdriveready:
 		lua_pushinteger(L, plr->overdriveready);
-	else if (fastcmp(field,"overdrivelenient"))
+		break;
+	case player_overdrivelenient:
 		lua_pushboolean(L, plr->overdrivelenient);
-	else if (fastcmp(field,"trickcharge"))
+		break;
+	case player_trickcharge:
 		lua_pushinteger(L, plr->trickcharge);
-	else if (fastcmp(field,"infinitether"))
+		break;
+	case player_infinitether:
 		lua_pushinteger(L, plr->infinitether);
-	else if (fastcmp(field,"finalfailsafe"))
+		break;
+	case player_finalfailsafe:
 		lua_pushinteger(L, plr->finalfailsafe);
-	else if (fastcmp(field,"freeringshootercooldown"))
+		break;
+	case player_freeringshootercooldown:
 		lua_pushinteger(L, plr->freeRingShooterCooldown);
-	else if (fastcmp(field,"lastsafelap"))
+		break;
+	case player_lastsafelap:
 		lua_pushinteger(L, plr->lastsafelap);
-	else if (fastcmp(field,"lastsafecheatcheck"))
+		break;
+	case player_lastsafecheatcheck:
 		lua_pushinteger(L, plr->lastsafecheatcheck);
-	else if (fastcmp(field,"ignoreairtimeleniency"))
+		break;
+	case player_ignoreairtimeleniency:
 		lua_pushinteger(L, plr->ignoreAirtimeLeniency);
-	else if (fastcmp(field,"bubbledrag"))
+		break;
+	case player_bubbledrag:
 		lua_pushboolean(L, plr->bubbledrag);
-	else if (fastcmp(field,"topaccel"))
+		break;
+	case player_topaccel:
 		lua_pushinteger(L, plr->topAccel);
-	else if (fastcmp(field,"vortexboost"))
+		break;
+	case player_vortexboost:
 		lua_pushinteger(L, plr->vortexBoost);
-	else if (fastcmp(field,"instawhipcharge"))
+		break;
+	case player_instawhipcharge:
 		lua_pushinteger(L, plr->instaWhipCharge);
-	else if (fastcmp(field,"pitblame"))
+		break;
+	case player_pitblame:
 		lua_pushinteger(L, plr->pitblame);
-	else if (fastcmp(field,"defenselockout"))
+		break;
+	case player_defenselockout:
 		lua_pushinteger(L, plr->defenseLockout);
-	else if (fastcmp(field,"instawhipchargelockout"))
+		break;
+	case player_instawhipchargelockout:
 		lua_pushinteger(L, plr->instaWhipChargeLockout);
-	else if (fastcmp(field,"oldguard"))
+		break;
+	case player_oldguard:
 		lua_pushboolean(L, plr->oldGuard);
-	else if (fastcmp(field,"powerupvfxtimer"))
+		break;
+	case player_powerupvfxtimer:
 		lua_pushinteger(L, plr->powerupVFXTimer);
-	else if (fastcmp(field,"preventfailsafe"))
+		break;
+	case player_preventfailsafe:
 		lua_pushinteger(L, plr->preventfailsafe);
-	else if (fastcmp(field,"tripwireunstuck"))
+		break;
+	case player_tripwireunstuck:
 		lua_pushinteger(L, plr->tripwireUnstuck);
-	else if (fastcmp(field,"bumpunstuck"))
+		break;
+	case player_bumpunstuck:
 		lua_pushinteger(L, plr->bumpUnstuck);
-	else if (fastcmp(field,"handtimer"))
+		break;
+	case player_handtimer:
 		lua_pushinteger(L, plr->handtimer);
-	else if (fastcmp(field,"besthanddirection"))
+		break;
+	case player_besthanddirection:
 		lua_pushangle(L, plr->besthanddirection);
-	else if (fastcmp(field,"itemroulette"))
+		break;
+	case player_itemroulette:
 		LUA_PushUserdata(L, &plr->itemRoulette, META_ITEMROULETTE);
-	else if (fastcmp(field,"itemtype"))
+		break;
+	case player_itemtype:
 		lua_pushinteger(L, plr->itemtype);
-	else if (fastcmp(field,"itemamount"))
+		break;
+	case player_itemamount:
 		lua_pushinteger(L, plr->itemamount);
-	else if (fastcmp(field,"backupitemtype"))
+		break;
+	case player_backupitemtype:
 		lua_pushinteger(L, plr->backupitemtype);
-	else if (fastcmp(field,"backupitemamount"))
+		break;
+	case player_backupitemamount:
 		lua_pushinteger(L, plr->backupitemamount);
-	else if (fastcmp(field,"throwdir"))
+		break;
+	case player_throwdir:
 		lua_pushinteger(L, plr->throwdir);
-	else if (fastcmp(field,"sadtimer"))
+		break;
+	case player_sadtimer:
 		lua_pushinteger(L, plr->sadtimer);
-	else if (fastcmp(field,"rings"))
+		break;
+	case player_rings:
 		lua_pushinteger(L, plr->rings);
-	else if (fastcmp(field,"hudrings"))
+		break;
+	case player_hudrings:
 		lua_pushinteger(L, plr->hudrings);
-	else if (fastcmp(field,"pickuprings"))
+		break;
+	case player_pickuprings:
 		lua_pushinteger(L, plr->pickuprings);
-	else if (fastcmp(field,"ringdelay"))
+		break;
+	case player_ringdelay:
 		lua_pushinteger(L, plr->ringdelay);
-	else if (fastcmp(field,"ringboost"))
+		break;
+	case player_ringboost:
 		lua_pushinteger(L, plr->ringboost);
-	else if (fastcmp(field,"momentboost"))
+		break;
+	case player_momentboost:
 		lua_pushinteger(L, plr->momentboost);
-	else if (fastcmp(field,"sparkleanim"))
+		break;
+	case player_sparkleanim:
 		lua_pushinteger(L, plr->sparkleanim);
-	else if (fastcmp(field,"superring"))
+		break;
+	case player_superring:
 		lua_pushinteger(L, plr->superring);
-	else if (fastcmp(field,"superringdisplay"))
+		break;
+	case player_superringdisplay:
 		lua_pushinteger(L, plr->superringdisplay);
-	else if (fastcmp(field,"superringpeak"))
+		break;
+	case player_superringpeak:
 		lua_pushinteger(L, plr->superringpeak);
-	else if (fastcmp(field,"superringalert"))
+		break;
+	case player_superringalert:
 		lua_pushinteger(L, plr->superringalert);
-	else if (fastcmp(field,"nextringaward"))
+		break;
+	case player_nextringaward:
 		lua_pushinteger(L, plr->nextringaward);
-	else if (fastcmp(field,"ringvolume"))
+		break;
+	case player_ringvolume:
 		lua_pushinteger(L, plr->ringvolume);
-	else if (fastcmp(field,"ringtransparency"))
+		break;
+	case player_ringtransparency:
 		lua_pushinteger(L, plr->ringtransparency);
-	else if (fastcmp(field,"ringburst"))
+		break;
+	case player_ringburst:
 		lua_pushinteger(L, plr->ringburst);
-	else if (fastcmp(field,"curshield"))
+		break;
+	case player_curshield:
 		lua_pushinteger(L, plr->curshield);
-	else if (fastcmp(field,"bubblecool"))
+		break;
+	case player_bubblecool:
 		lua_pushinteger(L, plr->bubblecool);
-	else if (fastcmp(field,"bubbleblowup"))
+		break;
+	case player_bubbleblowup:
 		lua_pushinteger(L, plr->bubbleblowup);
-	else if (fastcmp(field,"flamedash"))
+		break;
+	case player_flamedash:
 		lua_pushinteger(L, plr->flamedash);
-	else if (fastcmp(field,"counterdash"))
+		break;
+	case player_counterdash:
 		lua_pushinteger(L, plr->counterdash);
-	else if (fastcmp(field,"flamemeter"))
+		break;
+	case player_flamemeter:
 		lua_pushinteger(L, plr->flamemeter);
-	else if (fastcmp(field,"flamelength"))
+		break;
+	case player_flamelength:
 		lua_pushinteger(L, plr->flamelength);
-	else if (fastcmp(field,"lightningcharge"))
+		break;
+	case player_lightningcharge:
 		lua_pushinteger(L, plr->lightningcharge);
-	else if (fastcmp(field,"ballhogcharge"))
+		break;
+	case player_ballhogcharge:
 		lua_pushinteger(L, plr->ballhogcharge);
-	else if (fastcmp(field,"ballhogburst"))
+		break;
+	case player_ballhogburst:
 		lua_pushinteger(L, plr->ballhogburst);
-	else if (fastcmp(field,"ballhogtap"))
+		break;
+	case player_ballhogtap:
 		lua_pushinteger(L, plr->ballhogtap);
-	else if (fastcmp(field,"ballhogreticule"))
+		break;
+	case player_ballhogreticule:
 		LUA_PushUserdata(L, plr->ballhogreticule, META_MOBJ);
-	else if (fastcmp(field,"hyudorotimer"))
+		break;
+	case player_hyudorotimer:
 		lua_pushinteger(L, plr->hyudorotimer);
-	else if (fastcmp(field,"stealingtimer"))
+		break;
+	case player_stealingtimer:
 		lua_pushinteger(L, plr->stealingtimer);
-	else if (fastcmp(field,"hoverhyudoro"))
+		break;
+	case player_hoverhyudoro:
 		LUA_PushUserdata(L, plr->hoverhyudoro, META_MOBJ);
-	else if (fastcmp(field,"sneakertimer"))
+		break;
+	case player_sneakertimer:
 		lua_pushinteger(L, plr->sneakertimer);
-	else if (fastcmp(field,"numsneakers"))
+		break;
+	case player_numsneakers:
 		lua_pushinteger(L, plr->numsneakers);
-	else if (fastcmp(field,"panelsneakertimer"))
+		break;
+	case player_panelsneakertimer:
 		lua_pushinteger(L, plr->panelsneakertimer);
-	else if (fastcmp(field,"numpanelsneakers"))
+		break;
+	case player_numpanelsneakers:
 		lua_pushinteger(L, plr->numpanelsneakers);
-	else if (fastcmp(field,"weaksneakertimer"))
+		break;
+	case player_weaksneakertimer:
 		lua_pushinteger(L, plr->weaksneakertimer);
-	else if (fastcmp(field,"numweaksneakers"))
+		break;
+	case player_numweaksneakers:
 		lua_pushinteger(L, plr->numweaksneakers);
-	else if (fastcmp(field,"floorboost"))
+		break;
+	case player_floorboost:
 		lua_pushinteger(L, plr->floorboost);
-	else if (fastcmp(field,"growshrinktimer"))
+		break;
+	case player_growshrinktimer:
 		lua_pushinteger(L, plr->growshrinktimer);
-	else if (fastcmp(field,"rocketsneakertimer"))
+		break;
+	case player_rocketsneakertimer:
 		lua_pushinteger(L, plr->rocketsneakertimer);
-	else if (fastcmp(field,"invincibilitytimer"))
+		break;
+	case player_invincibilitytimer:
 		lua_pushinteger(L, plr->invincibilitytimer);
-	else if (fastcmp(field,"invincibilityextensions"))
+		break;
+	case player_invincibilityextensions:
 		lua_pushinteger(L, plr->invincibilityextensions);
-	else if (fastcmp(field,"loneliness"))
+		break;
+	case player_loneliness:
 		lua_pushinteger(L, plr->loneliness);
-	else if (fastcmp(field,"eggmanexplode"))
+		break;
+	case player_eggmanexplode:
 		lua_pushinteger(L, plr->eggmanexplode);
-	else if (fastcmp(field,"eggmanblame"))
+		break;
+	case player_eggmanblame:
 		lua_pushinteger(L, plr->eggmanblame);
-	else if (fastcmp(field,"bananadrag"))
+		break;
+	case player_bananadrag:
 		lua_pushinteger(L, plr->bananadrag);
-	else if (fastcmp(field,"lastjawztarget"))
+		break;
+	case player_lastjawztarget:
 		lua_pushinteger(L, plr->lastjawztarget);
-	else if (fastcmp(field,"jawztargetdelay"))
+		break;
+	case player_jawztargetdelay:
 		lua_pushinteger(L, plr->jawztargetdelay);
-	else if (fastcmp(field,"confirmvictim"))
+		break;
+	case player_confirmvictim:
 		lua_pushinteger(L, plr->confirmVictim);
-	else if (fastcmp(field,"confirmvictimdelay"))
+		break;
+	case player_confirmvictimdelay:
 		lua_pushinteger(L, plr->confirmVictimDelay);
-	else if (fastcmp(field,"glancedir"))
+		break;
+	case player_glancedir:
 		lua_pushinteger(L, plr->glanceDir);
-	else if (fastcmp(field,"breathtimer"))
+		break;
+	case player_breathtimer:
 		lua_pushinteger(L, plr->breathTimer);
-	else if (fastcmp(field,"trickpanel"))
+		break;
+	case player_trickpanel:
 		lua_pushinteger(L, plr->trickpanel);
-	else if (fastcmp(field,"tricktime"))
+		break;
+	case player_tricktime:
 		lua_pushinteger(L, plr->tricktime);
-	else if (fastcmp(field,"trickboostpower"))
+		break;
+	case player_trickboostpower:
 		lua_pushfixed(L, plr->trickboostpower);
-	else if (fastcmp(field,"trickboostdecay"))
+		break;
+	case player_trickboostdecay:
 		lua_pushinteger(L, plr->trickboostdecay);
-	else if (fastcmp(field,"trickboost"))
+		break;
+	case player_trickboost:
 		lua_pushinteger(L, plr->trickboost);
-	else if (fastcmp(field,"tricklock"))
+		break;
+	case player_tricklock:
 		lua_pushinteger(L, plr->tricklock);
-	else if (fastcmp(field,"dashringpulltics"))
+		break;
+	case player_dashringpulltics:
 		lua_pushinteger(L, plr->dashRingPullTics);
-	else if (fastcmp(field,"dashringpushtics"))
+		break;
+	case player_dashringpushtics:
 		lua_pushinteger(L, plr->dashRingPushTics);
-	else if (fastcmp(field,"pullup"))
+		break;
+	case player_pullup:
 		lua_pushboolean(L, plr->pullup);
-	else if (fastcmp(field,"finalized"))
+		break;
+	case player_finalized:
 		lua_pushboolean(L, plr->finalized);
-	else if (fastcmp(field,"ebrakefor"))
+		break;
+	case player_ebrakefor:
 		lua_pushinteger(L, plr->ebrakefor);
-	else if (fastcmp(field,"roundscore"))
+		break;
+	case player_roundscore:
 		lua_pushinteger(L, plr->roundscore);
-	else if (fastcmp(field,"emeralds"))
+		break;
+	case player_emeralds:
 		lua_pushinteger(L, plr->emeralds);
-	else if (fastcmp(field,"karmadelay"))
+		break;
+	case player_karmadelay:
 		lua_pushinteger(L, plr->karmadelay);
-	else if (fastcmp(field,"spheres"))
+		break;
+	case player_spheres:
 		lua_pushinteger(L, plr->spheres);
-	else if (fastcmp(field,"spheredigestion"))
+		break;
+	case player_spheredigestion:
 		lua_pushinteger(L, plr->spheredigestion);
-	else if (fastcmp(field,"pflags"))
+		break;
+	case player_pflags:
 		lua_pushinteger(L, plr->pflags);
-	else if (fastcmp(field,"pflags2"))
+		break;
+	case player_pflags2:
 		lua_pushinteger(L, plr->pflags2);
-	else if (fastcmp(field,"panim"))
+		break;
+	case player_panim:
 		lua_pushinteger(L, plr->panim);
-	else if (fastcmp(field,"flashcount"))
+		break;
+	case player_flashcount:
 		lua_pushinteger(L, plr->flashcount);
-	else if (fastcmp(field,"flashpal"))
+		break;
+	case player_flashpal:
 		lua_pushinteger(L, plr->flashpal);
-	else if (fastcmp(field,"skincolor"))
+		break;
+	case player_skincolor:
 		lua_pushinteger(L, plr->skincolor);
-	else if (fastcmp(field,"skin"))
+		break;
+	case player_skin:
 		lua_pushinteger(L, plr->skin);
-	else if (fastcmp(field,"fakeskin"))
+		break;
+	case player_fakeskin:
 		lua_pushinteger(L, plr->fakeskin);
-	else if (fastcmp(field,"lastfakeskin"))
+		break;
+	case player_lastfakeskin:
 		lua_pushinteger(L, plr->lastfakeskin);
-	else if (fastcmp(field,"score"))
+		break;
+	case player_score:
 		lua_pushinteger(L, plr->score);
+		break;
 	// SRB2kart
-	else if (fastcmp(field,"kartspeed"))
+	case player_kartspeed:
 		lua_pushinteger(L, plr->kartspeed);
-	else if (fastcmp(field,"kartweight"))
+		break;
+	case player_kartweight:
 		lua_pushinteger(L, plr->kartweight);
-	else if (fastcmp(field,"followerskin"))
+		break;
+	case player_followerskin:
 		lua_pushinteger(L, plr->followerskin);
-	else if (fastcmp(field,"followerready"))
+		break;
+	case player_followerready:
 		lua_pushboolean(L, plr->followerready);
-	else if (fastcmp(field,"followercolor"))
+		break;
+	case player_followercolor:
 		lua_pushinteger(L, plr->followercolor);
-	else if (fastcmp(field,"follower"))
+		break;
+	case player_follower:
 		LUA_PushUserdata(L, plr->follower, META_MOBJ);
-	else if (fastcmp(field,"prefskin"))
+		break;
+	case player_prefskin:
 		lua_pushinteger(L, plr->prefskin);
-	else if (fastcmp(field,"prefcolor"))
+		break;
+	case player_prefcolor:
 		lua_pushinteger(L, plr->prefcolor);
-	else if (fastcmp(field,"preffollower"))
+		break;
+	case player_preffollower:
 		lua_pushinteger(L, plr->preffollower);
-	else if (fastcmp(field,"preffollowercolor"))
+		break;
+	case player_preffollowercolor:
 		lua_pushinteger(L, plr->preffollowercolor);
+		break;
 	//
 
 	// rideroids
-	else if (fastcmp(field,"rideroid"))
+	case player_rideroid:
 		lua_pushboolean(L, plr->rideroid);
-	else if (fastcmp(field,"rdnodepull"))
+		break;
+	case player_rdnodepull:
 		lua_pushboolean(L, plr->rdnodepull);
-	else if (fastcmp(field,"rideroidangle"))
+		break;
+	case player_rideroidangle:
 		lua_pushinteger(L, plr->rideroidangle);
-	else if (fastcmp(field,"rideroidspeed"))
+		break;
+	case player_rideroidspeed:
 		lua_pushinteger(L, plr->rideroidspeed);
-	else if (fastcmp(field,"rideroidrollangle"))
+		break;
+	case player_rideroidrollangle:
 		lua_pushinteger(L, plr->rideroidrollangle);
-	else if (fastcmp(field,"rdaddmomx"))
+		break;
+	case player_rdaddmomx:
 		lua_pushinteger(L, plr->rdaddmomx);
-	else if (fastcmp(field,"rdaddmomy"))
+		break;
+	case player_rdaddmomy:
 		lua_pushinteger(L, plr->rdaddmomy);
-	else if (fastcmp(field,"rdaddmomz"))
+		break;
+	case player_rdaddmomz:
 		lua_pushinteger(L, plr->rdaddmomz);
+		break;
 
 	// bungee
-	else if (fastcmp(field,"bungee"))
+	case player_bungee:
 		lua_pushinteger(L, plr->bungee);
+		break;
 
 	// dlz hover
-	else if (fastcmp(field,"lasthover"))
+	case player_lasthover:
 		lua_pushinteger(L, plr->lasthover);
+		break;
 
 	// dlz rocket
-	else if (fastcmp(field,"dlzrocket"))
+	case player_dlzrocket:
 		lua_pushinteger(L, plr->dlzrocket);
-	else if (fastcmp(field,"dlzrocketangle"))
+		break;
+	case player_dlzrocketangle:
 		lua_pushinteger(L, plr->dlzrocketangle);
-	else if (fastcmp(field,"dlzrocketanglev"))
+		break;
+	case player_dlzrocketanglev:
 		lua_pushinteger(L, plr->dlzrocketanglev);
-	else if (fastcmp(field,"dlzrocketspd"))
+		break;
+	case player_dlzrocketspd:
 		lua_pushinteger(L, plr->dlzrocketspd);
+		break;
 
 	// seasaws
-	else if (fastcmp(field,"seasaw"))
+	case player_seasaw:
 		lua_pushboolean(L, plr->seasaw);
-	else if (fastcmp(field,"seasawcooldown"))
+		break;
+	case player_seasawcooldown:
 		lua_pushinteger(L, plr->seasawcooldown);
-	else if (fastcmp(field,"seasawdist"))
+		break;
+	case player_seasawdist:
 		lua_pushinteger(L, plr->seasawdist);
-	else if (fastcmp(field,"seasawangle"))
+		break;
+	case player_seasawangle:
 		lua_pushinteger(L, plr->seasawangle);
-	else if (fastcmp(field,"seasawangleadd"))
+		break;
+	case player_seasawangleadd:
 		lua_pushinteger(L, plr->seasawangleadd);
-	else if (fastcmp(field,"seasawmoreangle"))
+		break;
+	case player_seasawmoreangle:
 		lua_pushinteger(L, plr->seasawmoreangle);
-	else if (fastcmp(field,"seasawdir"))
+		break;
+	case player_seasawdir:
 		lua_pushboolean(L, plr->seasawdir);
+		break;
 
 	// turbine
-	else if (fastcmp(field,"turbine"))
+	case player_turbine:
 		lua_pushinteger(L, plr->turbine);
-	else if (fastcmp(field,"turbineangle"))
+		break;
+	case player_turbineangle:
 		lua_pushinteger(L, plr->turbineangle);
-	else if (fastcmp(field,"turbineheight"))
+		break;
+	case player_turbineheight:
 		lua_pushinteger(L, plr->turbineheight);
-	else if (fastcmp(field,"turbinespd"))
+		break;
+	case player_turbinespd:
 		lua_pushinteger(L, plr->turbinespd);
+		break;
 
 	//clouds
-	else if (fastcmp(field,"cloud"))
+	case player_cloud:
 		lua_pushinteger(L, plr->cloud);
-	else if (fastcmp(field,"cloudlaunch"))
+		break;
+	case player_cloudlaunch:
 		lua_pushinteger(L, plr->cloudlaunch);
-	else if (fastcmp(field,"cloudbuf"))
+		break;
+	case player_cloudbuf:
 		lua_pushinteger(L, plr->cloudbuf);
+		break;
 
 	//tulips
-	else if (fastcmp(field,"tulip"))
+	case player_tulip:
 		lua_pushinteger(L, plr->tulip);
-	else if (fastcmp(field,"tuliplaunch"))
+		break;
+	case player_tuliplaunch:
 		lua_pushinteger(L, plr->tuliplaunch);
-	else if (fastcmp(field,"tulipbuf"))
+		break;
+	case player_tulipbuf:
 		lua_pushinteger(L, plr->tulipbuf);
+		break;
 
-	else if (fastcmp(field,"charflags"))
+	case player_charflags:
 		lua_pushinteger(L, plr->charflags);
-	else if (fastcmp(field,"followitem"))
+		break;
+	case player_followitem:
 		lua_pushinteger(L, plr->followitem);
-	else if (fastcmp(field,"followmobj"))
+		break;
+	case player_followmobj:
 		LUA_PushUserdata(L, plr->followmobj, META_MOBJ);
-	else if (fastcmp(field,"lives"))
+		break;
+	case player_lives:
 		lua_pushinteger(L, plr->lives);
-	else if (fastcmp(field,"xtralife"))
+		break;
+	case player_xtralife:
 		lua_pushinteger(L, plr->xtralife);
-	else if (fastcmp(field,"speed"))
+		break;
+	case player_speed:
 		lua_pushfixed(L, plr->speed);
-	else if (fastcmp(field,"lastspeed"))
+		break;
+	case player_lastspeed:
 		lua_pushfixed(L, plr->lastspeed);
-	else if (fastcmp(field,"deadtimer"))
+		break;
+	case player_deadtimer:
 		lua_pushinteger(L, plr->deadtimer);
-	else if (fastcmp(field,"exiting"))
+		break;
+	case player_exiting:
 		lua_pushinteger(L, plr->exiting);
-	else if (fastcmp(field,"cmomx"))
+		break;
+	case player_cmomx:
 		lua_pushfixed(L, plr->cmomx);
-	else if (fastcmp(field,"cmomy"))
+		break;
+	case player_cmomy:
 		lua_pushfixed(L, plr->cmomy);
-	else if (fastcmp(field,"rmomx"))
+		break;
+	case player_rmomx:
 		lua_pushfixed(L, plr->rmomx);
-	else if (fastcmp(field,"rmomy"))
+		break;
+	case player_rmomy:
 		lua_pushfixed(L, plr->rmomy);
-	else if (fastcmp(field,"totalring"))
+		break;
+	case player_totalring:
 		lua_pushinteger(L, plr->totalring);
-	else if (fastcmp(field,"realtime"))
+		break;
+	case player_realtime:
 		lua_pushinteger(L, plr->realtime);
-	else if (fastcmp(field,"laps"))
+		break;
+	case player_laps:
 		lua_pushinteger(L, plr->laps);
-	else if (fastcmp(field,"latestlap"))
+		break;
+	case player_latestlap:
 		lua_pushinteger(L, plr->latestlap);
-	else if (fastcmp(field,"exp"))
+		break;
+	case player_exp:
 		lua_pushinteger(L, plr->exp);
-	else if (fastcmp(field,"gradingfactor"))
+		break;
+	case player_gradingfactor:
 		lua_pushfixed(L, plr->gradingfactor);
-	else if (fastcmp(field,"gradingpointnum"))
+		break;
+	case player_gradingpointnum:
 		lua_pushinteger(L, plr->gradingpointnum);
-	else if (fastcmp(field,"checkpointid"))
+		break;
+	case player_checkpointid:
 		lua_pushinteger(L, plr->checkpointId);
-	else if (fastcmp(field,"team"))
+		break;
+	case player_team:
 		lua_pushinteger(L, plr->team);
-	else if (fastcmp(field,"checkskip"))
+		break;
+	case player_checkskip:
 		lua_pushinteger(L, plr->checkskip);
-	else if (fastcmp(field,"cheatchecknum"))
+		break;
+	case player_cheatchecknum:
 		lua_pushinteger(L, plr->cheatchecknum);
-	else if (fastcmp(field,"duelscore"))
+		break;
+	case player_duelscore:
 		lua_pushinteger(L, plr->duelscore);
-	else if (fastcmp(field,"lastsidehit"))
+		break;
+	case player_lastsidehit:
 		lua_pushinteger(L, plr->lastsidehit);
-	else if (fastcmp(field,"lastlinehit"))
+		break;
+	case player_lastlinehit:
 		lua_pushinteger(L, plr->lastlinehit);
-	else if (fastcmp(field,"timeshit"))
+		break;
+	case player_timeshit:
 		lua_pushinteger(L, plr->timeshit);
-	else if (fastcmp(field,"timeshitprev"))
+		break;
+	case player_timeshitprev:
 		lua_pushinteger(L, plr->timeshitprev);
-	else if (fastcmp(field,"onconveyor"))
+		break;
+	case player_onconveyor:
 		lua_pushinteger(L, plr->onconveyor);
-	else if (fastcmp(field,"awayviewmobj")) // FIXME: struct
+		break;
+	case player_awayviewmobj: // FIXME: struct
 		LUA_PushUserdata(L, plr->awayview.mobj, META_MOBJ);
-	else if (fastcmp(field,"awayviewtics")) // FIXME: struct
+		break;
+	case player_awayviewtics: // FIXME: struct
 		lua_pushinteger(L, plr->awayview.tics);
+		break;
 
-	else if (fastcmp(field,"spectator"))
+	case player_spectator:
 		lua_pushboolean(L, plr->spectator);
-	else if (fastcmp(field,"spectatewait"))
+		break;
+	case player_spectatewait:
 		lua_pushinteger(L, plr->spectatewait);
-	else if (fastcmp(field,"bot"))
+		break;
+	case player_bot:
 		lua_pushboolean(L, plr->bot);
-	else if (fastcmp(field,"botvars"))
+		break;
+	case player_botvars:
 		LUA_PushUserdata(L, &plr->botvars, META_BOTVARS);
-	else if (fastcmp(field,"jointime"))
+		break;
+	case player_jointime:
 		lua_pushinteger(L, plr->jointime);
-	else if (fastcmp(field,"spectatorreentry"))
+		break;
+	case player_spectatorreentry:
 		lua_pushinteger(L, plr->spectatorReentry);
-	else if (fastcmp(field,"griefvalue"))
+		break;
+	case player_griefvalue:
 		lua_pushinteger(L, plr->griefValue);
-	else if (fastcmp(field,"griefstrikes"))
+		break;
+	case player_griefstrikes:
 		lua_pushinteger(L, plr->griefStrikes);
-	else if (fastcmp(field,"griefwarned"))
+		break;
+	case player_griefwarned:
 		lua_pushinteger(L, plr->griefWarned);
-	else if (fastcmp(field,"typing_timer"))
+		break;
+	case player_typing_timer:
 		lua_pushinteger(L, plr->typing_timer);
-	else if (fastcmp(field,"typing_duration"))
+		break;
+	case player_typing_duration:
 		lua_pushinteger(L, plr->typing_duration);
-	else if (fastcmp(field,"kickstartaccel"))
+		break;
+	case player_kickstartaccel:
 		lua_pushinteger(L, plr->kickstartaccel);
-	else if (fastcmp(field,"autoring"))
+		break;
+	case player_autoring:
 		lua_pushboolean(L, plr->autoring);
-	else if (fastcmp(field,"stairjank"))
+		break;
+	case player_stairjank:
 		lua_pushinteger(L, plr->stairjank);
-	else if (fastcmp(field,"topdriftheld"))
+		break;
+	case player_topdriftheld:
 		lua_pushinteger(L, plr->topdriftheld);
-	else if (fastcmp(field,"topinfirst"))
+		break;
+	case player_topinfirst:
 		lua_pushinteger(L, plr->topinfirst);
-	else if (fastcmp(field,"splitscreenindex"))
+		break;
+	case player_splitscreenindex:
 		lua_pushinteger(L, plr->splitscreenindex);
-	else if (fastcmp(field,"stumbleindicator"))
+		break;
+	case player_stumbleindicator:
 		LUA_PushUserdata(L, plr->stumbleIndicator, META_MOBJ);
-	else if (fastcmp(field,"wavedashindicator"))
+		break;
+	case player_wavedashindicator:
 		LUA_PushUserdata(L, plr->wavedashIndicator, META_MOBJ);
-	else if (fastcmp(field,"trickindicator"))
+		break;
+	case player_trickindicator:
 		LUA_PushUserdata(L, plr->trickIndicator, META_MOBJ);
-	else if (fastcmp(field,"whip"))
+		break;
+	case player_whip:
 		LUA_PushUserdata(L, plr->whip, META_MOBJ);
-	else if (fastcmp(field,"hand"))
+		break;
+	case player_hand:
 		LUA_PushUserdata(L, plr->hand, META_MOBJ);
-	else if (fastcmp(field,"flickyattacker"))
+		break;
+	case player_flickyattacker:
 		LUA_PushUserdata(L, plr->flickyAttacker, META_MOBJ);
-	else if (fastcmp(field,"stoneshoe"))
+		break;
+	case player_stoneshoe:
 		LUA_PushUserdata(L, plr->stoneShoe, META_MOBJ);
-	else if (fastcmp(field,"toxomistercloud"))
+		break;
+	case player_toxomistercloud:
 		LUA_PushUserdata(L, plr->toxomisterCloud, META_MOBJ);
+		break;
 #ifdef HWRENDER
-	else if (fastcmp(field,"fovadd"))
+	case player_fovadd:
 		lua_pushfixed(L, plr->fovadd);
+		break;
 #endif
-	else if (fastcmp(field,"ping"))
+	case player_ping:
 		lua_pushinteger(L, playerpingtable[( plr - players )]);
-	else if (fastcmp(field, "publickey"))
+		break;
+	case player_publickey:
 		lua_pushstring(L, GetPrettyRRID(plr->public_key, false));
-	else if (fastcmp(field, "loop"))
+		break;
+	case player_loop:
 		LUA_PushUserdata(L, &plr->loop, META_SONICLOOPVARS);
-	else if (fastcmp(field, "powerup"))
+		break;
+	case player_powerup:
 		LUA_PushUserdata(L, &plr->powerup, META_POWERUPVARS);
-	else if (fastcmp(field, "icecube"))
+		break;
+	case player_icecube:
 		LUA_PushUserdata(L, &plr->icecube, META_ICECUBEVARS);
-	else if (fastcmp(field,"darkness_start"))
+		break;
+	case player_darkness_start:
 		lua_pushinteger(L, plr->darkness_start);
-	else if (fastcmp(field,"darkness_end"))
+		break;
+	case player_darkness_end:
 		lua_pushinteger(L, plr->darkness_end);
-	else {
+		break;
+	default: // extra custom variables in Lua memory
 		lua_getfield(L, LUA_REGISTRYINDEX, LREG_EXTVARS);
 		I_Assert(lua_istable(L, -1));
 		lua_pushlightuserdata(L, plr);
@@ -885,6 +1913,7 @@ static int player_get(lua_State *L)
 		lua_getfield(L, -1, field);
 		if (lua_isnil(L, -1)) // no value for this field
 			CONS_Debug(DBG_LUA, M_GetText("'%s' has no field named '%s'; returning nil.\n"), "player_t", field);
+		break;
 	}
 
 	return 1;
@@ -895,6 +1924,7 @@ static int player_set(lua_State *L)
 {
 	player_t *plr = *((player_t **)luaL_checkudata(L, 1, META_PLAYER));
 	const char *field = luaL_checkstring(L, 2);
+	enum player_e fieldid = Lua_optoption(L, 2, -1, player_fields_ref);
 	if (!plr)
 		return LUA_ErrInvalid(L, "player_t");
 
@@ -905,30 +1935,40 @@ static int player_set(lua_State *L)
 	if (constplayer)
 		return luaL_error(L, "Do not alter player_t while modifying the roulette!");
 
-	if (fastcmp(field,"mo")) {
+	switch (fieldid)
+	{
+	case player_mo:
+	{
 		mobj_t *newmo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		plr->mo->player = NULL; // remove player pointer from old mobj
 		(newmo->player = plr)->mo = newmo; // set player pointer for new mobj, and set new mobj as the player's mobj
+		break;
 	}
-	else if (fastcmp(field,"cmd"))
+	case player_cmd:
 		return NOSET;
-	else if (fastcmp(field,"oldcmd"))
+	case player_oldcmd:
 		return NOSET;
-	else if (fastcmp(field,"respawn"))
+	case player_respawn:
 		return NOSET;
-	else if (fastcmp(field,"playerstate"))
+	case player_playerstate:
 		plr->playerstate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"viewz"))
+		break;
+	case player_viewz:
 		plr->viewz = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"viewheight"))
+		break;
+	case player_viewheight:
 		plr->viewheight = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"skybox"))
+		break;
+	case player_skybox:
 		return NOSET;
-	else if (fastcmp(field,"viewrollangle"))
+	case player_viewrollangle:
 		plr->viewrollangle = luaL_checkangle(L, 3);
-	else if (fastcmp(field,"tilt"))
+		break;
+	case player_tilt:
 		plr->tilt = luaL_checkangle(L, 3);
-	else if (fastcmp(field,"aiming")) {
+		break;
+	case player_aiming:
+	{
 		uint8_t i;
 		plr->aiming = luaL_checkangle(L, 3);
 		for (i = 0; i <= r_splitscreen; i++)
@@ -938,14 +1978,17 @@ static int player_set(lua_State *L)
 				localaiming[i] = plr->aiming;
 			}
 		}
+		break;
 	}
-	else if (fastcmp(field,"drawangle"))
+	case player_drawangle:
 		plr->drawangle = luaL_checkangle(L, 3);
-	else if (fastcmp(field,"karthud"))
+		break;
+	case player_karthud:
 		return NOSET;
-	else if (fastcmp(field,"pflags"))
+	case player_pflags:
 		plr->pflags = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"pflags2"))
+		break;
+	case player_pflags2:
 	{
 		// It's a really bad idea to let Lua modify the voicechat-related flags.
 		// If we notice they're modified in any way, don't set anything.
@@ -957,747 +2000,1051 @@ static int player_set(lua_State *L)
 				"have their voice chat-related flags modified.");
 		
 		plr->pflags2 = newflags;
+		break;
 	}
-	else if (fastcmp(field,"panim"))
+	case player_panim:
 		plr->panim = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flashcount"))
+		break;
+	case player_flashcount:
 		plr->flashcount = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flashpal"))
+		break;
+	case player_flashpal:
 		plr->flashpal = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"skincolor"))
+		break;
+	case player_skincolor:
 	{
 		uint16_t newcolor = luaL_checkinteger(L,3);
 		if (newcolor >= numskincolors)
 			return luaL_error(L, "player.skincolor %d out of range (0 - %d).", newcolor, numskincolors-1);
 		plr->skincolor = newcolor;
+		break;
 	}
-	else if (fastcmp(field,"skin"))
+	case player_skin:
 		return NOSET;
-	else if (fastcmp(field,"fakeskin"))
+	case player_fakeskin:
 		return NOSET;
-	else if (fastcmp(field,"lastfakeskin"))
+	case player_lastfakeskin:
 		return NOSET;
-	else if (fastcmp(field,"score"))
+	case player_score:
 		plr->score = luaL_checkinteger(L, 3);
+		break;
 	// SRB2kart
-	else if (fastcmp(field,"nocontrol"))
+	case player_nocontrol:
 		plr->nocontrol = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"carry"))
+		break;
+	case player_carry:
 		plr->carry = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dye"))
+		break;
+	case player_dye:
 		plr->dye = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"position"))
+		break;
+	case player_position:
 		plr->position = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"oldposition"))
+		break;
+	case player_oldposition:
 		plr->oldposition = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"positiondelay"))
+		break;
+	case player_positiondelay:
 		plr->positiondelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"leaderpenalty"))
+		break;
+	case player_leaderpenalty:
 		plr->leaderpenalty = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"teamposition"))
+		break;
+	case player_teamposition:
 		plr->teamposition = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"teamimportance"))
+		break;
+	case player_teamimportance:
 		plr->teamimportance = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"distancetofinish"))
+		break;
+	case player_distancetofinish:
 		plr->distancetofinish = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"distancetofinishprev"))
+		break;
+	case player_distancetofinishprev:
 		plr->distancetofinishprev = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"lastpickupdistance"))
+		break;
+	case player_lastpickupdistance:
 		plr->lastpickupdistance = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastpickuptype"))
+		break;
+	case player_lastpickuptype:
 		plr->lastpickuptype = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"currentwaypoint"))
+		break;
+	case player_currentwaypoint:
 		plr->currentwaypoint = *((waypoint_t **)luaL_checkudata(L, 3, META_WAYPOINT));
-	else if (fastcmp(field,"nextwaypoint"))
+		break;
+	case player_nextwaypoint:
 		plr->nextwaypoint = *((waypoint_t **)luaL_checkudata(L, 3, META_WAYPOINT));
-	else if (fastcmp(field,"ringshooter"))
+		break;
+	case player_ringshooter:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->ringShooter, mo);
+		break;
 	}
-	else if (fastcmp(field,"airtime"))
+	case player_airtime:
 		plr->airtime = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastairtime"))
+		break;
+	case player_lastairtime:
 		plr->lastairtime = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bigwaypointgap"))
+		break;
+	case player_bigwaypointgap:
 		plr->bigwaypointgap = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flashing"))
+		break;
+	case player_flashing:
 		plr->flashing = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spinouttimer"))
+		break;
+	case player_spinouttimer:
 		plr->spinouttimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spinouttype"))
+		break;
+	case player_spinouttype:
 		plr->spinouttype = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"instashield"))
+		break;
+	case player_instashield:
 		plr->instashield = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"nullhitlag"))
+		break;
+	case player_nullhitlag:
 		plr->nullHitlag = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wipeoutslow"))
+		break;
+	case player_wipeoutslow:
 		plr->wipeoutslow = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"justbumped"))
+		break;
+	case player_justbumped:
 		plr->justbumped = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"noebrakemagnet"))
+		break;
+	case player_noebrakemagnet:
 		plr->noEbrakeMagnet = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wallspikedampen"))
+		break;
+	case player_wallspikedampen:
 		plr->wallSpikeDampen = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tumblebounces"))
+		break;
+	case player_tumblebounces:
 		plr->tumbleBounces = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tumbleheight"))
+		break;
+	case player_tumbleheight:
 		plr->tumbleHeight = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"stunned"))
+		break;
+	case player_stunned:
 		plr->stunned = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flybot"))
+		break;
+	case player_flybot:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->flybot, mo);
+		break;
 	}
-	else if (fastcmp(field,"justdi"))
+	case player_justdi:
 		plr->justDI = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flipdi"))
+		break;
+	case player_flipdi:
 		plr->flipDI = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"cangrabitems"))
+		break;
+	case player_cangrabitems:
 		plr->cangrabitems = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"incontrol"))
+		break;
+	case player_incontrol:
 		plr->incontrol = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"progressivethrust"))
+		break;
+	case player_progressivethrust:
 		plr->progressivethrust = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringvisualwarning"))
+		break;
+	case player_ringvisualwarning:
 		plr->ringvisualwarning = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bailcharge"))
+		break;
+	case player_bailcharge:
 		plr->bailcharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"baildrop"))
+		break;
+	case player_baildrop:
 		plr->baildrop = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bailhitlag"))
+		break;
+	case player_bailhitlag:
 		plr->bailhitlag = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"analoginput"))
+		break;
+	case player_analoginput:
 		plr->analoginput = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"transfer"))
+		break;
+	case player_transfer:
 		plr->transfer = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"markedfordeath"))
+		break;
+	case player_markedfordeath:
 		plr->markedfordeath = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"mfdfinish"))
+		break;
+	case player_mfdfinish:
 		plr->mfdfinish = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"dotrickfx"))
+		break;
+	case player_dotrickfx:
 		plr->dotrickfx = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"stingfx"))
+		break;
+	case player_stingfx:
 		plr->stingfx = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"bumperinflate"))
+		break;
+	case player_bumperinflate:
 		plr->bumperinflate = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringboxdelay"))
+		break;
+	case player_ringboxdelay:
 		plr->ringboxdelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringboxaward"))
+		break;
+	case player_ringboxaward:
 		plr->ringboxaward = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastringboost"))
+		break;
+	case player_lastringboost:
 		plr->lastringboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"amps"))
+		break;
+	case player_amps:
 		plr->amps = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"recentamps"))
+		break;
+	case player_recentamps:
 		plr->recentamps = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"amppickup"))
+		break;
+	case player_amppickup:
 		plr->amppickup = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ampspending"))
+		break;
+	case player_ampspending:
 		plr->ampspending = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"itemflags"))
+		break;
+	case player_itemflags:
 		plr->itemflags = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"outrun"))
+		break;
+	case player_outrun:
 		plr->outrun = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"drift"))
+		break;
+	case player_drift:
 		plr->drift = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"driftcharge"))
+		break;
+	case player_driftcharge:
 		plr->driftcharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"driftboost"))
+		break;
+	case player_driftboost:
 		plr->driftboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"strongdriftboost"))
+		break;
+	case player_strongdriftboost:
 		plr->strongdriftboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"gateboost"))
+		break;
+	case player_gateboost:
 		plr->gateBoost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"gatesound"))
+		break;
+	case player_gatesound:
 		plr->gateSound = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"startboost"))
+		break;
+	case player_startboost:
 		plr->startboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"neostartboost"))
+		break;
+	case player_neostartboost:
 		plr->neostartboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dropdashboost"))
+		break;
+	case player_dropdashboost:
 		plr->dropdashboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"aciddropdashboost"))
+		break;
+	case player_aciddropdashboost:
 		plr->aciddropdashboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"aizdriftstrat"))
+		break;
+	case player_aizdriftstrat:
 		plr->aizdriftstrat = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"aizdriftextend"))
+		break;
+	case player_aizdriftextend:
 		plr->aizdriftextend = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"aizdrifttilt"))
+		break;
+	case player_aizdrifttilt:
 		plr->aizdrifttilt = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"aizdriftturn"))
+		break;
+	case player_aizdriftturn:
 		plr->aizdriftturn = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"underwatertilt"))
+		break;
+	case player_underwatertilt:
 		plr->underwatertilt = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"offroad"))
+		break;
+	case player_offroad:
 		plr->offroad = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"tiregrease"))
+		break;
+	case player_tiregrease:
 		plr->tiregrease = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"springstars"))
+		break;
+	case player_springstars:
 		plr->springstars = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"springcolor"))
+		break;
+	case player_springcolor:
 		plr->springcolor = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dashpadcooldown"))
+		break;
+	case player_dashpadcooldown:
 		plr->dashpadcooldown = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spindash"))
+		break;
+	case player_spindash:
 		plr->spindash = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spindashspeed"))
+		break;
+	case player_spindashspeed:
 		plr->spindashspeed = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spindashboost"))
+		break;
+	case player_spindashboost:
 		plr->spindashboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringboostinprogress"))
+		break;
+	case player_ringboostinprogress:
 		plr->ringboostinprogress = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"fastfall"))
+		break;
+	case player_fastfall:
 		plr->fastfall = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"fastfallbase"))
+		break;
+	case player_fastfallbase:
 		plr->fastfallBase = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"numboosts"))
+		break;
+	case player_numboosts:
 		plr->numboosts = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"boostpower"))
+		break;
+	case player_boostpower:
 		plr->boostpower = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"speedboost"))
+		break;
+	case player_speedboost:
 		plr->speedboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"accelboost"))
+		break;
+	case player_accelboost:
 		plr->accelboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"handleboost"))
+		break;
+	case player_handleboost:
 		plr->handleboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"boostangle"))
+		break;
+	case player_boostangle:
 		plr->boostangle = luaL_checkangle(L, 3);
-	else if (fastcmp(field,"stonedrag"))
+		break;
+	case player_stonedrag:
 		plr->stonedrag = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"draftpower"))
+		break;
+	case player_draftpower:
 		plr->draftpower = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"draftleeway"))
+		break;
+	case player_draftleeway:
 		plr->draftleeway = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastdraft"))
+		break;
+	case player_lastdraft:
 		plr->lastdraft = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwirestate"))
+		break;
+	case player_tripwirestate:
 		plr->tripwireState = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwirepass"))
+		break;
+	case player_tripwirepass:
 		plr->tripwirePass = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"fakeboost"))
+		break;
+	case player_fakeboost:
 		plr->fakeBoost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"subsonicleniency"))
+		break;
+	case player_subsonicleniency:
 		plr->subsonicleniency = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwireleniency"))
+		break;
+	case player_tripwireleniency:
 		plr->tripwireLeniency = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwireairleniency"))
+		break;
+	case player_tripwireairleniency:
 		plr->tripwireAirLeniency = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwirerebounddelay"))
+		break;
+	case player_tripwirerebounddelay:
 		plr->tripwireReboundDelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"shrinklaserdelay"))
+		break;
+	case player_shrinklaserdelay:
 		plr->shrinkLaserDelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"eggmantransferdelay"))
+		break;
+	case player_eggmantransferdelay:
 		plr->eggmanTransferDelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedash"))
+		break;
+	case player_wavedash:
 		plr->wavedash = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedashleft"))
+		break;
+	case player_wavedashleft:
 		plr->wavedashleft = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedashright"))
+		break;
+	case player_wavedashright:
 		plr->wavedashright = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedashdelay"))
+		break;
+	case player_wavedashdelay:
 		plr->wavedashdelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedashboost"))
+		break;
+	case player_wavedashboost:
 		plr->wavedashboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"overdrive"))
+		break;
+	case player_overdrive:
 		plr->overdrive = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"overshield"))
+		break;
+	case player_overshield:
 		plr->overshield = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"wavedashpower"))
+		break;
+	case player_wavedashpower:
 		plr->wavedashpower = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"overdrivepower"))
+		break;
+	case player_overdrivepower:
 		plr->overdrivepower = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"overdriveready"))
+		break;
+	case player_overdriveready:
 		plr->overdriveready = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"overdrivelenient"))
+		break;
+	case player_overdrivelenient:
 		plr->overdrivelenient = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"trickcharge"))
+		break;
+	case player_trickcharge:
 		plr->trickcharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"infinitether"))
+		break;
+	case player_infinitether:
 		plr->infinitether = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"finalfailsafe"))
+		break;
+	case player_finalfailsafe:
 		plr->finalfailsafe = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"freeringshootercooldown"))
+		break;
+	case player_freeringshootercooldown:
 		plr->freeRingShooterCooldown = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastsafelap"))
+		break;
+	case player_lastsafelap:
 		plr->lastsafelap = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastsafecheatcheck"))
+		break;
+	case player_lastsafecheatcheck:
 		plr->lastsafecheatcheck = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ignoreairtimeleniency"))
+		break;
+	case player_ignoreairtimeleniency:
 		plr->ignoreAirtimeLeniency = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bubbledrag"))
+		break;
+	case player_bubbledrag:
 		plr->bubbledrag = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"topaccel"))
+		break;
+	case player_topaccel:
 		plr->topAccel = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"vortexboost"))
+		break;
+	case player_vortexboost:
 		plr->vortexBoost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"instawhipcharge"))
+		break;
+	case player_instawhipcharge:
 		plr->instaWhipCharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"pitblame"))
+		break;
+	case player_pitblame:
 		plr->pitblame = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"defenselockout"))
+		break;
+	case player_defenselockout:
 		plr->defenseLockout = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"instawhipchargelockout"))
+		break;
+	case player_instawhipchargelockout:
 		plr->instaWhipChargeLockout = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"oldguard"))
+		break;
+	case player_oldguard:
 		plr->oldGuard = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"powerupvfxtimer"))
+		break;
+	case player_powerupvfxtimer:
 		plr->powerupVFXTimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"preventfailsafe"))
+		break;
+	case player_preventfailsafe:
 		plr->preventfailsafe = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tripwireunstuck"))
+		break;
+	case player_tripwireunstuck:
 		plr->tripwireUnstuck = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bumpunstuck"))
+		break;
+	case player_bumpunstuck:
 		plr->bumpUnstuck = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"handtimer"))
+		break;
+	case player_handtimer:
 		plr->handtimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"besthanddirection"))
+		break;
+	case player_besthanddirection:
 		plr->besthanddirection = luaL_checkangle(L, 3);
-	else if (fastcmp(field,"itemroulette"))
+		break;
+	case player_itemroulette:
 		return NOSET;
-	else if (fastcmp(field,"itemtype"))
+	case player_itemtype:
 		plr->itemtype = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"itemamount"))
+		break;
+	case player_itemamount:
 		plr->itemamount = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"backupitemtype"))
+		break;
+	case player_backupitemtype:
 		plr->backupitemtype = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"backupitemamount"))
+		break;
+	case player_backupitemamount:
 		plr->backupitemamount = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"throwdir"))
+		break;
+	case player_throwdir:
 		plr->throwdir = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"sadtimer"))
+		break;
+	case player_sadtimer:
 		plr->sadtimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"rings"))
+		break;
+	case player_rings:
 		plr->rings = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"hudrings"))
+		break;
+	case player_hudrings:
 		plr->hudrings = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"pickuprings"))
+		break;
+	case player_pickuprings:
 		plr->pickuprings = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringdelay"))
+		break;
+	case player_ringdelay:
 		plr->ringdelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringboost"))
+		break;
+	case player_ringboost:
 		plr->ringboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"sparkleanim"))
+		break;
+	case player_sparkleanim:
 		plr->sparkleanim = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"superring"))
+		break;
+	case player_superring:
 		plr->superring = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"superringdisplay"))
+		break;
+	case player_superringdisplay:
 		plr->superringdisplay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"superringpeak"))
+		break;
+	case player_superringpeak:
 		plr->superringpeak = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"superringalert"))
+		break;
+	case player_superringalert:
 		plr->superringalert = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"nextringaward"))
+		break;
+	case player_nextringaward:
 		plr->nextringaward = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringvolume"))
+		break;
+	case player_ringvolume:
 		plr->ringvolume = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringtransparency"))
+		break;
+	case player_ringtransparency:
 		plr->ringtransparency = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ringburst"))
+		break;
+	case player_ringburst:
 		plr->ringburst = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"curshield"))
+		break;
+	case player_curshield:
 		plr->curshield = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bubblecool"))
+		break;
+	case player_bubblecool:
 		plr->bubblecool = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bubbleblowup"))
+		break;
+	case player_bubbleblowup:
 		plr->bubbleblowup = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flamedash"))
+		break;
+	case player_flamedash:
 		plr->flamedash = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"counterdash"))
+		break;
+	case player_counterdash:
 		plr->counterdash = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flamemeter"))
+		break;
+	case player_flamemeter:
 		plr->flamemeter = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"flamelength"))
+		break;
+	case player_flamelength:
 		plr->flamelength = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lightningcharge"))
+		break;
+	case player_lightningcharge:
 		plr->lightningcharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ballhogcharge"))
+		break;
+	case player_ballhogcharge:
 		plr->ballhogcharge = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ballhogburst"))
+		break;
+	case player_ballhogburst:
 		plr->ballhogburst = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ballhogtap"))
+		break;
+	case player_ballhogtap:
 		plr->ballhogtap = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"ballhogreticule"))
+		break;
+	case player_ballhogreticule:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->ballhogreticule, mo);
+		break;
 	}
-	else if (fastcmp(field,"hyudorotimer"))
+	case player_hyudorotimer:
 		plr->hyudorotimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"stealingtimer"))
+		break;
+	case player_stealingtimer:
 		plr->stealingtimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"hoverhyudoro"))
+		break;
+	case player_hoverhyudoro:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->hoverhyudoro, mo);
+		break;
 	}
-	else if (fastcmp(field,"sneakertimer"))
+	case player_sneakertimer:
 		plr->sneakertimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"numsneakers"))
+		break;
+	case player_numsneakers:
 		plr->numsneakers = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"panelsneakertimer"))
+		break;
+	case player_panelsneakertimer:
 		plr->panelsneakertimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"numpanelsneakers"))
+		break;
+	case player_numpanelsneakers:
 		plr->numpanelsneakers = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"weaksneakertimer"))
+		break;
+	case player_weaksneakertimer:
 		plr->weaksneakertimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"numweaksneakers"))
+		break;
+	case player_numweaksneakers:
 		plr->numweaksneakers = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"floorboost"))
+		break;
+	case player_floorboost:
 		plr->floorboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"growshrinktimer"))
+		break;
+	case player_growshrinktimer:
 		plr->growshrinktimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"rocketsneakertimer"))
+		break;
+	case player_rocketsneakertimer:
 		plr->rocketsneakertimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"invincibilitytimer"))
+		break;
+	case player_invincibilitytimer:
 		plr->invincibilitytimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"invincibilityextensions"))
+		break;
+	case player_invincibilityextensions:
 		plr->invincibilityextensions = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"loneliness"))
+		break;
+	case player_loneliness:
 		plr->loneliness = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"eggmanexplode"))
+		break;
+	case player_eggmanexplode:
 		plr->eggmanexplode = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"eggmanblame"))
+		break;
+	case player_eggmanblame:
 		plr->eggmanblame = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bananadrag"))
+		break;
+	case player_bananadrag:
 		plr->bananadrag = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastjawztarget"))
+		break;
+	case player_lastjawztarget:
 		plr->lastjawztarget = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"jawztargetdelay"))
+		break;
+	case player_jawztargetdelay:
 		plr->jawztargetdelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"confirmvictim"))
+		break;
+	case player_confirmvictim:
 		plr->confirmVictim = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"confirmvictimdelay"))
+		break;
+	case player_confirmvictimdelay:
 		plr->confirmVictimDelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"glancedir"))
+		break;
+	case player_glancedir:
 		plr->glanceDir = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"breathtimer"))
+		break;
+	case player_breathtimer:
 		plr->breathTimer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"trickpanel"))
+		break;
+	case player_trickpanel:
 		plr->trickpanel = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tricktime"))
+		break;
+	case player_tricktime:
 		plr->tricktime = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"trickboostpower"))
+		break;
+	case player_trickboostpower:
 		plr->trickboostpower = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"trickboostdecay"))
+		break;
+	case player_trickboostdecay:
 		plr->trickboostdecay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"trickboost"))
+		break;
+	case player_trickboost:
 		plr->trickboost = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tricklock"))
+		break;
+	case player_tricklock:
 		plr->tricklock = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dashringpulltics"))
+		break;
+	case player_dashringpulltics:
 		plr->dashRingPullTics = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dashringpushtics"))
+		break;
+	case player_dashringpushtics:
 		plr->dashRingPushTics = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"pullup"))
+		break;
+	case player_pullup:
 		plr->pullup = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"finalized"))
+		break;
+	case player_finalized:
 		plr->finalized = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"ebrakefor"))
+		break;
+	case player_ebrakefor:
 		plr->ebrakefor = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"roundscore"))
+		break;
+	case player_roundscore:
 		plr->roundscore = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"emeralds"))
+		break;
+	case player_emeralds:
 		plr->emeralds = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"karmadelay"))
+		break;
+	case player_karmadelay:
 		plr->karmadelay = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spheres"))
+		break;
+	case player_spheres:
 		plr->spheres = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"spheredigestion"))
+		break;
+	case player_spheredigestion:
 		plr->spheredigestion = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"kartspeed"))
+		break;
+	case player_kartspeed:
 		plr->kartspeed = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"kartweight"))
+		break;
+	case player_kartweight:
 		plr->kartweight = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"followerskin"))
+		break;
+	case player_followerskin:
 		plr->followerskin = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"followercolor"))
+		break;
+	case player_followercolor:
 		plr->followercolor = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"followerready"))
+		break;
+	case player_followerready:
 		plr->followerready = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"follower"))
+		break;
+	case player_follower:
 		return NOSET; // it's probably best we don't allow the follower mobj to change.
-	else if (fastcmp(field,"prefskin"))
+	case player_prefskin:
 		return NOSET; // don't allow changing user preferences
-	else if (fastcmp(field,"prefcolor"))
+	case player_prefcolor:
 		return NOSET; // don't allow changing user preferences
-	else if (fastcmp(field,"preffollower"))
+	case player_preffollower:
 		return NOSET; // don't allow changing user preferences
-	else if (fastcmp(field,"preffollowercolor"))
+	case player_preffollowercolor:
 		return NOSET; // don't allow changing user preferences
 
 	// time to add to the endless elseif list!!!!
 	// rideroids
-	else if (fastcmp(field,"rideroid"))
+	case player_rideroid:
 		plr->rideroid = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"rdnodepull"))
+		break;
+	case player_rdnodepull:
 		plr->rdnodepull = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"rideroidangle"))
+		break;
+	case player_rideroidangle:
 		plr->rideroidangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"rideroidspeed"))
+		break;
+	case player_rideroidspeed:
 		plr->rideroidspeed = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"rideroidrollangle"))
+		break;
+	case player_rideroidrollangle:
 		plr->rideroidrollangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"rdaddmomx"))
+		break;
+	case player_rdaddmomx:
 		plr->rdaddmomx = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"rdaddmomy"))
+		break;
+	case player_rdaddmomy:
 		plr->rdaddmomy = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"rdaddmomz"))
+		break;
+	case player_rdaddmomz:
 		plr->rdaddmomz = luaL_checkfixed(L, 3);
+		break;
 
 	// bungee
-	else if (fastcmp(field,"bungee"))
+	case player_bungee:
 		plr->bungee = luaL_checkinteger(L, 3);
+		break;
 
 	// dlz hover
-	else if (fastcmp(field,"lasthover"))
+	case player_lasthover:
 		plr->lasthover = luaL_checkinteger(L, 3);
+		break;
 
 	// dlz rocket
-	else if (fastcmp(field,"dlzrocket"))
+	case player_dlzrocket:
 		plr->dlzrocket = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dlzrocketangle"))
+		break;
+	case player_dlzrocketangle:
 		plr->dlzrocketangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dlzrocketanglev"))
+		break;
+	case player_dlzrocketanglev:
 		plr->dlzrocketanglev = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"dlzrocketspd"))
+		break;
+	case player_dlzrocketspd:
 		plr->dlzrocketspd = luaL_checkfixed(L, 3);
+		break;
 
 	// seasaws
-	else if (fastcmp(field,"seasaw"))
+	case player_seasaw:
 		plr->seasaw = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"seasawcooldown"))
+		break;
+	case player_seasawcooldown:
 		plr->seasawcooldown = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seasawdist"))
+		break;
+	case player_seasawdist:
 		plr->seasawdist = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"seasawangle"))
+		break;
+	case player_seasawangle:
 		plr->seasawangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seasawangleadd"))
+		break;
+	case player_seasawangleadd:
 		plr->seasawangleadd = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seasawmoreangle"))
+		break;
+	case player_seasawmoreangle:
 		plr->seasawmoreangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"seasawdir"))
+		break;
+	case player_seasawdir:
 		plr->seasawdir = luaL_checkboolean(L, 3);
+		break;
 
 	// turbines
-	else if (fastcmp(field,"turbine"))
+	case player_turbine:
 		plr->turbine = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"turbineangle"))
+		break;
+	case player_turbineangle:
 		plr->turbineangle = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"turbineheight"))
+		break;
+	case player_turbineheight:
 		plr->turbineheight = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"turbinespd"))
+		break;
+	case player_turbinespd:
 		plr->turbinespd = luaL_checkinteger(L, 3);
+		break;
 
 	// clouds
-	else if (fastcmp(field,"cloud"))
+	case player_cloud:
 		plr->cloud = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"cloudlaunch"))
+		break;
+	case player_cloudlaunch:
 		plr->cloudlaunch = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"cloudbuf"))
+		break;
+	case player_cloudbuf:
 		plr->cloudbuf = luaL_checkinteger(L, 3);
+		break;
 
 	// tulips
-	else if (fastcmp(field,"tulip"))
+	case player_tulip:
 		plr->tulip = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tuliplaunch"))
+		break;
+	case player_tuliplaunch:
 		plr->tuliplaunch = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"tulipbuf"))
+		break;
+	case player_tulipbuf:
 		plr->tulipbuf = luaL_checkinteger(L, 3);
+		break;
 
 	//
-	else if (fastcmp(field,"charflags"))
+	case player_charflags:
 		plr->charflags = (uint32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"followitem"))
+		break;
+	case player_followitem:
 		plr->followitem = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"followmobj"))
+		break;
+	case player_followmobj:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->followmobj, mo);
+		break;
 	}
-	else if (fastcmp(field,"lives"))
+	case player_lives:
 		plr->lives = (int8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"xtralife"))
+		break;
+	case player_xtralife:
 		plr->xtralife = (int8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"speed"))
+		break;
+	case player_speed:
 		plr->speed = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"lastspeed"))
+		break;
+	case player_lastspeed:
 		plr->lastspeed = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"deadtimer"))
+		break;
+	case player_deadtimer:
 		plr->deadtimer = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"exiting"))
+		break;
+	case player_exiting:
 		plr->exiting = (tic_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"cmomx"))
+		break;
+	case player_cmomx:
 		plr->cmomx = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"cmomy"))
+		break;
+	case player_cmomy:
 		plr->cmomy = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"rmomx"))
+		break;
+	case player_rmomx:
 		plr->rmomx = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"rmomy"))
+		break;
+	case player_rmomy:
 		plr->rmomy = luaL_checkfixed(L, 3);
-	else if (fastcmp(field,"totalring"))
+		break;
+	case player_totalring:
 		plr->totalring = (int16_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"realtime"))
+		break;
+	case player_realtime:
 		plr->realtime = (tic_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"laps"))
+		break;
+	case player_laps:
 		plr->laps = (uint8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"latestlap"))
+		break;
+	case player_latestlap:
 		plr->latestlap = (uint8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"exp"))
+		break;
+	case player_exp:
 		plr->exp = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"gradingfactor"))
+		break;
+	case player_gradingfactor:
 		plr->gradingfactor = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"gradingpointnum"))
+		break;
+	case player_gradingpointnum:
 		plr->gradingpointnum = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"checkpointid"))
+		break;
+	case player_checkpointid:
 		plr->checkpointId = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"team"))
+		break;
+	case player_team:
 		G_AssignTeam(plr, (uint8_t)luaL_checkinteger(L, 3));
-	else if (fastcmp(field,"checkskip"))
+		break;
+	case player_checkskip:
 		plr->checkskip = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"cheatchecknum"))
+		break;
+	case player_cheatchecknum:
 		plr->cheatchecknum = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"duelscore"))
+		break;
+	case player_duelscore:
 		plr->duelscore = (int16_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastsidehit"))
+		break;
+	case player_lastsidehit:
 		plr->lastsidehit = (int16_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"lastlinehit"))
+		break;
+	case player_lastlinehit:
 		plr->lastlinehit = (int16_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"timeshit"))
+		break;
+	case player_timeshit:
 		plr->timeshit = (uint8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"timeshitprev"))
+		break;
+	case player_timeshitprev:
 		plr->timeshitprev = (uint8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"onconveyor"))
+		break;
+	case player_onconveyor:
 		plr->onconveyor = (int32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"awayviewmobj")) // FIXME: struct
+		break;
+	case player_awayviewmobj: // FIXME: struct
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->awayview.mobj, mo);
+		break;
 	}
-	else if (fastcmp(field,"awayviewtics")) // FIXME: struct
+	case player_awayviewtics: // FIXME: struct
 	{
 		plr->awayview.tics = (int32_t)luaL_checkinteger(L, 3);
 		if (plr->awayview.tics && !plr->awayview.mobj) // awayviewtics must ALWAYS have an awayviewmobj set!!
 			P_SetTarget(&plr->awayview.mobj, plr->mo); // but since the script might set awayviewmobj immediately AFTER setting awayviewtics, use player mobj as filler for now.
+		break;
 	}
-	else if (fastcmp(field,"spectator"))
+	case player_spectator:
 		plr->spectator = lua_toboolean(L, 3);
-	else if (fastcmp(field,"spectatewait"))
+		break;
+	case player_spectatewait:
 		plr->spectatewait = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"bot"))
+		break;
+	case player_bot:
 		return NOSET;
-	else if (fastcmp(field,"botvars"))
+	case player_botvars:
 		return NOSET;
-	else if (fastcmp(field,"jointime"))
+	case player_jointime:
 		return NOSET;
-	else if (fastcmp(field,"spectatorreentry"))
+	case player_spectatorreentry:
 		plr->spectatorReentry = (uint32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"griefvalue"))
+		break;
+	case player_griefvalue:
 		plr->griefValue = (uint32_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"griefstrikes"))
+		break;
+	case player_griefstrikes:
 		plr->griefStrikes = (uint8_t)luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"griefwarned"))
+		break;
+	case player_griefwarned:
 		plr->griefWarned = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"typing_timer"))
+		break;
+	case player_typing_timer:
 		plr->typing_timer = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"typing_duration"))
+		break;
+	case player_typing_duration:
 		plr->typing_duration = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"kickstartaccel"))
+		break;
+	case player_kickstartaccel:
 		plr->kickstartaccel = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"autoring"))
+		break;
+	case player_autoring:
 		plr->autoring = luaL_checkboolean(L, 3);
-	else if (fastcmp(field,"stairjank"))
+		break;
+	case player_stairjank:
 		plr->stairjank = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"topdriftheld"))
+		break;
+	case player_topdriftheld:
 		plr->topdriftheld = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"topinfirst"))
+		break;
+	case player_topinfirst:
 		plr->topinfirst = luaL_checkinteger(L, 3);
-	else if (fastcmp(field,"splitscreenindex"))
+		break;
+	case player_splitscreenindex:
 		return NOSET;
-	else if (fastcmp(field,"stumbleindicator"))
+	case player_stumbleindicator:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->stumbleIndicator, mo);
+		break;
 	}
-	else if (fastcmp(field,"wavedashindicator"))
+	case player_wavedashindicator:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->wavedashIndicator, mo);
+		break;
 	}
-	else if (fastcmp(field,"trickindicator"))
+	case player_trickindicator:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->trickIndicator, mo);
+		break;
 	}
-	else if (fastcmp(field,"whip"))
+	case player_whip:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->whip, mo);
+		break;
 	}
-	else if (fastcmp(field,"hand"))
+	case player_hand:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->hand, mo);
+		break;
 	}
-	else if (fastcmp(field,"flickyattacker"))
+	case player_flickyattacker:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->flickyAttacker, mo);
+		break;
 	}
-	else if (fastcmp(field,"stoneshoe"))
+	case player_stoneshoe:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->stoneShoe, mo);
+		break;
 	}
-	else if (fastcmp(field,"toxomistercloud"))
+	case player_toxomistercloud:
 	{
 		mobj_t *mo = NULL;
 		if (!lua_isnil(L, 3))
 			mo = *((mobj_t **)luaL_checkudata(L, 3, META_MOBJ));
 		P_SetTarget(&plr->toxomisterCloud, mo);
+		break;
 	}
 #ifdef HWRENDER
-	else if (fastcmp(field,"fovadd"))
+	case player_fovadd:
 		plr->fovadd = luaL_checkfixed(L, 3);
+		break;
 #endif
-	else if (fastcmp(field, "loop"))
+	case player_loop:
 		return NOSET;
-	else if (fastcmp(field, "powerup"))
+	case player_powerup:
 		return NOSET;
-	else if (fastcmp(field, "icecube"))
+	case player_icecube:
 		return NOSET;
-	else if (fastcmp(field, "darkness_start"))
+	case player_darkness_start:
 		plr->darkness_start = luaL_checkinteger(L, 3);
-	else if (fastcmp(field, "darkness_end"))
+		break;
+	case player_darkness_end:
 		plr->darkness_end = luaL_checkinteger(L, 3);
-	else {
+		break;
+	default: // extra custom variables in Lua memory
 		lua_getfield(L, LUA_REGISTRYINDEX, LREG_EXTVARS);
 		I_Assert(lua_istable(L, -1));
 		lua_pushlightuserdata(L, plr);
@@ -1714,6 +3061,7 @@ static int player_set(lua_State *L)
 		lua_pushvalue(L, 3); // value to store
 		lua_setfield(L, -2, field);
 		lua_pop(L, 2);
+		break;
 	}
 
 	return 0;
@@ -1862,10 +3210,12 @@ static const char *const sonicloopvars_opt[] = {
 	NULL
 };
 
+static int sonicloopvars_fields_ref = LUA_NOREF;
+
 static int sonicloopvars_get(lua_State *L)
 {
 	sonicloopvars_t *sonicloopvars = *((sonicloopvars_t **)luaL_checkudata(L, 1, META_SONICLOOPVARS));
-	enum sonicloopvars field = luaL_checkoption(L, 2, NULL, sonicloopvars_opt);
+	enum sonicloopvars field = Lua_checkoption(L, 2, -1, sonicloopvars_fields_ref);
 
 	// This should always be valid.
 	I_Assert(sonicloopvars != NULL);
@@ -1948,10 +3298,12 @@ static const char *const sonicloopcamvars_opt[] = {
 	NULL
 };
 
+static int sonicloopcamvars_fields_ref = LUA_NOREF;
+
 static int sonicloopcamvars_get(lua_State *L)
 {
 	sonicloopcamvars_t *sonicloopcamvars = *((sonicloopcamvars_t **)luaL_checkudata(L, 1, META_SONICLOOPCAMVARS));
-	enum sonicloopcamvars field = luaL_checkoption(L, 2, NULL, sonicloopcamvars_opt);
+	enum sonicloopcamvars field = Lua_checkoption(L, 2, -1, sonicloopcamvars_fields_ref);
 
 	// This should always be valid.
 	I_Assert(sonicloopcamvars != NULL);
@@ -2013,10 +3365,12 @@ static const char *const powerupvars_opt[] = {
 	NULL
 };
 
+static int powerupvars_fields_ref = LUA_NOREF;
+
 static int powerupvars_get(lua_State *L)
 {
 	powerupvars_t *powerupvars = *((powerupvars_t **)luaL_checkudata(L, 1, META_POWERUPVARS));
-	enum powerupvars field = luaL_checkoption(L, 2, NULL, powerupvars_opt);
+	enum powerupvars field = Lua_checkoption(L, 2, -1, powerupvars_fields_ref);
 	
 	if (!powerupvars)
 		return LUA_ErrInvalid(L, "powerupvars_t");
@@ -2048,7 +3402,7 @@ static int powerupvars_get(lua_State *L)
 static int powerupvars_set(lua_State *L)
 {
 	powerupvars_t *powerupvars = *((powerupvars_t **)luaL_checkudata(L, 1, META_POWERUPVARS));
-	enum powerupvars field = luaL_checkoption(L, 2, powerupvars_opt[0], powerupvars_opt);
+	enum powerupvars field = Lua_checkoption(L, 2, 0, powerupvars_fields_ref);
 
 	if (!powerupvars)
 		return LUA_ErrInvalid(L, "powerupvars_t");
@@ -2107,10 +3461,12 @@ static const char *const icecubevars_opt[] = {
 	NULL
 };
 
+static int icecubevars_fields_ref = LUA_NOREF;
+
 static int icecubevars_get(lua_State *L)
 {
 	icecubevars_t *icecubevars = *((icecubevars_t **)luaL_checkudata(L, 1, META_ICECUBEVARS));
-	enum icecubevars field = luaL_checkoption(L, 2, NULL, icecubevars_opt);
+	enum icecubevars field = Lua_checkoption(L, 2, -1, icecubevars_fields_ref);
 	
 	if (!icecubevars)
 		return LUA_ErrInvalid(L, "icecubevars_t");
@@ -2142,7 +3498,7 @@ static int icecubevars_get(lua_State *L)
 static int icecubevars_set(lua_State *L)
 {
 	icecubevars_t *icecubevars = *((icecubevars_t **)luaL_checkudata(L, 1, META_ICECUBEVARS));
-	enum icecubevars field = luaL_checkoption(L, 2, icecubevars_opt[0], icecubevars_opt);
+	enum icecubevars field = Lua_checkoption(L, 2, 0, icecubevars_fields_ref);
 
 	if (!icecubevars)
 		return LUA_ErrInvalid(L, "icecubevars_t");
@@ -2191,10 +3547,12 @@ static const char *const skybox_opt[] = {
 	NULL
 };
 
+static int skybox_fields_ref = LUA_NOREF;
+
 static int skybox_get(lua_State *L)
 {
 	skybox_t *skybox = *((skybox_t **)luaL_checkudata(L, 1, META_SKYBOX));
-	enum skybox field = luaL_checkoption(L, 2, NULL, skybox_opt);
+	enum skybox field = Lua_checkoption(L, 2, -1, skybox_fields_ref);
 	
 	if (!skybox)
 		return LUA_ErrInvalid(L, "skybox_t");
@@ -2217,7 +3575,7 @@ static int skybox_get(lua_State *L)
 static int skybox_set(lua_State *L)
 {
 	skybox_t *skybox = *((skybox_t **)luaL_checkudata(L, 1, META_SKYBOX));
-	enum skybox field = luaL_checkoption(L, 2, skybox_opt[0], skybox_opt);
+	enum skybox field = Lua_checkoption(L, 2, 0, skybox_fields_ref);
 
 	if (!skybox)
 		return LUA_ErrInvalid(L, "skybox_t");
@@ -2250,6 +3608,13 @@ static int skybox_set(lua_State *L)
 
 int LUA_PlayerLib(lua_State *L)
 {
+	player_fields_ref = Lua_CreateFieldTable(L, player_opt);
+	sonicloopvars_fields_ref = Lua_CreateFieldTable(L, sonicloopvars_opt);
+	sonicloopcamvars_fields_ref = Lua_CreateFieldTable(L, sonicloopcamvars_opt);
+	powerupvars_fields_ref = Lua_CreateFieldTable(L, powerupvars_opt);
+	icecubevars_fields_ref = Lua_CreateFieldTable(L, icecubevars_opt);
+	skybox_fields_ref = Lua_CreateFieldTable(L, skybox_opt);
+
 	luaL_newmetatable(L, META_PLAYER);
 		lua_pushcfunction(L, player_get);
 		lua_setfield(L, -2, "__index");
@@ -27,6 +27,8 @@ extern "C" {
 #include "command.h"
 #include "doomtype.h"
 #include "i_system.h"
+#include "lua_alloc.h"
+#include "lua_libs.h"
 #include "lua_profile.h"
 #include "m_perfstats.h"
 
@@ -41,6 +43,13 @@ int g_tics_counted;
 double g_running_tic_time;
 double g_avg_tic_time;
 
+// lua_memstats at the start of the current average
+lua_memstats_t g_gc_reference;
+
+double g_avg_gc_time;
+double g_avg_gc_steps;
+uint32_t g_gc_cycles;
+
 bool g_invalid;
 
 }; // namespace
@@ -136,6 +145,11 @@ void LUA_ResetTicTimers(void)
 		g_avg_tic_time = g_running_tic_time / counted;
 		g_running_tic_time = 0.0;
 
+		g_avg_gc_time = static_cast<double>(lua_memstats.gctime - g_gc_reference.gctime) / I_GetPrecisePrecision() / counted;
+		g_avg_gc_steps = (lua_memstats.gcsteps - g_gc_reference.gcsteps) / counted;
+		g_gc_cycles = lua_memstats.gccycles - g_gc_reference.gccycles;
+		g_gc_reference = lua_memstats;
+
 		g_tics_counted = 1;
 
 		g_invalid = false;
@@ -205,6 +219,29 @@ void LUA_RenderTimers(void)
 		row = row.y(kRowHeight * 4);
 	}
 
+	{
+		constexpr double kKB = 1024.0;
+
+		double heap = gL ? lua_gc(gL, LUA_GCCOUNT, 0) + lua_gc(gL, LUA_GCCOUNTB, 0) / kKB : 0.0;
+
+		row.text(
+			"{:8.2f} KB - LUA HEAP ({:.2f} KB small, {:.2f} KB large, {:.2f} KB in {} arena chunks)",
+			heap,
+			lua_memstats.smallbytes / kKB,
+			lua_memstats.largebytes / kKB,
+			lua_memstats.arenabytes / kKB,
+			lua_memstats.numchunks
+		);
+		row.flags(color_flag(g_avg_gc_time * 1'000'000.0)).y(kRowHeight).text(
+			"{:8.2f} us - GC ({:.2f} steps, {} cycles completed)",
+			g_avg_gc_time * 1'000'000.0,
+			g_avg_gc_steps,
+			g_gc_cycles
+		);
+
+		row = row.y(kRowHeight * 3);
+	}
+
 	std::sort(
 		view.rbegin(),
 		view.rend(),
@@ -60,13 +60,15 @@ static const char *const respawnvars_opt[] = {
 	NULL
 };
 
+static int respawnvars_fields_ref = LUA_NOREF;
+
 #define RNOFIELD luaL_error(L, LUA_QL("respawnvars_t") " has no field named " LUA_QS, field)
 #define RUNIMPLEMENTED luaL_error(L, LUA_QL("respawnvars_t") " unimplemented field " LUA_QS " cannot be read or set.", field)
 
 static int respawn_get(lua_State *L)
 {
 	respawnvars_t *rsp = *((respawnvars_t **)luaL_checkudata(L, 1, META_RESPAWN));
-	enum respawnvars field = luaL_checkoption(L, 2, NULL, respawnvars_opt);
+	enum respawnvars field = Lua_checkoption(L, 2, -1, respawnvars_fields_ref);
 	
 	if (!rsp)
 		return LUA_ErrInvalid(L, "player_t");
@@ -134,7 +136,7 @@ static int respawn_get(lua_State *L)
 static int respawn_set(lua_State *L)
 {
 	respawnvars_t *rsp = *((respawnvars_t **)luaL_checkudata(L, 1, META_RESPAWN));
-	enum respawnvars field = luaL_checkoption(L, 2, respawnvars_opt[0], respawnvars_opt);
+	enum respawnvars field = Lua_checkoption(L, 2, 0, respawnvars_fields_ref);
 
 	if (!rsp)
 		return LUA_ErrInvalid(L, "respawnvars_t");
@@ -209,6 +211,8 @@ static int respawn_set(lua_State *L)
 
 int LUA_RespawnVarsLib(lua_State *L)
 {
+	respawnvars_fields_ref = Lua_CreateFieldTable(L, respawnvars_opt);
+
 	luaL_newmetatable(L, META_RESPAWN);
 		lua_pushcfunction(L, respawn_get);
 		lua_setfield(L, -2, "__index");
@@ -35,13 +35,19 @@
 #include "lua_script.h"
 #include "lua_libs.h"
 #include "lua_hook.h"
+#include "lua_alloc.h"
 
 #include "doomstat.h"
 #include "g_state.h"
 #include "m_argv.h"
+#include "i_system.h"
 
 lua_State *gL = NULL;
 
+extern consvar_t cv_lua_gcbudget;
+
+static void LUA_ResetGCBudget(void);
+
 // List of internal libraries to load from SRB2
 static lua_CFunction liblist[] = {
 	LUA_EnumLib, // global metatable for enums
@@ -476,10 +482,13 @@ void LUA_ClearState(void)
 		lua_close(gL);
 	gL = NULL;
 
+	LUA_ResetArena();
+	LUA_ResetGCBudget();
+
 	CONS_Printf(M_GetText("Pardon me while I initialize the Lua scripting interface...\n"));
 
 	// allocate state
-	L = lua_newstate(LUA_Alloc, NULL);
+	L = lua_newstate(LUA_ArenaAlloc, NULL);
 	lua_atpanic(L, LUA_Panic);
 
 	// open base libraries
@@ -1564,12 +1573,103 @@ static void UnArchiveTables(uint8_t **p)
 	}
 }
 
+// Garbage collection time earned by game tics and not yet spent.
+static precise_t gcbudget;
+// Heap size, in KB, at the end of the last collection cycle.
+static int gcestimate;
+static dboolean gcstopped;
+// A cycle has been started and not finished yet.
+static dboolean gccycling;
+
+static void LUA_ResetGCBudget(void)
+{
+	gcbudget = 0;
+	gcestimate = 0;
+	gcstopped = false;
+	gccycling = false;
+}
+
+// Called at the end of every game tic.
+void LUA_AddGCBudget(void)
+{
+	const precise_t tic = (precise_t)cv_lua_gcbudget.value * I_GetPrecisePrecision() / 1000000;
+
+	// Don't let a long frame bank up a long collection.
+	gcbudget = min(gcbudget + tic, 2 * tic);
+}
+
+// Spend the banked budget on incremental collection steps.
+// This runs between frames, when nothing is waiting on Lua,
+// and keeps the collector from running in the middle of a tic.
 void LUA_Step(void)
 {
+	precise_t start, elapsed;
+	int heap;
+
 	if (!gL)
 		return;
 	lua_settop(gL, 0);
-	lua_gc(gL, LUA_GCSTEP, 1);
+
+	if (cv_lua_gcbudget.value == 0)
+	{
+		// Let Lua collect whenever it wants.
+		if (gcstopped)
+		{
+			lua_gc(gL, LUA_GCRESTART, 0);
+			gcstopped = false;
+		}
+
+		start = I_GetPreciseTime();
+		if (lua_gc(gL, LUA_GCSTEP, 1))
+		{
+			lua_memstats.gccycles++;
+			gccycling = false;
+		}
+		lua_memstats.gctime += I_GetPreciseTime() - start;
+		lua_memstats.gcsteps++;
+		return;
+	}
+
+	heap = lua_gc(gL, LUA_GCCOUNT, 0);
+	if (gcestimate == 0)
+		gcestimate = heap;
+
+	start = I_GetPreciseTime();
+	elapsed = 0;
+
+	// Always finish a cycle that was started. Only wait for
+	// the heap to double before starting another one, like
+	// Lua's own collector does.
+	if (gccycling || heap >= 2 * gcestimate)
+	{
+		gccycling = true;
+
+		while (elapsed < gcbudget
+			// Allocation is outpacing the budget; catch up.
+			|| heap >= 4 * gcestimate)
+		{
+			lua_memstats.gcsteps++;
+
+			if (lua_gc(gL, LUA_GCSTEP, 0))
+			{
+				lua_memstats.gccycles++;
+				gcestimate = lua_gc(gL, LUA_GCCOUNT, 0);
+				gccycling = false;
+				elapsed = I_GetPreciseTime() - start;
+				break;
+			}
+
+			heap = lua_gc(gL, LUA_GCCOUNT, 0);
+			elapsed = I_GetPreciseTime() - start;
+		}
+	}
+
+	// Stepping rearms Lua's own collector, so stop it again.
+	lua_gc(gL, LUA_GCSTOP, 0);
+	gcstopped = true;
+
+	gcbudget -= min(elapsed, gcbudget);
+	lua_memstats.gctime += elapsed;
 }
 
 void LUA_Archive(savebuffer_t *save, dboolean network)
@@ -1654,15 +1754,58 @@ void LUA_UnArchive(savebuffer_t *save, dboolean network)
 }
 
 // For mobj_t, player_t, etc. to take custom variables.
-int Lua_optoption(lua_State *L, int narg,
-	const char *def, const char *const lst[])
+// Builds a table mapping each field name in lst to its index,
+// and returns a registry reference to it for Lua_optoption.
+int Lua_CreateFieldTable(lua_State *L, const char *const lst[])
 {
-	const char *name = (def) ? luaL_optstring(L, narg, def) :  luaL_checkstring(L, narg);
 	int i;
-	for (i=0; lst[i]; i++)
-		if (fastcmp(lst[i], name))
-			return i;
-	return -1;
+
+	lua_newtable(L);
+	for (i = 0; lst[i]; i++)
+	{
+		lua_pushstring(L, lst[i]);
+		lua_pushinteger(L, i);
+		lua_rawset(L, -3);
+	}
+
+	return luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+// Looks a field name up in a table made by Lua_CreateFieldTable.
+// Lua strings are interned and carry their hash, so this is a single
+// hashed lookup rather than a string compare per field.
+// Returns def if the argument is missing and def >= 0, or -1 if the
+// name is not in the table.
+int Lua_optoption(lua_State *L, int narg, int def, int list_ref)
+{
+	int result = -1;
+
+	if (def >= 0 && lua_isnoneornil(L, narg))
+		return def;
+
+	luaL_checkstring(L, narg);
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, list_ref);
+	I_Assert(lua_istable(L, -1));
+	lua_pushvalue(L, narg);
+	lua_rawget(L, -2);
+	if (lua_type(L, -1) == LUA_TNUMBER)
+		result = (int)lua_tointeger(L, -1);
+	lua_pop(L, 2);
+
+	return result;
+}
+
+// Lua_optoption, but raises the same error as luaL_checkoption
+// if the name is not in the table.
+int Lua_checkoption(lua_State *L, int narg, int def, int list_ref)
+{
+	int result = Lua_optoption(L, narg, def, list_ref);
+
+	if (result == -1)
+		return luaL_argerror(L, narg, lua_pushfstring(L, "invalid option " LUA_QS, lua_tostring(L, narg)));
+
+	return result;
 }
 
 void LUA_PushTaggableObjectArray
@@ -58,6 +58,7 @@ void LUA_DumpFile(const char *filename);
 #endif
 fixed_t LUA_EvalMath(const char *word);
 void LUA_Step(void);
+void LUA_AddGCBudget(void);
 void LUA_Archive(savebuffer_t *save, dboolean network);
 void LUA_UnArchive(savebuffer_t *save, dboolean network);
 
@@ -66,8 +67,9 @@ int LUA_WriteGlobals(lua_State *L, const char *word);
 
 void Got_Luacmd(const uint8_t **cp, int32_t playernum); // lua_consolelib.c
 void LUA_CVarChanged(void *cvar); // lua_consolelib.c
-int Lua_optoption(lua_State *L, int narg,
-	const char *def, const char *const lst[]);
+int Lua_CreateFieldTable(lua_State *L, const char *const lst[]);
+int Lua_optoption(lua_State *L, int narg, int def, int list_ref);
+int Lua_checkoption(lua_State *L, int narg, int def, int list_ref);
 void LUA_HookNetArchive(lua_CFunction archFunc, savebuffer_t *save);
 
 void LUA_PushTaggableObjectArray
@@ -101,6 +101,8 @@ static const char *const terrain_opt[] = {
 	NULL
 };
 
+static int terrain_fields_ref = LUA_NOREF;
+
 static const char *const splash_opt[] = {
 	"valid",
 	"name",
@@ -117,6 +119,8 @@ static const char *const splash_opt[] = {
 	NULL
 };
 
+static int splash_fields_ref = LUA_NOREF;
+
 static const char *const footstep_opt[] = {
 	"valid",
 	"name",
@@ -135,6 +139,8 @@ static const char *const footstep_opt[] = {
 	NULL
 };
 
+static int footstep_fields_ref = LUA_NOREF;
+
 static const char *const overlay_opt[] = {
 	"valid",
 	"name",
@@ -146,10 +152,12 @@ static const char *const overlay_opt[] = {
 	NULL
 };
 
+static int overlay_fields_ref = LUA_NOREF;
+
 static int splash_get(lua_State *L)
 {
 	t_splash_t *splash = *((t_splash_t **)luaL_checkudata(L, 1, META_SPLASH));
-	enum splash field = luaL_checkoption(L, 2, splash_opt[0], splash_opt);
+	enum splash field = Lua_checkoption(L, 2, 0, splash_fields_ref);
 	
 	if (!splash)
 	{
@@ -294,7 +302,7 @@ static int lib_numSplashes(lua_State *L)
 static int footstep_get(lua_State *L)
 {
 	t_footstep_t *footstep = *((t_footstep_t **)luaL_checkudata(L, 1, META_FOOTSTEP));
-	enum footstep field = luaL_checkoption(L, 2, footstep_opt[0], footstep_opt);
+	enum footstep field = Lua_checkoption(L, 2, 0, footstep_fields_ref);
 	
 	if (!footstep)
 	{
@@ -445,7 +453,7 @@ static int lib_numFootsteps(lua_State *L)
 static int overlay_get(lua_State *L)
 {
 	t_overlay_t *overlay = *((t_overlay_t **)luaL_checkudata(L, 1, META_OVERLAY));
-	enum overlay field = luaL_checkoption(L, 2, overlay_opt[0], overlay_opt);
+	enum overlay field = Lua_checkoption(L, 2, 0, overlay_fields_ref);
 	
 	if (!overlay)
 	{
@@ -584,7 +592,7 @@ static int lib_numOverlays(lua_State *L)
 static int terrain_get(lua_State *L)
 {
 	terrain_t *terrain = *((terrain_t **)luaL_checkudata(L, 1, META_TERRAIN));
-	enum terrain field = luaL_checkoption(L, 2, terrain_opt[0], terrain_opt);
+	enum terrain field = Lua_checkoption(L, 2, 0, terrain_fields_ref);
 	
 	if (!terrain)
 	{
@@ -743,6 +751,11 @@ static int lib_numTerrains(lua_State *L)
 
 int LUA_TerrainLib(lua_State *L)
 {	
+	splash_fields_ref = Lua_CreateFieldTable(L, splash_opt);
+	footstep_fields_ref = Lua_CreateFieldTable(L, footstep_opt);
+	overlay_fields_ref = Lua_CreateFieldTable(L, overlay_opt);
+	terrain_fields_ref = Lua_CreateFieldTable(L, terrain_opt);
+
 	luaL_newmetatable(L, META_SPLASH);
 		lua_pushcfunction(L, splash_get);
 		lua_setfield(L, -2, "__index");
@@ -0,0 +1,348 @@
+// DR. ROBOTNIK'S RING RACERS
+//-----------------------------------------------------------------------------
+// Copyright (C) 2025 by Kart Krew.
+//
+// This program is free software distributed under the
+// terms of the GNU General Public License, version 2.
+// See the 'LICENSE' file for more details.
+//-----------------------------------------------------------------------------
+/// \file m_benchtics.cpp
+/// \brief Headless replay benchmark (-benchtics).
+///
+/// Plays one or more replays back to back through the timedemo
+/// path with no drawing and no sound, samples every logic perfstats
+/// counter once per tic, and writes the p50/p99/max of each counter
+/// per replay to a JSON report.
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <span>
+
+#include "core/hash_map.hpp"
+#include "core/json.hpp"
+#include "core/string.h"
+#include "core/vector.hpp"
+#include "io/streams.hpp"
+
+#include "command.h"
+#include "d_main.h"
+#include "doomstat.h"
+#include "g_demo.h"
+#include "g_game.h"
+#include "i_system.h"
+#include "i_time.h"
+#include "i_video.h"
+#include "k_menu.h"
+#include "m_argv.h"
+#include "m_benchtics.h"
+#include "m_perfstats.h"
+
+using srb2::JsonArray;
+using srb2::JsonObject;
+using srb2::JsonValue;
+
+namespace
+{
+
+enum benchcounter_t
+{
+	BENCH_TICTIME,
+	BENCH_PLAYERTHINK,
+	BENCH_THINKERS,
+	BENCH_THLIST_DYNSLOPE,
+	BENCH_THLIST_POLYOBJ,
+	BENCH_THLIST_MAIN,
+	BENCH_THLIST_MOBJ,
+	BENCH_THLIST_DYNSLOPEDEMO,
+	BENCH_ACS,
+	BENCH_LUA_THINKFRAME,
+	BENCH_CHECKPOSITION_CALLS,
+	BENCH_LUA_MOBJHOOKS,
+	NUM_BENCHCOUNTERS,
+
+	// Counters from here on are call counts, not times.
+	BENCH_FIRSTCOUNT = BENCH_CHECKPOSITION_CALLS,
+};
+
+static_assert(BENCH_THLIST_DYNSLOPEDEMO - BENCH_THLIST_DYNSLOPE + 1 == NUM_ACTIVETHINKERLISTS);
+
+const char *const g_counter_names[NUM_BENCHCOUNTERS] = {
+	"tictime",
+	"playerthink_time",
+	"thinkertime",
+	"thlist_dynslope",
+	"thlist_polyobj",
+	"thlist_main",
+	"thlist_mobj",
+	"thlist_dynslopedemo",
+	"acs_time",
+	"lua_thinkframe_time",
+	"checkposition_calls",
+	"lua_mobjhooks",
+};
+
+struct benchdemo_t
+{
+	srb2::String name;
+	tic_t start;
+	srb2::Vector<int64_t> samples[NUM_BENCHCOUNTERS];
+	srb2::HashMap<srb2::String, srb2::Vector<int64_t>> hooks;
+	bool failed;
+};
+
+srb2::Vector<benchdemo_t> g_demos;
+size_t g_current;
+bool g_active;
+bool g_starting; // the current replay still has to be started
+
+void M_BenchTicsPlayCurrent(void)
+{
+	benchdemo_t& bench = g_demos[g_current];
+
+	CONS_Printf("benchtics: playing %s (%u of %u)\n", bench.name.c_str(),
+		static_cast<unsigned>(g_current + 1), static_cast<unsigned>(g_demos.size()));
+
+	G_TimeDemo(bench.name.c_str());
+
+	// Neither is needed to run the game logic.
+	nodrawers = true;
+	noblit = true;
+
+	bench.start = I_GetTime();
+}
+
+JsonValue M_BenchTicsSummary(srb2::Vector<int64_t>& samples, bool istime)
+{
+	JsonObject summary;
+	const double scale = istime ? 1000000.0 / I_GetPrecisePrecision() : 1.0;
+
+	if (samples.empty())
+	{
+		summary["p50"] = 0.0;
+		summary["p99"] = 0.0;
+		summary["max"] = 0.0;
+		summary["mean"] = 0.0;
+		return summary;
+	}
+
+	// Nearest-rank percentiles.
+	auto rank = [&samples](double p)
+	{
+		size_t k = static_cast<size_t>(p * samples.size() + 0.999999);
+		return samples[std::clamp<size_t>(k, 1, samples.size()) - 1];
+	};
+
+	double total = 0.0;
+
+	std::sort(samples.begin(), samples.end());
+
+	for (int64_t s : samples)
+	{
+		total += s;
+	}
+
+	summary["p50"] = rank(0.50) * scale;
+	summary["p99"] = rank(0.99) * scale;
+	summary["max"] = samples.back() * scale;
+	summary["mean"] = total / samples.size() * scale;
+	return summary;
+}
+
+void M_BenchTicsWriteReport(void)
+{
+	JsonValue report = JsonValue(JsonObject());
+
+	report["version"] = 1;
+	report["game"] = srb2::String(VERSIONSTRING);
+	report["ticrate"] = static_cast<int32_t>(TICRATE);
+	report["time_unit"] = srb2::String("us");
+
+	JsonValue& array_value = report["demos"];
+	array_value = JsonValue(JsonArray());
+	JsonArray& array = array_value.as_array();
+
+	for (benchdemo_t& bench : g_demos)
+	{
+		JsonObject demo_obj;
+		JsonObject counters;
+		JsonObject hooks;
+
+		demo_obj["name"] = bench.name;
+
+		if (bench.failed)
+		{
+			demo_obj["error"] = srb2::String("couldn't be played back");
+		}
+
+		demo_obj["tics"] = static_cast<uint32_t>(bench.samples[BENCH_TICTIME].size());
+
+		for (int i = 0; i < NUM_BENCHCOUNTERS; i++)
+		{
+			counters[g_counter_names[i]] = M_BenchTicsSummary(bench.samples[i], i < BENCH_FIRSTCOUNT);
+		}
+
+		for (auto& [src, samples] : bench.hooks)
+		{
+			hooks[src] = M_BenchTicsSummary(samples, true);
+		}
+
+		demo_obj["counters"] = std::move(counters);
+		demo_obj["lua_thinkframe_hooks"] = std::move(hooks);
+		array.push_back(std::move(demo_obj));
+	}
+
+	srb2::String json_string = report.to_json_string();
+	srb2::String path;
+
+	if (M_CheckParm("-benchout") && M_IsNextParm())
+	{
+		path = M_GetNextParm();
+	}
+	else
+	{
+		path = srb2::format("{}/{}", srb2home, "benchtics.json");
+	}
+
+	try
+	{
+		srb2::io::FileStream fs { path, srb2::io::FileStreamMode::kWrite };
+		srb2::io::write_exact(fs, std::as_bytes(std::span(json_string)));
+		CONS_Printf("benchtics: results saved to '%s'\n", path.c_str());
+	}
+	catch (const std::exception& ex)
+	{
+		CONS_Alert(CONS_ERROR, "benchtics: couldn't save '%s': %s\n", path.c_str(), ex.what());
+	}
+}
+
+void M_BenchTicsFinish(void)
+{
+	M_BenchTicsWriteReport();
+
+	g_active = false;
+	COM_ImmedExecute("quit");
+}
+
+} // namespace
+
+void M_BenchTicsAddDemo(const char *name)
+{
+	benchdemo_t& bench = g_demos.emplace_back();
+	bench.name = name;
+}
+
+void M_BenchTicsStart(void)
+{
+	if (g_demos.empty())
+	{
+		return;
+	}
+
+	g_active = true;
+	g_current = 0;
+	g_starting = true;
+}
+
+void M_BenchTicsUpdate(void)
+{
+	while (g_active && g_starting)
+	{
+		g_starting = false;
+
+		M_BenchTicsPlayCurrent();
+
+		// Run the queued playdemo command now, so we know
+		// whether the replay could be loaded at all.
+		COM_BufExecute();
+
+		// Any message box would wait forever for someone to close it.
+		if (menuactive)
+		{
+			M_ClearMenus(true);
+		}
+
+		if (demo.playback)
+		{
+			break;
+		}
+
+		benchdemo_t& bench = g_demos[g_current];
+
+		CONS_Alert(CONS_ERROR, "benchtics: %s couldn't be played back, skipping\n", bench.name.c_str());
+
+		bench.failed = true;
+		demo.timing = false;
+
+		if (++g_current < g_demos.size())
+		{
+			g_starting = true;
+		}
+		else
+		{
+			M_BenchTicsFinish();
+		}
+	}
+}
+
+dboolean M_BenchTicsActive(void)
+{
+	return g_active;
+}
+
+void M_BenchTicsSample(void)
+{
+	if (!g_active || !demo.timing || !demo.playback || gamestate != GS_LEVEL)
+	{
+		return;
+	}
+
+	benchdemo_t& bench = g_demos[g_current];
+	int i;
+
+	bench.samples[BENCH_TICTIME].push_back(ps_tictime);
+	bench.samples[BENCH_PLAYERTHINK].push_back(ps_playerthink_time);
+	bench.samples[BENCH_THINKERS].push_back(ps_thinkertime);
+
+	for (i = 0; i < NUM_ACTIVETHINKERLISTS; i++)
+	{
+		bench.samples[BENCH_THLIST_DYNSLOPE + i].push_back(ps_thlist_times[i]);
+	}
+
+	bench.samples[BENCH_ACS].push_back(ps_acs_time);
+	bench.samples[BENCH_LUA_THINKFRAME].push_back(ps_lua_thinkframe_time);
+	bench.samples[BENCH_CHECKPOSITION_CALLS].push_back(ps_checkposition_calls);
+	bench.samples[BENCH_LUA_MOBJHOOKS].push_back(ps_lua_mobjhooks);
+
+	for (i = 0; i < thinkframe_hooks_length; i++)
+	{
+		bench.hooks[thinkframe_hooks[i].short_src].push_back(thinkframe_hooks[i].time_taken);
+	}
+}
+
+void M_BenchTicsNextDemo(void)
+{
+	if (!g_active)
+	{
+		return;
+	}
+
+	{
+		const benchdemo_t& bench = g_demos[g_current];
+		const double seconds = static_cast<double>(I_GetTime() - bench.start) / TICRATE;
+		const size_t tics = bench.samples[BENCH_TICTIME].size();
+
+		CONS_Printf("benchtics: %s ran %u tics in %f seconds (%f tics/sec)\n", bench.name.c_str(),
+			static_cast<unsigned>(tics), seconds, seconds > 0.0 ? tics / seconds : 0.0);
+	}
+
+	if (++g_current < g_demos.size())
+	{
+		// Started from M_BenchTicsUpdate, outside of the tic
+		// that ended this replay.
+		g_starting = true;
+		return;
+	}
+
+	M_BenchTicsFinish();
+}
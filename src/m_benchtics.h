@@ -0,0 +1,45 @@
+// DR. ROBOTNIK'S RING RACERS
+//-----------------------------------------------------------------------------
+// Copyright (C) 2025 by Kart Krew.
+//
+// This program is free software distributed under the
+// terms of the GNU General Public License, version 2.
+// See the 'LICENSE' file for more details.
+//-----------------------------------------------------------------------------
+/// \file m_benchtics.h
+/// \brief Headless replay benchmark (-benchtics).
+
+#ifndef M_BENCHTICS_H
+#define M_BENCHTICS_H
+
+#include "doomtype.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Queue a replay to be played back by the benchmark.
+void M_BenchTicsAddDemo(const char *name);
+
+// Start playing the queued replays back to back, as fast
+// as possible, with rendering and sound turned off.
+void M_BenchTicsStart(void);
+
+dboolean M_BenchTicsActive(void);
+
+// Called once per frame. Starts the next queued replay, and
+// skips over any replay that fails to load.
+void M_BenchTicsUpdate(void);
+
+// Record the perfstats counters of the tic that just ran.
+void M_BenchTicsSample(void);
+
+// Called when a timed replay finishes. Moves onto the next
+// queued replay, or writes the report and quits.
+void M_BenchTicsNextDemo(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif/*M_BENCHTICS_H*/
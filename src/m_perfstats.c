@@ -20,6 +20,8 @@
 #include "z_zone.h"
 #include "p_local.h"
 #include "g_game.h"
+#include "d_main.h" // srb2home
+#include "deh_tables.h" // MOBJTYPE_LIST, actionpointers
 
 #ifdef HWRENDER
 #include "hardware/hw_main.h"
@@ -70,6 +72,25 @@ int thinkframe_hooks_capacity = 16;
 
 ps_botinfo_t ps_bots[MAXPLAYERS];
 
+dboolean ps_objprofile = false;
+static int ps_objprofile_tics = 0;
+static ps_objstat_t ps_mobjstats[NUMMOBJTYPES];
+
+struct ps_actionstat
+{
+	actionf_t action;
+	statenum_t state; // first state seen with this action
+	const char *name; // NULL for Lua actions
+	precise_t time;
+	uint32_t calls;
+};
+
+static struct
+{
+	precise_t time;
+	uint32_t calls;
+} ps_statestats[NUMSTATES];
+
 static int32_t draw_row;
 
 void PS_SetThinkFrameHookInfo(int index, precise_t time_taken, char* short_src)
@@ -99,6 +120,238 @@ void PS_ResetBotInfo(void)
 	ps_botticcmd_time = 0;
 }
 
+void PS_AddObjectTime(mobjtype_t type, ps_objcounter_t counter, precise_t start)
+{
+	if (!start)
+		return;
+
+	ps_mobjstats[type].time[counter] += I_GetPreciseTime() - start;
+	ps_mobjstats[type].calls[counter]++;
+}
+
+void PS_AddActionTime(mobjtype_t type, statenum_t state, precise_t start)
+{
+	precise_t t;
+
+	if (!start)
+		return;
+
+	t = I_GetPreciseTime() - start;
+
+	ps_mobjstats[type].time[PS_OBJ_ACTION] += t;
+	ps_mobjstats[type].calls[PS_OBJ_ACTION]++;
+
+	ps_statestats[state].time += t;
+	ps_statestats[state].calls++;
+}
+
+// Called once per tic, before any thinkers run.
+// Counters start from zero whenever the page is brought up.
+void PS_UpdateObjectProfile(void)
+{
+	const dboolean enable = (cv_perfstats.value == PS_OBJECTS);
+
+	if (enable && !ps_objprofile)
+	{
+		memset(ps_mobjstats, 0, sizeof(ps_mobjstats));
+		memset(ps_statestats, 0, sizeof(ps_statestats));
+		ps_objprofile_tics = 0;
+	}
+
+	ps_objprofile = enable;
+
+	if (ps_objprofile)
+		ps_objprofile_tics++;
+}
+
+static const char *PS_MobjTypeName(mobjtype_t type)
+{
+	if (type < MT_FIRSTFREESLOT)
+		return MOBJTYPE_LIST[type];
+	if (FREE_MOBJS[type - MT_FIRSTFREESLOT])
+		return va("MT_%s", FREE_MOBJS[type - MT_FIRSTFREESLOT]);
+	return va("MT_%d", type);
+}
+
+static const char *PS_ActionName(const struct ps_actionstat *stat)
+{
+	if (stat->name)
+		return stat->name;
+
+	// Lua actions all share one C function, so name them by state instead.
+	if (stat->state < S_FIRSTFREESLOT)
+		return va("Lua %s", STATE_LIST[stat->state]);
+	if (FREE_STATES[stat->state - S_FIRSTFREESLOT])
+		return va("Lua S_%s", FREE_STATES[stat->state - S_FIRSTFREESLOT]);
+	return va("Lua S_%d", stat->state);
+}
+
+static int PS_CompareMobjStats(const void *a, const void *b)
+{
+	const precise_t ta = ps_mobjstats[*(const mobjtype_t *)a].time[PS_OBJ_THINK];
+	const precise_t tb = ps_mobjstats[*(const mobjtype_t *)b].time[PS_OBJ_THINK];
+	return (ta < tb) - (ta > tb);
+}
+
+static int PS_CompareActionStats(const void *a, const void *b)
+{
+	const precise_t ta = ((const struct ps_actionstat *)a)->time;
+	const precise_t tb = ((const struct ps_actionstat *)b)->time;
+	return (ta < tb) - (ta > tb);
+}
+
+// Fills types with every mobjtype that has run, sorted by thinker time.
+static size_t PS_SortedMobjTypes(mobjtype_t *types)
+{
+	size_t count = 0;
+	mobjtype_t i;
+
+	for (i = 0; i < NUMMOBJTYPES; i++)
+	{
+		const ps_objstat_t *stat = &ps_mobjstats[i];
+
+		if (stat->calls[PS_OBJ_THINK] || stat->calls[PS_OBJ_XYMOVE] || stat->calls[PS_OBJ_ZMOVE]
+			|| stat->calls[PS_OBJ_CHECKPOS] || stat->calls[PS_OBJ_ACTION])
+			types[count++] = i;
+	}
+
+	qsort(types, count, sizeof *types, PS_CompareMobjStats);
+	return count;
+}
+
+// Folds the per-state counters into per-action totals, sorted by time.
+static size_t PS_SortedActions(struct ps_actionstat *actions, size_t maxactions)
+{
+	size_t count = 0;
+	size_t j;
+	statenum_t i;
+
+	for (i = 0; i < NUMSTATES; i++)
+	{
+		if (!ps_statestats[i].calls)
+			continue;
+
+		for (j = 0; j < count; j++)
+		{
+			if (actions[j].action.acp1 == states[i].action.acp1
+				&& (actions[j].name || actions[j].state == i))
+				break;
+		}
+
+		if (j == count)
+		{
+			size_t k;
+
+			if (count == maxactions)
+				continue;
+
+			actions[j].action = states[i].action;
+			actions[j].state = i;
+			actions[j].name = NULL;
+			actions[j].time = 0;
+			actions[j].calls = 0;
+
+			for (k = 0; actionpointers[k].name; k++)
+			{
+				if (actionpointers[k].action.acp1 == states[i].action.acp1)
+				{
+					actions[j].name = actionpointers[k].name;
+					break;
+				}
+			}
+
+			count++;
+		}
+
+		actions[j].time += ps_statestats[i].time;
+		actions[j].calls += ps_statestats[i].calls;
+	}
+
+	qsort(actions, count, sizeof *actions, PS_CompareActionStats);
+	return count;
+}
+
+#define PS_MAXACTIONS 512
+
+static mobjtype_t ps_sortedtypes[NUMMOBJTYPES];
+static struct ps_actionstat ps_sortedactions[PS_MAXACTIONS];
+
+void PS_DumpObjectStats(const char *filename)
+{
+	static const char *const counternames[NUM_PS_OBJ] = {"think", "xymove", "zmove", "checkpos", "action"};
+	const double us = I_GetPrecisePrecision() / 1000000.0;
+	char path[MAX_WADPATH];
+	size_t count, i;
+	int c;
+	FILE *f;
+
+	if (!ps_objprofile_tics)
+	{
+		CONS_Printf("No object stats yet, set perfstats to Objects first.\n");
+		return;
+	}
+
+	if (filename)
+	{
+		size_t len = strlen(filename);
+
+		if (len < 4 || stricmp(filename + len - 4, ".csv"))
+		{
+			CONS_Alert(CONS_NOTICE, "Object stats filename must be .csv\n");
+			return;
+		}
+
+		// Always write straight into srb2home
+		if (strpbrk(filename, "/\\:"))
+		{
+			CONS_Alert(CONS_NOTICE, "Object stats filename can't contain a path\n");
+			return;
+		}
+	}
+
+	snprintf(path, sizeof path, "%s" PATHSEP "%s", srb2home, filename ? filename : "objectstats.csv");
+
+	f = fopen(path, "w");
+
+	if (!f)
+	{
+		CONS_Alert(CONS_ERROR, "Couldn't open '%s' for writing.\n", path);
+		return;
+	}
+
+	// Totals over every profiled tic, times in microseconds.
+	fputs("kind,name,tics", f);
+	for (c = 0; c < NUM_PS_OBJ; c++)
+		fprintf(f, ",%s_calls,%s_us", counternames[c], counternames[c]);
+	fputc('\n', f);
+
+	count = PS_SortedMobjTypes(ps_sortedtypes);
+
+	for (i = 0; i < count; i++)
+	{
+		const ps_objstat_t *stat = &ps_mobjstats[ps_sortedtypes[i]];
+
+		fprintf(f, "mobj,%s,%d", PS_MobjTypeName(ps_sortedtypes[i]), ps_objprofile_tics);
+		for (c = 0; c < NUM_PS_OBJ; c++)
+			fprintf(f, ",%u,%.1f", stat->calls[c], stat->time[c] / us);
+		fputc('\n', f);
+	}
+
+	count = PS_SortedActions(ps_sortedactions, PS_MAXACTIONS);
+
+	for (i = 0; i < count; i++)
+	{
+		fprintf(f, "action,%s,%d", PS_ActionName(&ps_sortedactions[i]), ps_objprofile_tics);
+		for (c = 0; c < PS_OBJ_ACTION; c++)
+			fputs(",0,0.0", f);
+		fprintf(f, ",%u,%.1f\n", ps_sortedactions[i].calls, ps_sortedactions[i].time / us);
+	}
+
+	fclose(f);
+
+	CONS_Printf("Object stats for %d tics saved to '%s'\n", ps_objprofile_tics, path);
+}
+
 static void PS_SetFrameTime(void)
 {
 	precise_t currenttime = I_GetPreciseTime();
@@ -196,6 +449,7 @@ static void M_DrawRenderStats(void)
 		{"bsptime", "RenderBSPNode: ", &ps_bsptime},
 		{"sprclip", "R_ClipSprites: ", &ps_sw_spritecliptime},
 		{"portals", "Portals+Skybox:", &ps_sw_portaltime},
+		{"walls  ", "Wall columns:  ", &ps_sw_walltime},
 		{"planes ", "R_DrawPlanes:  ", &ps_sw_planetime},
 		{"masked ", "R_DrawMasked:  ", &ps_sw_maskedtime},
 		{"other  ", "Other:         ", &extrarendertime},
@@ -297,6 +551,7 @@ static void M_DrawRenderStats(void)
 			extrarendertime -=
 				ps_sw_spritecliptime +
 				ps_sw_portaltime +
+				ps_sw_walltime +
 				ps_sw_planetime +
 				ps_sw_maskedtime;
 
@@ -493,6 +748,67 @@ static void M_DrawTickStats(void)
 	M_DrawPerfCount(&misc_calls_col);
 }
 
+static void M_DrawObjectStats(void)
+{
+	const double us = I_GetPrecisePrecision() / 1000000.0;
+	const double tics = max(ps_objprofile_tics, 1);
+	size_t count, i;
+	char s[128];
+	int y = 4;
+
+	if (G_GamestateUsesLevel() == false)
+		return;
+
+	if (vid.width < 640 || vid.height < 400) // low resolution
+	{
+		// it's not gonna fit very well..
+		V_DrawThinString(30, 30, V_MONOSPACE | V_YELLOWMAP, "Not available for resolutions below 640x400");
+		return;
+	}
+
+	snprintf(s, sizeof s, "Average per tic over %d tics (us), dumpobjectstats to save", ps_objprofile_tics);
+	V_DrawSmallString(2, y, V_MONOSPACE | V_GRAYMAP, s);
+	y += 6;
+
+	snprintf(s, sizeof s, "%-24s %7s %7s %7s %7s %7s %6s", "Object", "Think", "XYMove", "ZMove", "ChkPos", "Action", "Count");
+	V_DrawSmallString(2, y, V_MONOSPACE | V_YELLOWMAP, s);
+	y += 4;
+
+	count = PS_SortedMobjTypes(ps_sortedtypes);
+
+	for (i = 0; i < count && i < 24; i++)
+	{
+		const ps_objstat_t *stat = &ps_mobjstats[ps_sortedtypes[i]];
+
+		snprintf(s, sizeof s, "%-24.24s %7.1f %7.1f %7.1f %7.1f %7.1f %6.1f", PS_MobjTypeName(ps_sortedtypes[i]),
+			stat->time[PS_OBJ_THINK] / us / tics,
+			stat->time[PS_OBJ_XYMOVE] / us / tics,
+			stat->time[PS_OBJ_ZMOVE] / us / tics,
+			stat->time[PS_OBJ_CHECKPOS] / us / tics,
+			stat->time[PS_OBJ_ACTION] / us / tics,
+			stat->calls[PS_OBJ_THINK] / tics);
+		V_DrawSmallString(2, y, V_MONOSPACE, s);
+		y += 4;
+	}
+
+	y += 4;
+
+	snprintf(s, sizeof s, "%-24s %7s %7s", "Action", "Time", "Calls");
+	V_DrawSmallString(2, y, V_MONOSPACE | V_YELLOWMAP, s);
+	y += 4;
+
+	count = PS_SortedActions(ps_sortedactions, PS_MAXACTIONS);
+
+	for (i = 0; i < count && y <= 192; i++)
+	{
+		snprintf(s, sizeof s, "%-24.24s %7.1f %7.1f", PS_ActionName(&ps_sortedactions[i]),
+			ps_sortedactions[i].time / us / tics,
+			ps_sortedactions[i].calls / tics);
+		V_DrawSmallString(2, y, V_MONOSPACE, s);
+		y += 4;
+	}
+}
+
 void M_DrawPerfStats(void)
 {
 	char s[363];
@@ -618,6 +934,10 @@ void M_DrawPerfStats(void)
 			}
 		}
 	}
+	else if (cv_perfstats.value == PS_OBJECTS) // per-mobjtype
+	{
+		M_DrawObjectStats();
+	}
 	else if (cv_perfstats.value == PS_THINKFRAME) // lua thinkframe
 	{
 		if (G_GamestateUsesLevel() == false)
@@ -16,6 +16,7 @@
 #include "doomdef.h"
 #include "lua_script.h"
 #include "p_local.h"
+#include "i_system.h" // I_GetPreciseTime
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +29,7 @@ typedef enum
 	PS_LOGIC,
 	PS_BOT,
 	PS_THINKFRAME,
+	PS_OBJECTS,
 } ps_types_t;
 
 extern precise_t ps_tictime;
@@ -53,6 +55,9 @@ struct ps_hookinfo_t
 	char short_src[LUA_IDSIZE];
 };
 
+extern ps_hookinfo_t *thinkframe_hooks;
+extern int thinkframe_hooks_length;
+
 void PS_SetThinkFrameHookInfo(int index, precise_t time_taken, char* short_src);
 
 struct ps_botinfo_t
@@ -68,6 +73,34 @@ extern ps_botinfo_t ps_bots[MAXPLAYERS];
 
 void PS_ResetBotInfo(void);
 
+// Per-mobjtype profiling, only collected while the
+// "Objects" perfstats page is up.
+typedef enum
+{
+	PS_OBJ_THINK, // P_MobjThinker
+	PS_OBJ_XYMOVE, // P_XYMovement
+	PS_OBJ_ZMOVE, // P_ZMovement
+	PS_OBJ_CHECKPOS, // P_CheckPosition
+	PS_OBJ_ACTION, // state actions
+	NUM_PS_OBJ
+} ps_objcounter_t;
+
+struct ps_objstat_t
+{
+	precise_t time[NUM_PS_OBJ];
+	uint32_t calls[NUM_PS_OBJ];
+};
+
+extern dboolean ps_objprofile;
+
+// Start time for PS_AddObjectTime, or 0 when not profiling.
+#define PS_StartObjectTimer() (ps_objprofile ? I_GetPreciseTime() : 0)
+
+void PS_AddObjectTime(mobjtype_t type, ps_objcounter_t counter, precise_t start);
+void PS_AddActionTime(mobjtype_t type, statenum_t state, precise_t start);
+void PS_UpdateObjectProfile(void);
+void PS_DumpObjectStats(const char *filename);
+
 void M_DrawPerfStats(void);
 
 #ifdef __cplusplus
@@ -166,10 +166,10 @@ static void UFOUpdateDistanceToFinish(mobj_t *ufo)
 		const dboolean useshortcuts = false;
 		const dboolean huntbackwards = false;
 		dboolean pathfindsuccess = false;
-		path_t pathtofinish = {0};
+		uint32_t disttofinish = 0U;
 
 		pathfindsuccess =
-			K_PathfindToWaypoint(nextWaypoint, finishLine, &pathtofinish, useshortcuts, huntbackwards);
+			K_GetWaypointRouteDistance(nextWaypoint, finishLine, useshortcuts, huntbackwards, &disttofinish);
 
 		// Update the UFO's distance to the finish line if a path was found.
 		if (pathfindsuccess == true)
@@ -184,8 +184,7 @@ static void UFOUpdateDistanceToFinish(mobj_t *ufo)
 
 			adddist = (uint32_t)disttowaypoint;
 
-			ufo_distancetofinish(ufo) = pathtofinish.totaldist + adddist;
-			Z_Free(pathtofinish.array);
+			ufo_distancetofinish(ufo) = disttofinish + adddist;
 		}
 	}
 }
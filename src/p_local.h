@@ -411,6 +411,11 @@ struct tm_t
 	fixed_t maxstep;
 };
 
+// The one collision context P_CheckPosition, P_TryMove and
+// the PIT_ functions work in. Nested queries save and restore
+// it with P_RestoreTMStruct. Position queries also share
+// spechit, line validcount marks and mobj reference counts, so
+// they must only ever run on the main thread.
 extern tm_t g_tm;
 
 void P_RestoreTMStruct(tm_t tmrestore);
@@ -460,6 +465,9 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2);
 dboolean P_TraceBlockingLines(mobj_t *t1, mobj_t *t2);
 dboolean P_TraceBotTraversal(mobj_t *t1, mobj_t *t2);
 dboolean P_TraceWaypointTraversal(mobj_t *t1, mobj_t *t2);
+void P_StartSightCache(void);
+void P_StopSightCache(void);
+void P_BuildSightZones(void);
 void P_CheckHoopPosition(mobj_t *hoopthing, fixed_t x, fixed_t y, fixed_t z, fixed_t radius);
 
 dboolean P_CheckSector(sector_t *sector, dboolean crunch);
@@ -488,6 +496,18 @@ fixed_t P_VeryBottomOfFOF (ffloor_t *rover);
 //
 // P_SETUP
 //
+
+// The things of one blocklinks chain, packed so iterating
+// doesn't chase a pointer into a different mobj every step.
+// Kept oldest first, so walking it backwards matches the
+// order of the chain exactly.
+struct blockcell_t
+{
+	mobj_t **things;
+	uint32_t count, capacity;
+	uint32_t version; // bumped on every link and unlink
+};
+
 extern uint8_t *rejectmatrix; // for fast sight rejection
 extern int32_t *blockmaplump; // offsets in blockmap are from here
 extern int32_t *blockmap; // Big blockmap
@@ -496,6 +516,7 @@ extern int32_t bmapheight; // in mapblocks
 extern fixed_t bmaporgx;
 extern fixed_t bmaporgy; // origin of block map
 extern mobj_t **blocklinks; // for thing chains
+extern blockcell_t *blockcells; // same chains as flat arrays, see P_BlockThingsIterator
 extern precipmobj_t **precipblocklinks; // special blockmap for precip rendering
 
 extern struct minimapinfo
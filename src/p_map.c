@@ -633,6 +633,8 @@ static BlockItReturn_t PIT_CheckThing(mobj_t *thing)
 			return BMIT_CONTINUE; // the line doesn't cross between either pair of opposite corners
 	}
 
+	if (LUA_MobjHookAvailable(thing->type, MOBJ_HOOK(MobjCollide))
+		|| LUA_MobjHookAvailable(g_tm.thing->type, MOBJ_HOOK(MobjMoveCollide)))
 	{
 		uint8_t shouldCollide = LUA_Hook2Mobj(thing, g_tm.thing, MOBJ_HOOK(MobjCollide)); // checks hook for thing's type
 		if (P_MobjWasRemoved(g_tm.thing) || P_MobjWasRemoved(thing))
@@ -1932,6 +1934,7 @@ static BlockItReturn_t PIT_CheckLine(line_t *ld)
 
 	// this line is out of the if so upper and lower textures can be hit by a splat
 
+	if (LUA_MobjHookAvailable(g_tm.thing->type, MOBJ_HOOK(MobjLineCollide)))
 	{
 		uint8_t shouldCollide = LUA_HookMobjLineCollide(g_tm.thing, ld); // checks hook for thing's type
 		if (P_MobjWasRemoved(g_tm.thing))
@@ -2094,7 +2097,18 @@ static BlockItReturn_t PIT_CheckLine(line_t *ld)
 // g_tm.ceilingz
 //     the nearest ceiling or thing's bottom over g_tm.thing
 //
+static dboolean P_DoCheckPosition(mobj_t *thing, fixed_t x, fixed_t y, TryMoveResult_t *result);
+
 dboolean P_CheckPosition(mobj_t *thing, fixed_t x, fixed_t y, TryMoveResult_t *result)
+{
+	mobjtype_t type = thing->type;
+	precise_t t = PS_StartObjectTimer();
+	dboolean ret = P_DoCheckPosition(thing, x, y, result);
+	PS_AddObjectTime(type, PS_OBJ_CHECKPOS, t);
+	return ret;
+}
+
+static dboolean P_DoCheckPosition(mobj_t *thing, fixed_t x, fixed_t y, TryMoveResult_t *result)
 {
 	int32_t thingtop = thing->z + thing->height;
 	int32_t xl, xh, yl, yh, bx, by;
@@ -1024,6 +1024,51 @@ void P_LineOpening(line_t *linedef, mobj_t *mobj, opening_t *open)
 // THING POSITION SETTING
 //
 
+//
+// P_AddToBlockCell
+// Mirrors a thing being pushed onto the head of
+// blocklinks[cell] in the packed copy of that chain.
+//
+static void P_AddToBlockCell(mobj_t *thing, int32_t cell)
+{
+	blockcell_t *bc = &blockcells[cell];
+
+	if (bc->count == bc->capacity)
+	{
+		bc->capacity = bc->capacity ? bc->capacity * 2 : 8;
+		bc->things = Z_Realloc(bc->things, bc->capacity * sizeof (*bc->things), PU_LEVEL, NULL);
+	}
+
+	bc->things[bc->count++] = thing;
+	bc->version++;
+
+	thing->blockcell = cell;
+}
+
+//
+// P_RemoveFromBlockCell
+// Mirrors a thing being unlinked from its blocklinks chain.
+// The cell is remembered rather than worked out again,
+// since the thing may have moved since it was linked.
+//
+static void P_RemoveFromBlockCell(mobj_t *thing)
+{
+	blockcell_t *bc = &blockcells[thing->blockcell];
+	uint32_t i;
+
+	// Most things that move are near the head of the chain.
+	for (i = bc->count; i > 0; i--)
+	{
+		if (bc->things[i-1] == thing)
+		{
+			memmove(&bc->things[i-1], &bc->things[i], (bc->count - i) * sizeof (*bc->things));
+			bc->count--;
+			bc->version++;
+			return;
+		}
+	}
+}
+
 //
 // P_UnsetThingPosition
 // Unlinks a thing from block map and sectors.
@@ -1081,6 +1126,10 @@ void P_UnsetThingPosition(mobj_t *thing)
 		*/
 
 		mobj_t *bnext, **bprev = thing->bprev;
+
+		if (bprev)
+			P_RemoveFromBlockCell(thing);
+
 		if (bprev && (*bprev = bnext = thing->bnext) != NULL)  // unlink from block map
 			bnext->bprev = bprev;
 	}
@@ -1098,7 +1147,9 @@ void P_UnsetPrecipThingPosition(precipmobj_t *thing)
 	thing->touching_sectorlist = NULL; //to be restored by P_SetPrecipThingPosition
 }
 
-static void P_LinkToBlockMap(mobj_t *thing, mobj_t **bmap)
+// Returns the blockmap cell the thing was linked into,
+// or -1 if it's off the map.
+static int32_t P_LinkToBlockMap(mobj_t *thing, mobj_t **bmap)
 {
 	const int32_t blockx = (unsigned)(thing->x - bmaporgx) >> MAPBLOCKSHIFT;
 	const int32_t blocky = (unsigned)(thing->y - bmaporgy) >> MAPBLOCKSHIFT;
@@ -1120,10 +1171,13 @@ static void P_LinkToBlockMap(mobj_t *thing, mobj_t **bmap)
 
 		thing->bprev = link;
 		*link = thing;
+
+		return (blocky * bmapwidth) + blockx;
 	}
 	else // thing is off the map
 	{
 		thing->bnext = NULL, thing->bprev = NULL;
+		return -1;
 	}
 }
 
@@ -1186,7 +1240,10 @@ void P_SetThingPosition(mobj_t *thing)
 	if (!(thing->flags & MF_NOBLOCKMAP))
 	{
 		// inert things don't need to be in blockmap
-		P_LinkToBlockMap(thing, blocklinks);
+		const int32_t cell = P_LinkToBlockMap(thing, blocklinks);
+
+		if (cell != -1)
+			P_AddToBlockCell(thing, cell);
 	}
 
 	// Allows you to 'step' on a new linedef exec when the previous
@@ -1347,33 +1404,65 @@ dboolean P_BlockLinesIterator(int32_t x, int32_t y, BlockItReturn_t (*func)(line
 //
 // P_BlockThingsIterator
 //
+// Walks the packed copy of the cell for as long as nothing
+// links into or unlinks from it. Once func does, the rest is
+// taken from the chain itself, exactly like it always was.
+//
+// bnext doesn't need a reference: even if func removes it,
+// a removed mobj stays in memory until the thinker loop gets
+// to it, which can't happen in the middle of this.
+//
 dboolean P_BlockThingsIterator(int32_t x, int32_t y, BlockItReturn_t (*func)(mobj_t *))
 {
-	mobj_t *mobj, *bnext = NULL;
+	const blockcell_t *bc;
+	mobj_t *mobj, *bnext;
+	uint32_t version, i;
 
 	if (x < 0 || y < 0 || x >= bmapwidth || y >= bmapheight)
 		return true;
 
+	bc = &blockcells[y*bmapwidth + x];
+	version = bc->version;
+
 	// Check interaction with the objects in the blockmap.
-	for (mobj = blocklinks[y*bmapwidth + x]; mobj; mobj = bnext)
+	for (i = bc->count; i > 0; i--)
 	{
 		BlockItReturn_t ret = BMIT_CONTINUE;
 
-		P_SetTarget(&bnext, mobj->bnext); // We want to note our reference to bnext here incase it is MF_NOTHINK and gets removed!
+		mobj = bc->things[i-1];
+		bnext = (i > 1) ? bc->things[i-2] : NULL;
+
+		ret = func(mobj);
+
+		if (ret == BMIT_ABORT)
+			return false; // failure
+
+		if ((ret == BMIT_STOP)
+			|| (bnext && P_MobjWasRemoved(bnext))) // func just broke blockmap chain, cannot continue.
+			return true; // success
+
+		if (bc->version != version)
+			break;
+	}
+
+	if (i <= 1)
+		return true;
+
+	// func moved something in this cell, so the packed copy
+	// no longer lines up with where we were in the chain.
+	for (mobj = bnext; mobj; mobj = bnext)
+	{
+		BlockItReturn_t ret = BMIT_CONTINUE;
+
+		bnext = mobj->bnext;
 		ret = func(mobj);
 
 		if (ret == BMIT_ABORT)
-		{
-			P_SetTarget(&bnext, NULL);
 			return false; // failure
-		}
 
 		if ((ret == BMIT_STOP)
 			|| (bnext && P_MobjWasRemoved(bnext))) // func just broke blockmap chain, cannot continue.
-		{
-			P_SetTarget(&bnext, NULL);
 			return true; // success
-		}
 	}
 
 	return true;
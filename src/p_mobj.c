@@ -34,6 +34,7 @@
 #include "info.h"
 #include "i_video.h"
 #include "lua_hook.h"
+#include "core/thread_pool.h"
 #include "p_slopes.h"
 #include "f_finale.h"
 #include "m_cond.h"
@@ -54,6 +55,7 @@
 #include "m_easing.h"
 #include "k_podium.h"
 #include "g_party.h"
+#include "m_perfstats.h"
 
 actioncache_t actioncachehead;
 
@@ -376,7 +378,10 @@ dboolean P_SetPlayerMobjState(mobj_t *mobj, statenum_t state)
 			var1 = st->var1;
 			var2 = st->var2;
 			astate = st;
+			mobjtype_t pstype = mobj->type;
+			precise_t pstime = PS_StartObjectTimer();
 			st->action.acp1(mobj);
+			PS_AddActionTime(pstype, st - states, pstime);
 
 			// woah. a player was removed by an action.
 			// this sounds like a VERY BAD THING, but there's nothing we can do now...
@@ -500,7 +505,10 @@ dboolean P_SetMobjState(mobj_t *mobj, statenum_t state)
 			var1 = st->var1;
 			var2 = st->var2;
 			astate = st;
+			mobjtype_t pstype = mobj->type;
+			precise_t pstime = PS_StartObjectTimer();
 			st->action.acp1(mobj);
+			PS_AddActionTime(pstype, st - states, pstime);
 			if (P_MobjWasRemoved(mobj))
 				return false;
 		}
@@ -1617,7 +1625,18 @@ static dboolean P_CheckSkyHit(mobj_t *mo)
 //
 // P_XYMovement
 //
+static dboolean P_DoXYMovement(mobj_t *mo);
+
 dboolean P_XYMovement(mobj_t *mo)
+{
+	mobjtype_t type = mo->type;
+	precise_t t = PS_StartObjectTimer();
+	dboolean ret = P_DoXYMovement(mo);
+	PS_AddObjectTime(type, PS_OBJ_XYMOVE, t);
+	return ret;
+}
+
+static dboolean P_DoXYMovement(mobj_t *mo)
 {
 	player_t *player;
 	fixed_t xmove, ymove;
@@ -2294,7 +2313,18 @@ static void P_CheckStepUpReset(mobj_t *mo)
 // P_ZMovement
 // Returns false if the mobj was killed/exploded/removed, true otherwise.
 //
+static dboolean P_DoZMovement(mobj_t *mo);
+
 dboolean P_ZMovement(mobj_t *mo)
+{
+	mobjtype_t type = mo->type;
+	precise_t t = PS_StartObjectTimer();
+	dboolean ret = P_DoZMovement(mo);
+	PS_AddObjectTime(type, PS_OBJ_ZMOVE, t);
+	return ret;
+}
+
+static dboolean P_DoZMovement(mobj_t *mo)
 {
 	fixed_t dist, delta;
 	dboolean onground;
@@ -4330,6 +4360,82 @@ dboolean P_PrecipThinker(precipmobj_t *mobj)
 	return true;
 }
 
+//
+// P_PrecipFall
+//
+// The part of P_PrecipThinker that a drop goes through on almost
+// every tic: fall, count down its state, animate. It only writes to
+// the drop itself, so drops can run it in parallel. Returns false,
+// without touching the drop, if it has a state change due this tic.
+//
+static dboolean P_PrecipFall(precipmobj_t *mobj)
+{
+	const dboolean flip = (mobj->precipflags & PCF_FLIP);
+	const dboolean splash = (mobj->precipflags & PCF_SPLASH);
+	fixed_t z = mobj->z;
+
+	if (mobj->lastThink == leveltime)
+		return true;
+
+	if (mobj->state == &states[S_RAINRETURN])
+		return false;
+
+	if (mobj->tics != -1 && mobj->tics <= 1)
+		return false;
+
+	if (!splash)
+	{
+		z += mobj->momz;
+
+		if ((flip) ? (z >= mobj->ceilingz) : (z <= mobj->floorz))
+			return false;
+	}
+
+	mobj->lastThink = leveltime;
+
+	R_ResetPrecipitationMobjInterpolationState(mobj);
+	P_CycleStateAnimation((mobj_t *)mobj);
+
+	if (mobj->tics != -1)
+		mobj->tics--;
+
+	mobj->z = z;
+
+	return true;
+}
+
+static void P_PrecipFallRange(size_t first, size_t last, void *data)
+{
+	precipmobj_t **drops = data;
+
+	for (; first < last; ++first)
+		P_PrecipFall(drops[first]);
+}
+
+//
+// P_PrecipThinkBatch
+//
+// Runs the thinkers of a list of drops. The drops that are just
+// falling are spread over the thread pool. Any that change state
+// finish on this thread, since that can free them or touch the RNG.
+// Freed drops are set to NULL in the list.
+//
+void P_PrecipThinkBatch(precipmobj_t **drops, size_t count)
+{
+	size_t i;
+
+	I_ThreadPoolParallelFor(0, count, 1024, P_PrecipFallRange, drops);
+
+	for (i = 0; i < count; ++i)
+	{
+		if (drops[i]->lastThink == leveltime)
+			continue;
+
+		if (!P_PrecipThinker(drops[i]))
+			drops[i] = NULL;
+	}
+}
+
 static void P_RingThinker(mobj_t *mobj)
 {
 	mobj_t *spark;	// Ring Fuse
@@ -5930,10 +6036,13 @@ static dboolean P_ParticleGenSceneryThink(mobj_t *mobj)
 
 static void P_MobjSceneryThink(mobj_t *mobj)
 {
-	if (LUA_HookMobj(mobj, MOBJ_HOOK(MobjThinker)))
-		return;
-	if (P_MobjWasRemoved(mobj))
-		return;
+	if (LUA_MobjHookAvailable(mobj->type, MOBJ_HOOK(MobjThinker)))
+	{
+		if (LUA_HookMobj(mobj, MOBJ_HOOK(MobjThinker)))
+			return;
+		if (P_MobjWasRemoved(mobj))
+			return;
+	}
 
 	switch (mobj->type)
 	{
@@ -10695,7 +10804,8 @@ static dboolean P_FuseThink(mobj_t *mobj)
 	if (mobj->fuse)
 		return true;
 
-	if (LUA_HookMobj(mobj, MOBJ_HOOK(MobjFuse)) || P_MobjWasRemoved(mobj))
+	if (LUA_MobjHookAvailable(mobj->type, MOBJ_HOOK(MobjFuse))
+		&& (LUA_HookMobj(mobj, MOBJ_HOOK(MobjFuse)) || P_MobjWasRemoved(mobj)))
 		;
 	else switch (mobj->type)
 	{
@@ -10985,7 +11095,9 @@ void P_MobjThinker(mobj_t *mobj)
 	}
 
 	// Check for a Lua thinker first
-	if (!mobj->player)
+	if (!LUA_MobjHookAvailable(mobj->type, MOBJ_HOOK(MobjThinker)))
+		;
+	else if (!mobj->player)
 	{
 		if (LUA_HookMobj(mobj, MOBJ_HOOK(MobjThinker)) || P_MobjWasRemoved(mobj))
 			return;
@@ -11978,7 +12090,10 @@ mobj_t *P_SpawnMobj(fixed_t x, fixed_t y, fixed_t z, mobjtype_t type)
 			var1 = st->var1;
 			var2 = st->var2;
 			astate = st;
+			mobjtype_t pstype = mobj->type;
+			precise_t pstime = PS_StartObjectTimer();
 			st->action.acp1(mobj);
+			PS_AddActionTime(pstype, st - states, pstime);
 			// DANGER! This can cause P_SpawnMobj to return NULL!
 			// Avoid using MF_RUNSPAWNFUNC on mobjs whose spawn state expects target or tracer to already be set!
 			if (P_MobjWasRemoved(mobj))
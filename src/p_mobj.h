@@ -412,6 +412,8 @@ struct mobj_t
 
 	int32_t po_movecount; // Polyobject carrying (NOT savegame, NOT Lua)
 
+	int32_t blockcell; // Index into blockcells while bprev is set (NOT savegame, NOT Lua)
+
 	// WARNING: New fields must be added separately to savegame and Lua.
 };
 
@@ -538,6 +540,7 @@ dboolean P_BossTargetPlayer(mobj_t *actor, dboolean closest);
 dboolean P_SupermanLook4Players(mobj_t *actor);
 void P_DestroyRobots(void);
 dboolean P_PrecipThinker(precipmobj_t *mobj);
+void P_PrecipThinkBatch(precipmobj_t **drops, size_t count);
 void P_NullPrecipThinker(precipmobj_t *mobj);
 void P_FreePrecipMobj(precipmobj_t *mobj);
 void P_SetScale(mobj_t *mobj, fixed_t newscale);
@@ -2929,7 +2929,6 @@ static void P_NetArchiveWorld(savebuffer_t *save)
 
 	ArchiveSectors(save);
 	ArchiveLines(save);
-	R_ClearTextureNumCache(false);
 
 	TracyCZoneEnd(__zone);
 }
@@ -3456,15 +3455,8 @@ static void SaveMobjThinker(savebuffer_t *save, const thinker_t *th, const uint8
 
 	if (diff & MD_SPAWNPOINT)
 	{
-		size_t z;
-
-		for (z = 0; z < nummapthings; z++)
-		{
-			if (&mapthings[z] != mobj->spawnpoint)
-				continue;
-			WRITEUINT16(save->p, z);
-			break;
-		}
+		if (mobj->spawnpoint >= mapthings && mobj->spawnpoint < mapthings + nummapthings)
+			WRITEUINT16(save->p, mobj->spawnpoint - mapthings);
 		if (mobj->type == MT_HOOPCENTER)
 			return;
 	}
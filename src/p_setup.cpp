@@ -188,6 +188,7 @@ int32_t *blockmaplump; // Big blockmap
 fixed_t bmaporgx, bmaporgy;
 // for thing chains
 mobj_t **blocklinks;
+blockcell_t *blockcells;
 precipmobj_t **precipblocklinks;
 
 // REJECT
@@ -595,6 +596,21 @@ size_t numlevelflats;
 levelflat_t *levelflats;
 levelflat_t *foundflats;
 
+static texnameindex_t levelflatindex;
+
+// Returns -1 if the flat hasn't been added to the level yet.
+static int32_t P_FindLevelFlat(const levelflat_t *levelflat, const char *flatname)
+{
+	const int32_t i = R_FindInNameIndex(&levelflatindex, flatname);
+
+	// The index outlives the level, make sure it's talking
+	// about this one.
+	if (i != -1 && (size_t)i < numlevelflats && strnicmp(levelflat[i].name, flatname, 8) == 0)
+		return i;
+
+	return -1;
+}
+
 //SoM: Other files want this info.
 size_t P_PrecacheLevelFlats(void)
 {
@@ -624,14 +640,11 @@ static int32_t
 Ploadflat (levelflat_t *levelflat, const char *flatname, dboolean resize)
 {
 	int       texturenum;
-	size_t i;
+	int32_t found;
 
-	// Scan through the already found flats, return if it matches.
-	for (i = 0; i < numlevelflats; i++)
-	{
-		if (strnicmp(levelflat[i].name, flatname, 8) == 0)
-			return i;
-	}
+	// Return the already found flat if it matches.
+	if ((found = P_FindLevelFlat(levelflat, flatname)) != -1)
+		return found;
 
 	if (resize)
 	{
@@ -675,6 +688,8 @@ texturefound:
 
 	CONS_Debug(DBG_SETUP, "flat #%03d: %s\n", atoi(sizeu1(numlevelflats)), levelflat->name);
 
+	R_AddToNameIndex(&levelflatindex, levelflat->name, (int32_t)numlevelflats);
+
 	return ( numlevelflats++ );
 }
 
@@ -699,21 +714,13 @@ int32_t P_AddLevelFlatRuntime(const char *flatname)
 //
 int32_t P_CheckLevelFlat(const char *flatname)
 {
-	size_t i;
-	levelflat_t *levelflat = levelflats;
-
-	//
-	//  scan through the already found flats
-	//
-	for (i = 0; i < numlevelflats; i++, levelflat++)
-		if (strnicmp(levelflat->name,flatname,8)==0)
-			break;
+	const int32_t i = P_FindLevelFlat(levelflats, flatname);
 
-	if (i == numlevelflats)
+	if (i == -1)
 		return 0; // ??? flat was not found, this should not happen!
 
 	// level flat id
-	return (int32_t)i;
+	return i;
 }
 
 //
@@ -3574,6 +3581,7 @@ static dboolean P_LoadMapData(const virtres_t *virt)
 		I_Error("Ran out of memory while loading sectors\n");
 
 	numlevelflats = 0;
+	R_ClearNameIndex(&levelflatindex);
 
 	// Load map data.
 	if (udmf)
@@ -3592,8 +3600,6 @@ static dboolean P_LoadMapData(const virtres_t *virt)
 
 	P_ProcessLinedefsAfterSidedefs();
 
-	R_ClearTextureNumCache(true);
-
 	// set the sky flat num
 	skyflatnum = P_AddLevelFlat(SKYFLATNAME, foundflats);
 
@@ -4188,6 +4194,8 @@ static dboolean P_LoadBlockMap(uint8_t *data, size_t count)
 	// clear out mobj chains
 	count = sizeof (*blocklinks)* bmapwidth*bmapheight;
 	blocklinks = static_cast<mobj_t**>(Z_Calloc(count, PU_LEVEL, NULL));
+	count = sizeof (*blockcells) * bmapwidth * bmapheight;
+	blockcells = static_cast<blockcell_t*>(Z_Calloc(count, PU_LEVEL, NULL));
 	blockmap = blockmaplump+4;
 
 	// haleyjd 2/22/06: setup polyobject blockmap
@@ -4445,6 +4453,8 @@ static void P_CreateBlockMap(void)
 		size_t count = sizeof (*blocklinks) * bmapwidth * bmapheight;
 		// clear out mobj chains (copied from from P_LoadBlockMap)
 		blocklinks = static_cast<mobj_t**>(Z_Calloc(count, PU_LEVEL, NULL));
+		count = sizeof (*blockcells) * bmapwidth * bmapheight;
+		blockcells = static_cast<blockcell_t*>(Z_Calloc(count, PU_LEVEL, NULL));
 		blockmap = blockmaplump + 4;
 
 		// haleyjd 2/22/06: setup polyobject blockmap
@@ -7579,6 +7589,7 @@ static dboolean P_LoadMapFromFile(void)
 	P_LoadMapLUT(curmapvirt);
 
 	P_LinkMapData();
+	P_BuildSightZones();
 
 	if (!udmf)
 		P_AddBinaryMapTags();
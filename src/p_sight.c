@@ -19,6 +19,7 @@
 #include "p_slopes.h"
 #include "r_main.h"
 #include "r_state.h"
+#include "z_zone.h"
 
 #include "k_bot.h" // K_BotHatesThisSector
 #include "k_kart.h" // K_TripwirePass
@@ -54,6 +55,38 @@ typedef struct
 
 static int32_t sightcounts[2];
 
+// Which group of connected sectors each sector is in; see
+// P_BuildSightZones.
+static size_t *sightzones = NULL;
+
+typedef enum
+{
+	SIGHT_CHECK,
+	SIGHT_BLOCKING,
+	SIGHT_BOTTRAVERSAL,
+	SIGHT_WAYPOINTTRAVERSAL,
+} sighttrace_t;
+
+// Results of recent traces, only kept between
+// P_StartSightCache and P_StopSightCache.
+#define SIGHTCACHE_SIZE 1024 // must be a power of two
+#define SIGHTCACHE_PROBES 8
+
+typedef struct
+{
+	mobj_t *t1, *t2;
+	fixed_t x1, y1, z1, height1;
+	fixed_t x2, y2, z2, height2;
+	uint32_t eflags1;
+	uint32_t stamp;
+	uint8_t kind;
+	dboolean result;
+} sightmemo_t;
+
+static sightmemo_t sightcache[SIGHTCACHE_SIZE];
+static uint32_t sightstamp = 0; // 0 while the cache is off
+static uint32_t sightlaststamp = 0;
+
 #ifdef DEVELOP
 extern consvar_t cv_debugtraversemax;
 #undef TRAVERSE_MAX
@@ -681,11 +714,87 @@ static dboolean P_InitTraceBotTraversal(mobj_t *t1, mobj_t *t2, register los_t *
 	return true;
 }
 
-static dboolean P_CompareMobjsAcrossLines(mobj_t *t1, mobj_t *t2, register los_funcs_t *funcs)
+static size_t P_SightCacheSlot(const mobj_t *t1, const mobj_t *t2, sighttrace_t kind)
+{
+	uintptr_t hash = ((uintptr_t)t1 >> 4) * 0x9E3779B1u;
+
+	hash ^= ((uintptr_t)t2 >> 4) + kind;
+	hash *= 0x85EBCA6Bu;
+
+	return (hash ^ (hash >> 15)) & (SIGHTCACHE_SIZE - 1);
+}
+
+static dboolean P_SightMemoMatches(const sightmemo_t *memo, const mobj_t *t1, const mobj_t *t2, sighttrace_t kind)
+{
+	return (memo->stamp == sightstamp
+		&& memo->t1 == t1 && memo->t2 == t2 && memo->kind == kind
+		&& memo->x1 == t1->x && memo->y1 == t1->y && memo->z1 == t1->z
+		&& memo->height1 == t1->height && memo->eflags1 == t1->eflags
+		&& memo->x2 == t2->x && memo->y2 == t2->y && memo->z2 == t2->z
+		&& memo->height2 == t2->height);
+}
+
+static sightmemo_t *P_FindSightMemo(mobj_t *t1, mobj_t *t2, sighttrace_t kind)
+{
+	const size_t slot = P_SightCacheSlot(t1, t2, kind);
+	size_t i;
+
+	for (i = 0; i < SIGHTCACHE_PROBES; i++)
+	{
+		sightmemo_t *memo = &sightcache[(slot + i) & (SIGHTCACHE_SIZE - 1)];
+
+		if (memo->stamp != sightstamp)
+			break;
+
+		if (P_SightMemoMatches(memo, t1, t2, kind))
+			return memo;
+	}
+
+	return NULL;
+}
+
+static void P_AddSightMemo(mobj_t *t1, mobj_t *t2, sighttrace_t kind, dboolean result)
+{
+	const size_t slot = P_SightCacheSlot(t1, t2, kind);
+	sightmemo_t *memo = &sightcache[slot];
+	size_t i;
+
+	// Take the first free slot, or throw out the
+	// home slot if every probe is taken.
+	for (i = 0; i < SIGHTCACHE_PROBES; i++)
+	{
+		sightmemo_t *probe = &sightcache[(slot + i) & (SIGHTCACHE_SIZE - 1)];
+
+		if (probe->stamp != sightstamp)
+		{
+			memo = probe;
+			break;
+		}
+	}
+
+	memo->t1 = t1;
+	memo->t2 = t2;
+	memo->x1 = t1->x;
+	memo->y1 = t1->y;
+	memo->z1 = t1->z;
+	memo->height1 = t1->height;
+	memo->eflags1 = t1->eflags;
+	memo->x2 = t2->x;
+	memo->y2 = t2->y;
+	memo->z2 = t2->z;
+	memo->height2 = t2->height;
+	memo->kind = kind;
+	memo->result = result;
+	memo->stamp = sightstamp;
+}
+
+static dboolean P_CompareMobjsAcrossLines(mobj_t *t1, mobj_t *t2, sighttrace_t kind, register los_funcs_t *funcs)
 {
 	los_t los;
 	const sector_t *s1, *s2;
 	size_t pnum;
+	sightmemo_t *memo;
+	dboolean result;
 
 	// First check for trivial rejection.
 	if (P_MobjWasRemoved(t1) == true || P_MobjWasRemoved(t2) == true)
@@ -712,6 +821,14 @@ static dboolean P_CompareMobjsAcrossLines(mobj_t *t1, mobj_t *t2, register los_f
 		}
 	}
 
+	// Plenty of maps don't have a REJECT lump, or have an
+	// empty one. Sectors no two-sided line leads between
+	// can't be connected either.
+	if (sightzones != NULL && sightzones[s1-sectors] != sightzones[s2-sectors])
+	{
+		return false;
+	}
+
 	// killough 11/98: shortcut for melee situations
 	// same subsector? obviously visible
 	// haleyjd 02/23/06: can't do this if there are polyobjects in the subsec
@@ -721,6 +838,16 @@ static dboolean P_CompareMobjsAcrossLines(mobj_t *t1, mobj_t *t2, register los_f
 		return true;
 	}
 
+	if (sightstamp != 0)
+	{
+		memo = P_FindSightMemo(t1, t2, kind);
+
+		if (memo != NULL)
+		{
+			return memo->result;
+		}
+	}
+
 	validcount++;
 
 	los.t1 = t1;
@@ -745,19 +872,25 @@ static dboolean P_CompareMobjsAcrossLines(mobj_t *t1, mobj_t *t2, register los_f
 	else
 		los.bbox[BOXTOP] = t2->y, los.bbox[BOXBOTTOM] = t1->y;
 
-	if (funcs->init != NULL)
+	// The only required function.
+	I_Assert(funcs->validate != NULL);
+
+	if (funcs->init != NULL && funcs->init(t1, t2, &los) == false)
 	{
-		if (funcs->init(t1, t2, &los) == false)
-		{
-			return false;
-		}
+		result = false;
+	}
+	else
+	{
+		// the head node is the last node output
+		result = P_CrossBSPNode((int32_t)numnodes - 1, &los, funcs);
 	}
 
-	// The only required function.
-	I_Assert(funcs->validate != NULL);
+	if (sightstamp != 0)
+	{
+		P_AddSightMemo(t1, t2, kind, result);
+	}
 
-	// the head node is the last node output
-	return P_CrossBSPNode((int32_t)numnodes - 1, &los, funcs);
+	return result;
 }
 
 //
@@ -774,7 +907,7 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2)
 	funcs.validate = &P_IsVisible;
 	funcs.validatePolyobj = &P_IsVisiblePolyObj;
 
-	return P_CompareMobjsAcrossLines(t1, t2, &funcs);
+	return P_CompareMobjsAcrossLines(t1, t2, SIGHT_CHECK, &funcs);
 }
 
 dboolean P_TraceBlockingLines(mobj_t *t1, mobj_t *t2)
@@ -783,7 +916,7 @@ dboolean P_TraceBlockingLines(mobj_t *t1, mobj_t *t2)
 
 	funcs.validate = &P_CanTraceBlockingLine;
 
-	return P_CompareMobjsAcrossLines(t1, t2, &funcs);
+	return P_CompareMobjsAcrossLines(t1, t2, SIGHT_BLOCKING, &funcs);
 }
 
 dboolean P_TraceBotTraversal(mobj_t *t1, mobj_t *t2)
@@ -793,7 +926,7 @@ dboolean P_TraceBotTraversal(mobj_t *t1, mobj_t *t2)
 	funcs.init = &P_InitTraceBotTraversal;
 	funcs.validate = &P_CanBotTraverse;
 
-	return P_CompareMobjsAcrossLines(t1, t2, &funcs);
+	return P_CompareMobjsAcrossLines(t1, t2, SIGHT_BOTTRAVERSAL, &funcs);
 }
 
 dboolean P_TraceWaypointTraversal(mobj_t *t1, mobj_t *t2)
@@ -802,5 +935,86 @@ dboolean P_TraceWaypointTraversal(mobj_t *t1, mobj_t *t2)
 
 	funcs.validate = &P_CanWaypointTraverse;
 
-	return P_CompareMobjsAcrossLines(t1, t2, &funcs);
+	return P_CompareMobjsAcrossLines(t1, t2, SIGHT_WAYPOINTTRAVERSAL, &funcs);
+}
+
+//
+// P_StartSightCache
+//
+// Remember the result of every trace until P_StopSightCache,
+// so asking again about the same two objects is free. Only
+// the objects are checked, not the level, so this is for
+// stretches of code that don't move any geometry; building
+// bot ticcmds, for one.
+//
+void P_StartSightCache(void)
+{
+	if (++sightlaststamp == 0)
+	{
+		// Wrapped around, old entries could look current.
+		memset(sightcache, 0, sizeof sightcache);
+		sightlaststamp = 1;
+	}
+
+	sightstamp = sightlaststamp;
+}
+
+void P_StopSightCache(void)
+{
+	sightstamp = 0;
+}
+
+//
+// P_BuildSightZones
+//
+// Groups sectors that are connected through two-sided lines.
+// A line of sight can only ever pass through those, so two
+// sectors in different groups can't see each other, which
+// works as a REJECT table for maps that don't have one.
+//
+static size_t P_SightZoneRoot(size_t sec)
+{
+	while (sightzones[sec] != sec)
+	{
+		sightzones[sec] = sightzones[sightzones[sec]];
+		sec = sightzones[sec];
+	}
+
+	return sec;
+}
+
+void P_BuildSightZones(void)
+{
+	size_t i;
+
+	sightzones = Z_Malloc(numsectors * sizeof (*sightzones), PU_LEVEL, &sightzones);
+
+	for (i = 0; i < numsectors; i++)
+	{
+		sightzones[i] = i;
+	}
+
+	for (i = 0; i < numlines; i++)
+	{
+		const line_t *ld = &lines[i];
+		size_t front, back;
+
+		if (ld->frontsector == NULL || ld->backsector == NULL)
+		{
+			continue;
+		}
+
+		front = P_SightZoneRoot(ld->frontsector - sectors);
+		back = P_SightZoneRoot(ld->backsector - sectors);
+
+		if (front != back)
+		{
+			sightzones[max(front, back)] = min(front, back);
+		}
+	}
+
+	for (i = 0; i < numsectors; i++)
+	{
+		sightzones[i] = P_SightZoneRoot(i);
+	}
 }
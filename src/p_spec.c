@@ -242,7 +242,6 @@ void P_InitPicAnims(void)
 		lastanim++;
 	}
 	lastanim->istexture = -1;
-	R_ClearTextureNumCache(false);
 
 	// Clear animdefs now that we're done with it.
 	// We'll only be using anims from now on.
@@ -4539,6 +4538,7 @@ dboolean P_ProcessSpecial(activator_t *activator, int16_t special, int32_t *args
 			{
 				sector_t *sec;
 				mobj_t *thing;
+				dboolean toggled = false;
 
 				if (waypointcap == NULL)
 				{
@@ -4562,9 +4562,16 @@ dboolean P_ProcessSpecial(activator_t *activator, int16_t special, int32_t *args
 							{
 								thing->extravalue1 = 0;
 							}
+
+							toggled = true;
 						}
 					}
 				}
+
+				if (toggled)
+				{
+					K_InvalidateWaypointRoutes();
+				}
 			}
 			break;
 
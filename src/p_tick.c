@@ -573,7 +573,18 @@ static void P_RunThinkers(void)
 #ifdef PARANOIA
 			I_Assert(currentthinker->function.acp1 != NULL);
 #endif
-			currentthinker->function.acp1(currentthinker);
+			if (ps_objprofile && currentthinker->function.acp1 == (actionf_p1)P_MobjThinker)
+			{
+				// Read the type first, the mobj may be removed while it thinks.
+				mobjtype_t type = ((mobj_t *)currentthinker)->type;
+				precise_t t = I_GetPreciseTime();
+				currentthinker->function.acp1(currentthinker);
+				PS_AddObjectTime(type, PS_OBJ_THINK, t);
+			}
+			else
+			{
+				currentthinker->function.acp1(currentthinker);
+			}
 		}
 		ps_thlist_times[i] = I_GetPreciseTime() - ps_thlist_times[i];
 	}
@@ -787,6 +798,8 @@ void P_Ticker(dboolean run)
 		ps_lua_mobjhooks = 0;
 		ps_checkposition_calls = 0;
 
+		PS_UpdateObjectProfile();
+
 		LUA_HOOK(PreThinkFrame);
 
 		ps_playerthink_time = I_GetPreciseTime();
@@ -1252,6 +1265,9 @@ void P_Ticker(dboolean run)
 
 	P_MapEnd();
 
+	// Earn time for LUA_Step to collect garbage with.
+	LUA_AddGCBudget();
+
 	for (i = 0; i < MAXPLAYERS; i++)
 	{
 		G_CopyTiccmd(&players[i].oldcmd, &players[i].cmd, 1);
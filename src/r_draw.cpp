@@ -17,7 +17,11 @@
 ///        The frame buffer is a linear one, and we need only the base address.
 
 #include <algorithm>
+#include <array>
+#include <memory>
 
+#include "core/thread_pool.h"
+#include "core/vector.hpp"
 #include "doomdef.h"
 #include "doomstat.h"
 #include "r_local.h"
@@ -31,6 +35,16 @@
 #include "k_color.h" // SRB2kart
 #include "i_threads.h"
 #include "libdivide.h" // used by NPO2 tilted span functions
+#include "m_argv.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h> // __cpuid
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
 
 #ifdef HWRENDER
 #include "hardware/hw_main.h"
@@ -656,9 +670,252 @@ void R_DrawViewBorder(void)
 }
 #endif
 
+// ==========================================================================
+//                        PARALLEL COLUMN DRAWING
+// ==========================================================================
+
+namespace
+{
+
+// Narrow enough that a view splits into many more strips than there are pool
+// threads, wide enough that each task outweighs its scheduling overhead.
+constexpr const int32_t kColumnStripWidth = 16;
+constexpr const size_t kColumnScratchBlockSize = 64 * 1024;
+
+struct ColumnCommand
+{
+	coldrawfunc_t* func;
+	drawcolumndata_t dc;
+};
+
+// Per-view globals the column drawers depend on
+struct ColumnTarget
+{
+	uint8_t* topleft;
+	fixed_t centeryfrac;
+};
+
+struct ColumnBatch
+{
+	bool active = false;
+	bool pending = false;
+	bool in_flight = false;
+	ColumnTarget target {};
+	srb2::ThreadPool::Sema sema;
+	std::array<srb2::Vector<ColumnCommand>, (MAXVIDWIDTH + kColumnStripWidth - 1) / kColumnStripWidth> strips;
+
+	// Blocks are never moved, so pointers handed out stay valid until the flush
+	srb2::Vector<std::unique_ptr<uint8_t[]>> scratch_blocks;
+	srb2::Vector<std::unique_ptr<uint8_t[]>> scratch_oversized;
+	size_t scratch_block = 0;
+	size_t scratch_height = 0;
+
+	void* allocate(size_t size);
+	void dispatch();
+	void wait();
+	void reset();
+};
+
+// One batch per splitscreen view, so a finished view can keep drawing on the
+// pool while the next one is walked.
+std::array<ColumnBatch, MAXSPLITSCREENPLAYERS> g_column_batches;
+ColumnBatch* g_column_batch = nullptr;
+
+// Set while a worker replays a batch; the main thread may already be
+// rendering another view by then.
+thread_local const ColumnTarget* tl_column_target = nullptr;
+
+void* ColumnBatch::allocate(size_t size)
+{
+	size = (size + 15) & ~static_cast<size_t>(15);
+
+	if (size > kColumnScratchBlockSize)
+	{
+		scratch_oversized.push_back(std::make_unique<uint8_t[]>(size));
+		return scratch_oversized.back().get();
+	}
+
+	if (scratch_height + size > kColumnScratchBlockSize)
+	{
+		scratch_block++;
+		scratch_height = 0;
+	}
+
+	if (scratch_block >= scratch_blocks.size())
+	{
+		scratch_blocks.push_back(std::make_unique<uint8_t[]>(kColumnScratchBlockSize));
+	}
+
+	void* ptr = scratch_blocks[scratch_block].get() + scratch_height;
+	scratch_height += size;
+	return ptr;
+}
+
+void ColumnBatch::dispatch()
+{
+	I_Assert(!in_flight);
+
+	if (!pending)
+	{
+		return;
+	}
+
+	srb2::g_main_threadpool->begin_sema();
+	for (auto& strip : strips)
+	{
+		if (strip.empty())
+		{
+			continue;
+		}
+
+		srb2::Vector<ColumnCommand>* commands = &strip;
+		const ColumnTarget* replay_target = &target;
+		srb2::g_main_threadpool->schedule([commands, replay_target]() {
+			const ColumnTarget* old_target = tl_column_target;
+			tl_column_target = replay_target;
+			for (ColumnCommand& command : *commands)
+			{
+				(command.func)(&command.dc);
+			}
+			tl_column_target = old_target;
+		});
+	}
+	sema = srb2::g_main_threadpool->end_sema();
+	srb2::g_main_threadpool->notify_sema(sema);
+	in_flight = true;
+}
+
+void ColumnBatch::wait()
+{
+	if (!in_flight)
+	{
+		return;
+	}
+
+	ZoneScoped;
+
+	srb2::g_main_threadpool->wait_sema(sema);
+	sema = {};
+	in_flight = false;
+	reset();
+}
+
+void ColumnBatch::reset()
+{
+	for (auto& strip : strips)
+	{
+		strip.clear();
+	}
+	scratch_oversized.clear();
+	scratch_block = 0;
+	scratch_height = 0;
+	pending = false;
+}
+
+} // namespace
+
+static inline uint8_t *R_ColumnTopLeft(void)
+{
+	return tl_column_target ? tl_column_target->topleft : topleft;
+}
+
+static inline fixed_t R_ColumnCenterYFrac(void)
+{
+	return tl_column_target ? tl_column_target->centeryfrac : centeryfrac;
+}
+
+void R_BeginColumnBatch(void)
+{
+	I_Assert(g_column_batch == nullptr);
+
+	g_column_batch = &g_column_batches[viewssnum];
+
+	// Still drawing this view from the previous frame
+	g_column_batch->wait();
+
+	g_column_batch->active = cv_parallelsoftware.value;
+	g_column_batch->target = {topleft, centeryfrac};
+}
+
+void R_FlushColumnBatch(void)
+{
+	if (g_column_batch == nullptr || !g_column_batch->pending)
+	{
+		return;
+	}
+
+	ZoneScoped;
+
+	g_column_batch->dispatch();
+	g_column_batch->wait();
+}
+
+void R_EndColumnBatch(void)
+{
+	if (g_column_batch == nullptr)
+	{
+		return;
+	}
+
+	// Don't wait; R_FinishColumnBatches collects it
+	g_column_batch->dispatch();
+	g_column_batch->active = false;
+	g_column_batch = nullptr;
+}
+
+void R_FinishColumnBatches(void)
+{
+	for (auto& batch : g_column_batches)
+	{
+		batch.wait();
+	}
+}
+
+dboolean R_ColumnBatchActive(void)
+{
+	return g_column_batch != nullptr && g_column_batch->active;
+}
+
+void R_SubmitColumn(coldrawfunc_t *func, const drawcolumndata_t *dc)
+{
+	drawcolumndata_t dc_copy = *dc;
+
+	if (!R_ColumnBatchActive())
+	{
+		func(&dc_copy);
+		return;
+	}
+
+	if ((unsigned)dc->x >= (unsigned)vid.width || dc->x >= MAXVIDWIDTH)
+	{
+		// The drawers would reject this column anyway
+		return;
+	}
+	size_t strip = dc->x / kColumnStripWidth;
+
+	// The caller keeps stepping its lightlist heights for the next column
+	if (dc_copy.numlights > 0 && dc_copy.lightlist != NULL)
+	{
+		size_t size = sizeof(*dc_copy.lightlist) * dc_copy.numlights;
+		dc_copy.lightlist = static_cast<r_lightlist_t*>(g_column_batch->allocate(size));
+		M_Memcpy(dc_copy.lightlist, dc->lightlist, size);
+		dc_copy.maxlights = dc_copy.numlights;
+	}
+
+	g_column_batch->strips[strip].push_back({func, dc_copy});
+	g_column_batch->pending = true;
+}
+
+void *R_AllocColumnScratch(size_t size)
+{
+	I_Assert(g_column_batch != nullptr);
+	return g_column_batch->allocate(size);
+}
+
 // ==========================================================================
 //                   INCLUDE MAIN DRAWERS CODE HERE
 // ==========================================================================
 
+#include "r_draw_simd.cpp"
 #include "r_draw_column.cpp"
 #include "r_draw_span.cpp"
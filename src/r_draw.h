@@ -129,6 +129,37 @@ extern spandrawfunc_t *spanfuncs_npo2[SPANDRAWFUNC_MAX];
 extern spandrawfunc_t *spanfuncs_bm_npo2[SPANDRAWFUNC_MAX];
 extern spandrawfunc_t *spanfuncs_flat[SPANDRAWFUNC_MAX];
 
+// -----------------------
+// PARALLEL COLUMN DRAWING
+// -----------------------
+
+// While a column batch is active, column draws are recorded into vertical
+// strips of the view instead of being drawn immediately. Flushing replays
+// each strip on the thread pool in submission order, so overlapping columns
+// still composite back-to-front. Anything that draws outside the column
+// drawers (spans, splats, debug lines) must flush first.
+// Each splitscreen view has its own batch. Ending one hands its remaining
+// strips to the pool without waiting, so its masked columns keep drawing
+// while the next view renders. Only that masked column drawing overlaps;
+// the views themselves are still rendered one at a time.
+// R_FinishColumnBatches must be called before the views are read back.
+void R_BeginColumnBatch(void);
+void R_FlushColumnBatch(void);
+void R_EndColumnBatch(void);
+void R_FinishColumnBatches(void);
+dboolean R_ColumnBatchActive(void);
+
+// Draws the column, or records it if a batch is active. dc->lightlist is
+// copied; dc->source and dc->brightmap must stay valid until the next flush.
+void R_SubmitColumn(coldrawfunc_t *func, const drawcolumndata_t *dc);
+
+// Scratch memory that lives until the next R_FlushColumnBatch.
+void *R_AllocColumnScratch(size_t size);
+
+// Picks the SSE2/AVX2/NEON variant of the power-of-two column and span
+// drawers for this CPU. -nosimd forces the scalar drawers.
+void R_InitDrawSimd(void);
+
 // ------------------------------------------------
 // r_draw.c COMMON ROUTINES FOR BOTH 8bpp and 16bpp
 // ------------------------------------------------
@@ -94,7 +94,7 @@ static constexpr uint8_t R_DrawColumnPixel(drawcolumndata_t* dc, uint8_t *dest,
 /**	\brief The R_DrawColumn function
 	Experiment to make software go faster. Taken from the Boom source
 */
-template<DrawColumnType Type>
+template<DrawColumnType Type, DrawSimd Simd>
 static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 {
 	int32_t count;
@@ -171,7 +171,7 @@ static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 				dc_copy.yh = realyh;
 			}
 
-			R_DrawColumnTemplate<NewType>(&dc_copy);
+			R_DrawColumnTemplate<NewType, Simd>(&dc_copy);
 			if (solid)
 			{
 				dc_copy.yl = bheight;
@@ -194,7 +194,7 @@ static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 
 		if (dc_copy.yl <= realyh)
 		{
-			R_DrawColumnTemplate<NewType>(&dc_copy);
+			R_DrawColumnTemplate<NewType, Simd>(&dc_copy);
 		}
 	}
 	else
@@ -210,14 +210,14 @@ static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 		// Use columnofs LUT for subwindows?
 
 		//dest = ylookup[dc_yl] + columnofs[dc_x];
-		dest = &topleft[dc->yl * vid.width + dc->x];
+		dest = &R_ColumnTopLeft()[dc->yl * vid.width + dc->x];
 
 		count++;
 
 		// Determine scaling, which is the only mapping to be done.
 		fracstep = dc->iscale;
 		//frac = dc_texturemid + (dc_yl - centery)*fracstep;
-		frac = (dc->texturemid + FixedMul((dc->yl << FRACBITS) - centeryfrac, fracstep)) * (!dc->hires);
+		frac = (dc->texturemid + FixedMul((dc->yl << FRACBITS) - R_ColumnCenterYFrac(), fracstep)) * (!dc->hires);
 
 		// Inner loop that does the actual texture mapping, e.g. a DDA-like scaling.
 		// This is as fast as it gets.
@@ -287,6 +287,25 @@ static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 		}
 		else
 		{
+			if constexpr (Simd != DrawSimd::kScalar)
+			{
+				uint32_t bits[8];
+
+				while (count >= 8)
+				{
+					R_StepColumnTexels<Simd>(bits, frac, fracstep, heightmask);
+
+					for (int i = 0; i < 8; i++)
+					{
+						*dest = R_DrawColumnPixel<Type>(dc, dest, bits[i]);
+						dest += vid.width;
+					}
+
+					frac = static_cast<fixed_t>(static_cast<uint32_t>(frac) + static_cast<uint32_t>(fracstep) * 8);
+					count -= 8;
+				}
+			}
+
 			while ((count -= 2) >= 0) // texture height is a power of 2
 			{
 				*dest = R_DrawColumnPixel<Type>(dc, dest, (frac>>FRACBITS) & heightmask);
@@ -312,8 +331,9 @@ static void R_DrawColumnTemplate(drawcolumndata_t *dc)
 	void name(drawcolumndata_t *dc) \
 	{ \
 		ZoneScoped; \
-		constexpr DrawColumnType opt = static_cast<DrawColumnType>(flags); \
-		R_DrawColumnTemplate<opt>(dc); \
+		R_DrawSimdDispatch([dc]<DrawSimd Simd>() { \
+			R_DrawColumnTemplate<static_cast<DrawColumnType>(flags), Simd>(dc); \
+		}); \
 	}
 
 #define DEFINE_COLUMN_COMBO(name, flags) \
@@ -348,7 +368,7 @@ void R_DrawFogColumn(drawcolumndata_t *dc)
 	// Use ylookup LUT to avoid multiply with ScreenWidth.
 	// Use columnofs LUT for subwindows?
 	//dest = ylookup[dc_yl] + columnofs[dc_x];
-	dest = &topleft[dc->yl*vid.width + dc->x];
+	dest = &R_ColumnTopLeft()[dc->yl*vid.width + dc->x];
 
 	// Determine scaling, which is the only mapping to be done.
 	do
@@ -378,7 +398,7 @@ void R_DrawDropShadowColumn(drawcolumndata_t *dc)
 	if (count <= 0) // Zero length, column does not exceed a pixel.
 		return;
 
-	dest = &topleft[dc->yl*vid.width + dc->x];
+	dest = &R_ColumnTopLeft()[dc->yl*vid.width + dc->x];
 
 	const uint8_t *transmap_offset = dc->transmap + (dc->shadowcolor << 8);
 	while ((count -= 2) >= 0)
@@ -414,7 +434,7 @@ void R_DrawColumn_Flat(drawcolumndata_t *dc)
 	// Use columnofs LUT for subwindows?
 
 	//dest = ylookup[dc_yl] + columnofs[dc_x];
-	dest = &topleft[dc->yl*vid.width + dc->x];
+	dest = &R_ColumnTopLeft()[dc->yl*vid.width + dc->x];
 
 	count++;
 
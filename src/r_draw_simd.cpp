@@ -0,0 +1,295 @@
+// DR. ROBOTNIK'S RING RACERS
+//-----------------------------------------------------------------------------
+// Copyright (C) 2025 by Kart Krew.
+//
+// This program is free software distributed under the
+// terms of the GNU General Public License, version 2.
+// See the 'LICENSE' file for more details.
+//-----------------------------------------------------------------------------
+/// \file  r_draw_simd.cpp
+/// \brief Vectorized texel addressing for the power-of-two column and span drawers
+/// \note  no includes because this is included as part of r_draw.cpp
+
+// The expensive part of a drawer is the serial DDA: every pixel adds the step,
+// shifts, masks and then does a dependent load. The texel indices themselves
+// don't depend on each other, so they are computed 4 or 8 at a time in vector
+// registers. The texture and colormap loads stay scalar; a byte gather would
+// have to read whole dwords and could run off the end of a lump or colormap.
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define R_DRAW_SIMD_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define R_DRAW_SIMD_NEON
+#endif
+
+#if defined(R_DRAW_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+// AVX2 is not part of the x86-64 baseline, so only the functions that use it
+// are compiled for it. flatten pulls the whole drawer template into the AVX2
+// function so the index kernel can be inlined into the pixel loop.
+#define R_DRAW_AVX2_TARGET __attribute__((target("avx2"), flatten))
+#define R_DRAW_AVX2_KERNEL __attribute__((target("avx2"))) static inline
+#else
+#define R_DRAW_AVX2_TARGET
+#define R_DRAW_AVX2_KERNEL static inline
+#endif
+
+enum class DrawSimd
+{
+	kScalar,
+	kSSE2,
+	kAVX2,
+	kNEON,
+};
+
+static DrawSimd g_drawsimd = DrawSimd::kScalar;
+
+// Span texels: bit[i] = (((y + i*ystep) >> yshift) & mask) | ((x + i*xstep) >> xshift)
+// Column texels: bit[i] = ((frac + i*fracstep) >> FRACBITS) & heightmask
+
+static inline void R_StepSpanTexels_Scalar(uint32_t *bits, uint32_t x, uint32_t y, uint32_t xstep, uint32_t ystep, uint32_t xshift, uint32_t yshift, uint32_t mask)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		bits[i] = ((y >> yshift) & mask) | (x >> xshift);
+		x += xstep;
+		y += ystep;
+	}
+}
+
+static inline void R_StepColumnTexels_Scalar(uint32_t *bits, uint32_t frac, uint32_t fracstep, int32_t heightmask)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		bits[i] = (static_cast<int32_t>(frac) >> FRACBITS) & heightmask;
+		frac += fracstep;
+	}
+}
+
+#ifdef R_DRAW_SIMD_X86
+static inline void R_StepSpanTexels_SSE2(uint32_t *bits, uint32_t x, uint32_t y, uint32_t xstep, uint32_t ystep, uint32_t xshift, uint32_t yshift, uint32_t mask)
+{
+	// SSE2 has no 32-bit multiply, so the lane offsets are built with adds.
+	__m128i vx = _mm_setr_epi32(x, x + xstep, x + xstep*2, x + xstep*3);
+	__m128i vy = _mm_setr_epi32(y, y + ystep, y + ystep*2, y + ystep*3);
+	const __m128i vxstep = _mm_set1_epi32(xstep*4);
+	const __m128i vystep = _mm_set1_epi32(ystep*4);
+	const __m128i vxshift = _mm_cvtsi32_si128(xshift);
+	const __m128i vyshift = _mm_cvtsi32_si128(yshift);
+	const __m128i vmask = _mm_set1_epi32(mask);
+
+	__m128i lo = _mm_or_si128(_mm_and_si128(_mm_srl_epi32(vy, vyshift), vmask), _mm_srl_epi32(vx, vxshift));
+	vx = _mm_add_epi32(vx, vxstep);
+	vy = _mm_add_epi32(vy, vystep);
+	__m128i hi = _mm_or_si128(_mm_and_si128(_mm_srl_epi32(vy, vyshift), vmask), _mm_srl_epi32(vx, vxshift));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(bits), lo);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(bits + 4), hi);
+}
+
+static inline void R_StepColumnTexels_SSE2(uint32_t *bits, uint32_t frac, uint32_t fracstep, int32_t heightmask)
+{
+	__m128i vfrac = _mm_setr_epi32(frac, frac + fracstep, frac + fracstep*2, frac + fracstep*3);
+	const __m128i vstep = _mm_set1_epi32(fracstep*4);
+	const __m128i vmask = _mm_set1_epi32(heightmask);
+
+	__m128i lo = _mm_and_si128(_mm_srai_epi32(vfrac, FRACBITS), vmask);
+	vfrac = _mm_add_epi32(vfrac, vstep);
+	__m128i hi = _mm_and_si128(_mm_srai_epi32(vfrac, FRACBITS), vmask);
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(bits), lo);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(bits + 4), hi);
+}
+
+R_DRAW_AVX2_KERNEL void R_StepSpanTexels_AVX2(uint32_t *bits, uint32_t x, uint32_t y, uint32_t xstep, uint32_t ystep, uint32_t xshift, uint32_t yshift, uint32_t mask)
+{
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i vx = _mm256_add_epi32(_mm256_set1_epi32(x), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(xstep)));
+	const __m256i vy = _mm256_add_epi32(_mm256_set1_epi32(y), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(ystep)));
+	const __m256i vmask = _mm256_set1_epi32(mask);
+
+	const __m256i out = _mm256_or_si256(
+		_mm256_and_si256(_mm256_srl_epi32(vy, _mm_cvtsi32_si128(yshift)), vmask),
+		_mm256_srl_epi32(vx, _mm_cvtsi32_si128(xshift))
+	);
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(bits), out);
+}
+
+R_DRAW_AVX2_KERNEL void R_StepColumnTexels_AVX2(uint32_t *bits, uint32_t frac, uint32_t fracstep, int32_t heightmask)
+{
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i vfrac = _mm256_add_epi32(_mm256_set1_epi32(frac), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(fracstep)));
+	const __m256i out = _mm256_and_si256(_mm256_srai_epi32(vfrac, FRACBITS), _mm256_set1_epi32(heightmask));
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(bits), out);
+}
+#endif // R_DRAW_SIMD_X86
+
+#ifdef R_DRAW_SIMD_NEON
+static inline void R_StepSpanTexels_NEON(uint32_t *bits, uint32_t x, uint32_t y, uint32_t xstep, uint32_t ystep, uint32_t xshift, uint32_t yshift, uint32_t mask)
+{
+	static const uint32_t kLanes[4] = {0, 1, 2, 3};
+	const uint32x4_t lanes = vld1q_u32(kLanes);
+	uint32x4_t vx = vmlaq_n_u32(vdupq_n_u32(x), lanes, xstep);
+	uint32x4_t vy = vmlaq_n_u32(vdupq_n_u32(y), lanes, ystep);
+	const uint32x4_t vxstep = vdupq_n_u32(xstep*4);
+	const uint32x4_t vystep = vdupq_n_u32(ystep*4);
+	// NEON only shifts left by a register; a negative count shifts right.
+	const int32x4_t vxshift = vdupq_n_s32(-static_cast<int32_t>(xshift));
+	const int32x4_t vyshift = vdupq_n_s32(-static_cast<int32_t>(yshift));
+	const uint32x4_t vmask = vdupq_n_u32(mask);
+
+	vst1q_u32(bits, vorrq_u32(vandq_u32(vshlq_u32(vy, vyshift), vmask), vshlq_u32(vx, vxshift)));
+	vx = vaddq_u32(vx, vxstep);
+	vy = vaddq_u32(vy, vystep);
+	vst1q_u32(bits + 4, vorrq_u32(vandq_u32(vshlq_u32(vy, vyshift), vmask), vshlq_u32(vx, vxshift)));
+}
+
+static inline void R_StepColumnTexels_NEON(uint32_t *bits, uint32_t frac, uint32_t fracstep, int32_t heightmask)
+{
+	static const uint32_t kLanes[4] = {0, 1, 2, 3};
+	const uint32x4_t lanes = vld1q_u32(kLanes);
+	int32x4_t vfrac = vreinterpretq_s32_u32(vmlaq_n_u32(vdupq_n_u32(frac), lanes, fracstep));
+	const int32x4_t vstep = vdupq_n_s32(static_cast<int32_t>(fracstep*4));
+	const int32x4_t vmask = vdupq_n_s32(heightmask);
+
+	vst1q_u32(bits, vreinterpretq_u32_s32(vandq_s32(vshrq_n_s32(vfrac, FRACBITS), vmask)));
+	vfrac = vaddq_s32(vfrac, vstep);
+	vst1q_u32(bits + 4, vreinterpretq_u32_s32(vandq_s32(vshrq_n_s32(vfrac, FRACBITS), vmask)));
+}
+#endif // R_DRAW_SIMD_NEON
+
+template <DrawSimd Simd>
+static inline void R_StepSpanTexels(uint32_t *bits, uint32_t x, uint32_t y, uint32_t xstep, uint32_t ystep, uint32_t xshift, uint32_t yshift, uint32_t mask)
+{
+#if defined(R_DRAW_SIMD_X86)
+	if constexpr (Simd == DrawSimd::kAVX2)
+	{
+		R_StepSpanTexels_AVX2(bits, x, y, xstep, ystep, xshift, yshift, mask);
+		return;
+	}
+	else if constexpr (Simd == DrawSimd::kSSE2)
+	{
+		R_StepSpanTexels_SSE2(bits, x, y, xstep, ystep, xshift, yshift, mask);
+		return;
+	}
+#elif defined(R_DRAW_SIMD_NEON)
+	if constexpr (Simd == DrawSimd::kNEON)
+	{
+		R_StepSpanTexels_NEON(bits, x, y, xstep, ystep, xshift, yshift, mask);
+		return;
+	}
+#endif
+	R_StepSpanTexels_Scalar(bits, x, y, xstep, ystep, xshift, yshift, mask);
+}
+
+template <DrawSimd Simd>
+static inline void R_StepColumnTexels(uint32_t *bits, uint32_t frac, uint32_t fracstep, int32_t heightmask)
+{
+#if defined(R_DRAW_SIMD_X86)
+	if constexpr (Simd == DrawSimd::kAVX2)
+	{
+		R_StepColumnTexels_AVX2(bits, frac, fracstep, heightmask);
+		return;
+	}
+	else if constexpr (Simd == DrawSimd::kSSE2)
+	{
+		R_StepColumnTexels_SSE2(bits, frac, fracstep, heightmask);
+		return;
+	}
+#elif defined(R_DRAW_SIMD_NEON)
+	if constexpr (Simd == DrawSimd::kNEON)
+	{
+		R_StepColumnTexels_NEON(bits, frac, fracstep, heightmask);
+		return;
+	}
+#endif
+	R_StepColumnTexels_Scalar(bits, frac, fracstep, heightmask);
+}
+
+#ifdef R_DRAW_SIMD_X86
+template <typename F>
+R_DRAW_AVX2_TARGET static void R_DrawSimd_AVX2(F& draw)
+{
+	draw.template operator()<DrawSimd::kAVX2>();
+}
+#endif
+
+// Calls draw.operator()<Simd>() with the instruction set picked by R_InitDrawSimd.
+template <typename F>
+static inline void R_DrawSimdDispatch(F&& draw)
+{
+	switch (g_drawsimd)
+	{
+#if defined(R_DRAW_SIMD_X86)
+	case DrawSimd::kAVX2:
+		R_DrawSimd_AVX2(draw);
+		break;
+	case DrawSimd::kSSE2:
+		draw.template operator()<DrawSimd::kSSE2>();
+		break;
+#elif defined(R_DRAW_SIMD_NEON)
+	case DrawSimd::kNEON:
+		draw.template operator()<DrawSimd::kNEON>();
+		break;
+#endif
+	default:
+		draw.template operator()<DrawSimd::kScalar>();
+		break;
+	}
+}
+
+static DrawSimd R_DetectDrawSimd(void)
+{
+	if (M_CheckParm("-nosimd"))
+	{
+		return DrawSimd::kScalar;
+	}
+
+#if defined(R_DRAW_SIMD_X86)
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		return DrawSimd::kAVX2;
+	}
+#elif defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] >= 7)
+	{
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		__cpuidex(info, 7, 0);
+		const bool avx2 = (info[1] & (1 << 5)) != 0;
+
+		// The OS also has to save the YMM registers across context switches.
+		if (osxsave && avx2 && (_xgetbv(0) & 6) == 6)
+		{
+			return DrawSimd::kAVX2;
+		}
+	}
+#endif
+	return DrawSimd::kSSE2;
+#elif defined(R_DRAW_SIMD_NEON)
+	return DrawSimd::kNEON;
+#else
+	return DrawSimd::kScalar;
+#endif
+}
+
+void R_InitDrawSimd(void)
+{
+	static bool detected = false;
+	static const char *names[] = {"scalar", "SSE2", "AVX2", "NEON"};
+
+	if (detected)
+	{
+		return;
+	}
+
+	g_drawsimd = R_DetectDrawSimd();
+	detected = true;
+
+	CONS_Printf("R_InitDrawSimd: using %s drawers\n", names[static_cast<int>(g_drawsimd)]);
+}
@@ -137,7 +137,7 @@ static constexpr uint8_t R_DrawSpanPixel(drawspandata_t* ds, uint8_t *dsrc, uint
 /**	\brief The R_DrawSpan_8 function
 	Draws the actual span.
 */
-template<DrawSpanType Type>
+template<DrawSpanType Type, DrawSimd Simd>
 static void R_DrawSpanTemplate(drawspandata_t* ds)
 {
 	fixed_t xposition;
@@ -192,14 +192,31 @@ static void R_DrawSpanTemplate(drawspandata_t* ds)
 		// have the uber complicated math to calculate it now, so that was a memory write we didn't
 		// need!
 
-		for (i = 0; i < 8; i++)
+		if constexpr (Simd != DrawSimd::kScalar)
 		{
-			bit = (((uint32_t)yposition >> ds->nflatyshift) & ds->nflatmask) | ((uint32_t)xposition >> ds->nflatxshift);
+			uint32_t bits[8];
 
-			dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], ds->colormap, bit);
+			R_StepSpanTexels<Simd>(bits, xposition, yposition, xstep, ystep, ds->nflatxshift, ds->nflatyshift, ds->nflatmask);
 
-			xposition += xstep;
-			yposition += ystep;
+			for (i = 0; i < 8; i++)
+			{
+				dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], ds->colormap, bits[i]);
+			}
+
+			xposition += xstep * 8;
+			yposition += ystep * 8;
+		}
+		else
+		{
+			for (i = 0; i < 8; i++)
+			{
+				bit = (((uint32_t)yposition >> ds->nflatyshift) & ds->nflatmask) | ((uint32_t)xposition >> ds->nflatxshift);
+
+				dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], ds->colormap, bit);
+
+				xposition += xstep;
+				yposition += ystep;
+			}
 		}
 
 		dest += 8;
@@ -250,7 +267,7 @@ static void R_CalcTiltedLighting(int32_t *lightbuffer, int32_t x1, int32_t x2, f
 	}
 }
 
-template<DrawSpanType Type>
+template<DrawSpanType Type, DrawSimd Simd>
 static void R_DrawTiltedSpanTemplate(drawspandata_t* ds)
 {
 	// x1, x2 = ds_x1, ds_x2
@@ -354,16 +371,38 @@ static void R_DrawTiltedSpanTemplate(drawspandata_t* ds)
 
 		x1 = ds->x1;
 
-		for (i = 0; i < SPANSIZE; i++)
+		if constexpr (Simd != DrawSimd::kScalar)
 		{
-			bit = (((v + stepv * i) >> nflatyshift) & nflatmask) | ((u + stepu * i) >> nflatxshift);
+			uint32_t bits[SPANSIZE];
 
-			if constexpr (!(Type & DS_SPRITE))
+			for (i = 0; i < SPANSIZE; i += 8)
 			{
-				colormap = ds->planezlight[tiltlighting[x1 + i]] + (ds->colormap - colormaps);
+				R_StepSpanTexels<Simd>(&bits[i], u + stepu * i, v + stepv * i, stepu, stepv, nflatxshift, nflatyshift, nflatmask);
+			}
+
+			for (i = 0; i < SPANSIZE; i++)
+			{
+				if constexpr (!(Type & DS_SPRITE))
+				{
+					colormap = ds->planezlight[tiltlighting[x1 + i]] + (ds->colormap - colormaps);
+				}
+
+				dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], colormap, bits[i]);
 			}
+		}
+		else
+		{
+			for (i = 0; i < SPANSIZE; i++)
+			{
+				bit = (((v + stepv * i) >> nflatyshift) & nflatmask) | ((u + stepu * i) >> nflatxshift);
 
-			dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], colormap, bit);
+				if constexpr (!(Type & DS_SPRITE))
+				{
+					colormap = ds->planezlight[tiltlighting[x1 + i]] + (ds->colormap - colormaps);
+				}
+
+				dest[i] = R_DrawSpanPixel<Type>(ds, &dsrc[i], colormap, bit);
+			}
 		}
 
 		ds->x1 += SPANSIZE;
@@ -745,13 +784,23 @@ static void R_DrawTiltedNPO2SpanTemplate(drawspandata_t* ds)
 		template<opt>(ds); \
 	}
 
+// Power-of-two drawers step their texel indices with R_StepSpanTexels.
+#define DEFINE_SPAN_SIMD_FUNC(name, flags, template) \
+	void name(drawspandata_t* ds) \
+	{ \
+		ZoneScoped; \
+		R_DrawSimdDispatch([ds]<DrawSimd Simd>() { \
+			template<static_cast<DrawSpanType>(flags), Simd>(ds); \
+		}); \
+	}
+
 #define DEFINE_SPAN_COMBO(name, flags) \
-	DEFINE_SPAN_FUNC(name, flags, R_DrawSpanTemplate) \
-	DEFINE_SPAN_FUNC(name ## _Tilted, flags, R_DrawTiltedSpanTemplate) \
+	DEFINE_SPAN_SIMD_FUNC(name, flags, R_DrawSpanTemplate) \
+	DEFINE_SPAN_SIMD_FUNC(name ## _Tilted, flags, R_DrawTiltedSpanTemplate) \
 	DEFINE_SPAN_FUNC(name ## _NPO2, flags, R_DrawNPO2SpanTemplate) \
 	DEFINE_SPAN_FUNC(name ## _Tilted_NPO2, flags, R_DrawTiltedNPO2SpanTemplate) \
-	DEFINE_SPAN_FUNC(name ## _Brightmap, flags|DS_BRIGHTMAP, R_DrawSpanTemplate) \
-	DEFINE_SPAN_FUNC(name ## _Tilted_Brightmap, flags|DS_BRIGHTMAP, R_DrawTiltedSpanTemplate) \
+	DEFINE_SPAN_SIMD_FUNC(name ## _Brightmap, flags|DS_BRIGHTMAP, R_DrawSpanTemplate) \
+	DEFINE_SPAN_SIMD_FUNC(name ## _Tilted_Brightmap, flags|DS_BRIGHTMAP, R_DrawTiltedSpanTemplate) \
 	DEFINE_SPAN_FUNC(name ## _Brightmap_NPO2, flags|DS_BRIGHTMAP, R_DrawNPO2SpanTemplate) \
 	DEFINE_SPAN_FUNC(name ## _Tilted_Brightmap_NPO2, flags|DS_BRIGHTMAP, R_DrawTiltedNPO2SpanTemplate)
 
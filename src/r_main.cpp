@@ -127,6 +127,7 @@ precise_t ps_bsptime = 0;
 
 precise_t ps_sw_spritecliptime = 0;
 precise_t ps_sw_portaltime = 0;
+precise_t ps_sw_walltime = 0;
 precise_t ps_sw_planetime = 0;
 precise_t ps_sw_maskedtime = 0;
 
@@ -1568,8 +1569,8 @@ void R_RenderPlayerView(void)
 	ps_numbspcalls = ps_numpolyobjects = ps_numdrawnodes = 0;
 	ps_bsptime = I_GetPreciseTime();
 
-	srb2::ThreadPool::Sema tp_sema;
-	srb2::g_main_threadpool->begin_sema();
+	// Wall columns are recorded during the BSP walk and drawn in parallel
+	R_BeginColumnBatch();
 	R_RenderViewpoint(&masks[nummasks - 1], nummasks - 1);
 
 	ps_bsptime = I_GetPreciseTime() - ps_bsptime;
@@ -1594,11 +1595,6 @@ void R_RenderPlayerView(void)
 	ps_sw_portaltime = I_GetPreciseTime();
 	if (portal_base && !cv_debugrender_portal.value)
 	{
-		// tp_sema = srb2::g_main_threadpool->end_sema();
-		// srb2::g_main_threadpool->notify_sema(tp_sema);
-		// srb2::g_main_threadpool->wait_sema(tp_sema);
-		// srb2::g_main_threadpool->begin_sema();
-
 		portal_t *portal;
 
 		for(portal = portal_base; portal; portal = portal_base)
@@ -1636,15 +1632,18 @@ void R_RenderPlayerView(void)
 
 			Portal_Remove(portal);
 		}
-
-		// tp_sema = srb2::g_main_threadpool->end_sema();
-		// srb2::g_main_threadpool->notify_sema(tp_sema);
-		// srb2::g_main_threadpool->wait_sema(tp_sema);
-		// srb2::g_main_threadpool->begin_sema();
 	}
 	ps_sw_portaltime = I_GetPreciseTime() - ps_sw_portaltime;
 
+	// Portal passes draw over the main pass in submission order, so one
+	// flush after all of them is enough. Walls must land before planes.
+	ps_sw_walltime = I_GetPreciseTime();
+	R_FlushColumnBatch();
+	ps_sw_walltime = I_GetPreciseTime() - ps_sw_walltime;
+
 	ps_sw_planetime = I_GetPreciseTime();
+	srb2::ThreadPool::Sema tp_sema;
+	srb2::g_main_threadpool->begin_sema();
 	R_DrawPlanes();
 	tp_sema = srb2::g_main_threadpool->end_sema();
 	srb2::g_main_threadpool->notify_sema(tp_sema);
@@ -1655,8 +1654,13 @@ void R_RenderPlayerView(void)
 	// And now 3D floors/sides!
 	ps_sw_maskedtime = I_GetPreciseTime();
 	R_DrawMasked(masks, nummasks);
+	R_EndColumnBatch();
 	ps_sw_maskedtime = I_GetPreciseTime() - ps_sw_maskedtime;
 
+	// The debug overlays below draw over this view directly
+	if (cv_debugrender_visplanes.value || (portal_base && cv_debugrender_portal.value))
+		R_FinishColumnBatches();
+
 	if (cv_debugrender_visplanes.value)
 	{
 		for (int32_t i = 0; i < MAXVISPLANES; i++)
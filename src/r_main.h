@@ -104,6 +104,7 @@ extern precise_t ps_bsptime;
 
 extern precise_t ps_sw_spritecliptime;
 extern precise_t ps_sw_portaltime;
+extern precise_t ps_sw_walltime;
 extern precise_t ps_sw_planetime;
 extern precise_t ps_sw_maskedtime;
 
@@ -139,7 +139,6 @@ static void R_Render2sidedMultiPatchColumn(drawcolumndata_t* dc, column_t *colum
 			dc->brightmap = (uint8_t *)brightmap + 3;
 		}
 
-		drawcolumndata_t dc_copy = *dc;
 		coldrawfunc_t* colfunccopy = colfunc;
 
 		// FIXME: do something better to look these up WITHOUT affecting global state...
@@ -166,7 +165,7 @@ static void R_Render2sidedMultiPatchColumn(drawcolumndata_t* dc, column_t *colum
 			}
 		}
 
-		colfunccopy(const_cast<drawcolumndata_t*>(&dc_copy));
+		R_SubmitColumn(colfunccopy, dc);
 	}
 }
 
@@ -1395,7 +1394,7 @@ static void R_DrawWallColumn(drawcolumndata_t* dc, int32_t yl, int32_t yh, fixed
 		dc_copy.colormap += COLORMAP_REMAPOFFSET;
 		dc_copy.fullbright += COLORMAP_REMAPOFFSET;
 	}
-	colfunccopy(const_cast<drawcolumndata_t*>(&dc_copy));
+	R_SubmitColumn(colfunccopy, &dc_copy);
 }
 
 static void R_RenderSegLoop (drawcolumndata_t* dc)
@@ -65,13 +65,8 @@ int32_t *texturebrightmaps;
 
 int32_t g_texturenum_dbgline;
 
-// Painfully simple texture id cacheing to make maps load faster. :3
-static struct {
-	char name[9];
-	uint32_t hash;
-	int32_t id;
-} *tidcache = NULL;
-static int32_t tidcachelen = 0;
+// Every texture by name, later textures replace earlier ones.
+static texnameindex_t texturenameindex;
 
 //
 // MAPTEXTURE_T CACHING
@@ -1505,6 +1500,11 @@ static int32_t R_DefineTextures(int32_t i, uint16_t w)
 
 static void R_FinishLoadingTextures(int32_t add)
 {
+	int32_t i;
+
+	for (i = numtextures; i < numtextures + add; i++)
+		R_AddToNameIndex(&texturenameindex, textures[i]->name, i);
+
 	numtextures += add;
 
 #ifdef HWRENDER
@@ -1537,6 +1537,7 @@ void R_LoadTextures(void)
 		I_Error("No textures detected in any WADs!\n");
 
 	R_AllocateTextures(newtextures);
+	R_ClearNameIndex(&texturenameindex);
 
 	for (i = 0, w = 0; w < numwadfiles; w++)
 	{
@@ -2085,14 +2086,77 @@ lumpnum_t R_GetFlatNumForName(const char *name)
 	return lump;
 }
 
-void R_ClearTextureNumCache(dboolean btell)
+static texnameslot_t *R_NameIndexSlot(const texnameindex_t *index, const char *name, uint32_t hash)
 {
-	if (tidcache)
-		Z_Free(tidcache);
-	tidcache = NULL;
-	if (btell)
-		CONS_Debug(DBG_SETUP, "Fun Fact: There are %d textures used in this map.\n", tidcachelen);
-	tidcachelen = 0;
+	const size_t mask = index->size - 1;
+	size_t i = hash & mask;
+
+	while (index->slots[i].id != -1)
+	{
+		if (index->slots[i].hash == hash && !strncasecmp(index->slots[i].name, name, 8))
+			break;
+
+		i = (i + 1) & mask;
+	}
+
+	return &index->slots[i];
+}
+
+static void R_GrowNameIndex(texnameindex_t *index)
+{
+	texnameslot_t *old = index->slots;
+	const size_t oldsize = index->size;
+	size_t i;
+
+	index->size = oldsize ? oldsize * 2 : 512;
+	index->slots = static_cast<texnameslot_t*>(Z_Malloc(index->size * sizeof (texnameslot_t), PU_STATIC, NULL));
+
+	for (i = 0; i < index->size; i++)
+		index->slots[i].id = -1;
+
+	for (i = 0; i < oldsize; i++)
+	{
+		if (old[i].id != -1)
+			*R_NameIndexSlot(index, old[i].name, old[i].hash) = old[i];
+	}
+
+	Z_Free(old);
+}
+
+int32_t R_FindInNameIndex(const texnameindex_t *index, const char *name)
+{
+	if (index->count == 0)
+		return -1;
+
+	return R_NameIndexSlot(index, name, quickncasehash(name, 8))->id;
+}
+
+void R_AddToNameIndex(texnameindex_t *index, const char *name, int32_t id)
+{
+	const uint32_t hash = quickncasehash(name, 8);
+	texnameslot_t *slot;
+
+	// Keep it at most half full so probes stay short.
+	if ((index->count + 1) * 2 > index->size)
+		R_GrowNameIndex(index);
+
+	slot = R_NameIndexSlot(index, name, hash);
+
+	if (slot->id == -1)
+	{
+		strncpy(slot->name, name, 8);
+		slot->hash = hash;
+		index->count++;
+	}
+
+	slot->id = id;
+}
+
+void R_ClearNameIndex(texnameindex_t *index)
+{
+	Z_Free(index->slots);
+	index->slots = NULL;
+	index->size = index->count = 0;
 }
 
 //
@@ -2102,35 +2166,13 @@ void R_ClearTextureNumCache(dboolean btell)
 //
 int32_t R_CheckTextureNumForName(const char *name)
 {
-	int32_t i;
-	uint32_t hash;
-
 	// "NoTexture" marker.
 	if (name[0] == '-')
 		return 0;
 
-	hash = quickncasehash(name, 8);
-
-	for (i = 0; i < tidcachelen; i++)
-		if (tidcache[i].hash == hash && !strncasecmp(tidcache[i].name, name, 8))
-			return tidcache[i].id;
-
-	// Need to parse the list backwards, so textures loaded more recently are used in lieu of ones loaded earlier
-	//for (i = 0; i < numtextures; i++) <- old
-	for (i = (numtextures - 1); i >= 0; i--) // <- new
-		if (textures[i]->hash == hash && !strncasecmp(textures[i]->name, name, 8))
-		{
-			tidcachelen++;
-			Z_Realloc(tidcache, tidcachelen * sizeof(*tidcache), PU_STATIC, &tidcache);
-			strncpy(tidcache[tidcachelen-1].name, name, 8);
-			tidcache[tidcachelen-1].name[8] = '\0';
-			CONS_Debug(DBG_SETUP, "texture #%s: %s\n", sizeu1(tidcachelen), tidcache[tidcachelen-1].name);
-			tidcache[tidcachelen-1].hash = hash;
-			tidcache[tidcachelen-1].id = i;
-			return i;
-		}
-
-	return -1;
+	// Textures loaded more recently replace ones loaded earlier,
+	// the index is filled in load order so it already has the newest.
+	return R_FindInNameIndex(&texturenameindex, name);
 }
 
 //
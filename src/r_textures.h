@@ -94,7 +94,6 @@ int32_t R_GetTextureBrightmap(int32_t texnum);
 dboolean R_TextureHasBrightmap(int32_t texnum);
 dboolean R_TextureCanRemap(int32_t texnum);
 void R_CheckTextureCache(int32_t tex);
-void R_ClearTextureNumCache(dboolean btell);
 
 // Retrieve texture data.
 void *R_GetLevelFlat(drawspandata_t* ds, levelflat_t *levelflat);
@@ -107,6 +106,30 @@ void R_CheckFlatLength(drawspandata_t* ds, size_t size);
 
 void R_UpdateTextureBrightmap(int32_t tx, int32_t bm);
 
+struct texnameslot_t
+{
+	char name[8];
+	uint32_t hash;
+	int32_t id; // -1 if the slot is empty
+};
+
+// Open addressed map from a texture or flat name (8 characters,
+// case insensitive) to a number. Zero initialize before use.
+struct texnameindex_t
+{
+	texnameslot_t *slots;
+	size_t size; // always a power of two
+	size_t count;
+};
+
+// Returns -1 if the name isn't in the index.
+int32_t R_FindInNameIndex(const texnameindex_t *index, const char *name);
+
+// Adds name, or changes its id if it's already there.
+void R_AddToNameIndex(texnameindex_t *index, const char *name, int32_t id);
+
+void R_ClearNameIndex(texnameindex_t *index);
+
 // Returns the texture number for the texture name.
 int32_t R_TextureNumForName(const char *name);
 int32_t R_CheckTextureNumForName(const char *name);
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 
+#include "core/vector.hpp"
+
 #include "doomdef.h"
 #include "console.h"
 #include "g_game.h"
@@ -703,9 +705,7 @@ void R_DrawMaskedColumn(drawcolumndata_t* dc, column_t *column, column_t *bright
 			// quick fix... something more proper should be done!!!
 			if (ylookup[dc->yl])
 			{
-				drawcolumndata_t dc_copy = *dc;
-				coldrawfunc_t* colfunccopy = colfunc;
-				colfunccopy(const_cast<drawcolumndata_t*>(&dc_copy));
+				R_SubmitColumn(colfunc, dc);
 			}
 #ifdef PARANOIA
 			else
@@ -731,6 +731,8 @@ void R_DrawFlippedMaskedColumn(drawcolumndata_t* dc, column_t *column, column_t
 	fixed_t basetexturemid = dc->texturemid;
 	int32_t topdelta, prevdelta = -1;
 	uint8_t *d,*s;
+	// Batched columns are drawn after we return, so the flipped copy can't be freed here
+	const dboolean batched = R_ColumnBatchActive();
 
 	R_SetColumnFunc(colfunctype, brightmap != NULL);
 	dc->brightmap = NULL;
@@ -774,14 +776,14 @@ void R_DrawFlippedMaskedColumn(drawcolumndata_t* dc, column_t *column, column_t
 
 		if (dc->yl <= dc->yh && dc->yh > 0 && column->length != 0)
 		{
-			dc->source = static_cast<uint8_t*>(ZZ_Alloc(column->length));
+			dc->source = static_cast<uint8_t*>(batched ? R_AllocColumnScratch(column->length) : ZZ_Alloc(column->length));
 			dc->sourcelength = column->length;
 			for (s = (uint8_t *)column+2+column->length, d = dc->source; d < dc->source+column->length; --s)
 				*d++ = *s;
 
 			if (brightmap != NULL)
 			{
-				dc->brightmap = static_cast<uint8_t*>(ZZ_Alloc(brightmap->length));
+				dc->brightmap = static_cast<uint8_t*>(batched ? R_AllocColumnScratch(brightmap->length) : ZZ_Alloc(brightmap->length));
 				for (s = (uint8_t *)brightmap+2+brightmap->length, d = dc->brightmap; d < dc->brightmap+brightmap->length; --s)
 					*d++ = *s;
 			}
@@ -791,15 +793,14 @@ void R_DrawFlippedMaskedColumn(drawcolumndata_t* dc, column_t *column, column_t
 			// Still drawn by R_DrawColumn.
 			if (ylookup[dc->yl])
 			{
-				drawcolumndata_t dc_copy = *dc;
-				coldrawfunc_t* colfunccopy = colfunc;
-				colfunccopy(const_cast<drawcolumndata_t*>(&dc_copy));
+				R_SubmitColumn(colfunc, dc);
 			}
 #ifdef PARANOIA
 			else
 				I_Error("R_DrawMaskedColumn: Invalid ylookup for dc_yl %d", dc->yl);
 #endif
-			Z_Free(dc->source);
+			if (!batched)
+				Z_Free(dc->source);
 		}
 		column = (column_t *)((uint8_t *)column + column->length + 4);
 		if (brightmap != NULL)
@@ -2647,12 +2648,6 @@ static void R_ProjectPrecipitationSprite(precipmobj_t *thing)
 	// uncapped/interpolation
 	interpmobjstate_t interp = {0};
 
-	// okay... this is a hack, but weather isn't networked, so it should be ok
-	if (!P_PrecipThinker(thing))
-	{
-		return;
-	}
-
 	// do interpolation
 	if (R_UsingFrameInterpolation() && !paused)
 	{
@@ -2885,6 +2880,44 @@ void R_AddSprites(sector_t *sec, int32_t lightlevel)
 	}
 }
 
+// R_GatherPrecipitation
+// Collects the visible precipitation within drawdist through the
+// blockmap and runs all of their thinkers in one batch, so both
+// renderers only have to project them. Freed drops are left as NULL
+// in the returned list, which lasts until the next call.
+//
+size_t R_GatherPrecipitation(fixed_t drawdist, precipmobj_t ***drops)
+{
+	static srb2::Vector<precipmobj_t *> gathered;
+
+	int32_t xl, xh, yl, yh, bx, by;
+	precipmobj_t *th;
+
+	gathered.clear();
+
+	R_GetRenderBlockMapDimensions(drawdist, &xl, &xh, &yl, &yh);
+
+	for (bx = xl; bx <= xh; bx++)
+	{
+		for (by = yl; by <= yh; by++)
+		{
+			for (th = precipblocklinks[(by * bmapwidth) + bx]; th; th = th->bnext)
+			{
+				if (R_PrecipThingVisible(th))
+				{
+					gathered.push_back(th);
+				}
+			}
+		}
+	}
+
+	// okay... this is a hack, but weather isn't networked, so it should be ok
+	P_PrecipThinkBatch(gathered.data(), gathered.size());
+
+	*drops = gathered.data();
+	return gathered.size();
+}
+
 // R_AddPrecipitationSprites
 // This renders through the blockmap instead of BSP to avoid
 // iterating a huge amount of precipitation sprites in sectors
@@ -2894,8 +2927,8 @@ void R_AddPrecipitationSprites(void)
 {
 	const fixed_t drawdist = cv_drawdist_precip.value * mapobjectscale;
 
-	int32_t xl, xh, yl, yh, bx, by;
-	precipmobj_t *th, *next;
+	precipmobj_t **drops;
+	size_t count, i;
 
 	// no, no infinite draw distance for precipitation. this option at zero is supposed to turn it off
 	if (drawdist == 0)
@@ -2909,22 +2942,13 @@ void R_AddPrecipitationSprites(void)
 		return;
 	}
 
-	R_GetRenderBlockMapDimensions(drawdist, &xl, &xh, &yl, &yh);
+	count = R_GatherPrecipitation(drawdist, &drops);
 
-	for (bx = xl; bx <= xh; bx++)
+	for (i = 0; i < count; i++)
 	{
-		for (by = yl; by <= yh; by++)
+		if (drops[i] != NULL)
 		{
-			for (th = precipblocklinks[(by * bmapwidth) + bx]; th; th = next)
-			{
-				// Store this beforehand because R_ProjectPrecipitionSprite may free th (see P_PrecipThinker)
-				next = th->bnext;
-
-				if (R_PrecipThingVisible(th))
-				{
-					R_ProjectPrecipitationSprite(th);
-				}
-			}
+			R_ProjectPrecipitationSprite(drops[i]);
 		}
 	}
 }
@@ -3460,9 +3484,15 @@ static void R_DrawSprite(vissprite_t *spr)
 	R_CheckDebugHighlight(SW_HI_THINGS);
 
 	if (spr->cut & SC_BBOX)
+	{
+		R_FlushColumnBatch();
 		R_DrawThingBoundingBox(spr);
+	}
 	else if (spr->cut & SC_SPLAT)
+	{
+		R_FlushColumnBatch();
 		R_DrawFloorSplat(spr);
+	}
 	else
 		R_DrawVisSprite(spr);
 }
@@ -3980,6 +4010,7 @@ static void R_DrawMaskedList (drawnode_t* head)
 		{
 			drawspandata_t ds = {0};
 			next = r2->prev;
+			R_FlushColumnBatch(); // spans cross strips
 			R_DrawSinglePlane(&ds, r2->plane, false);
 			R_DoneWithNode(r2);
 			r2 = next;
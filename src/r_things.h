@@ -69,6 +69,7 @@ fixed_t R_GetSpriteDirectionalLighting(angle_t angle);
 
 //SoM: 6/5/2000: Light sprites correctly!
 void R_AddSprites(sector_t *sec, int32_t lightlevel);
+size_t R_GatherPrecipitation(fixed_t drawdist, precipmobj_t ***drops);
 void R_AddPrecipitationSprites(void);
 void R_InitSprites(void);
 void R_ClearSprites(void);
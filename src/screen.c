@@ -79,6 +79,8 @@ void SCR_SetDrawFuncs(void)
 	//  setup the right draw routines
 	//
 
+	R_InitDrawSimd();
+
 	colfuncs[BASEDRAWFUNC] = R_DrawColumn;
 	colfuncs[COLDRAWFUNC_FUZZY] = R_DrawTranslucentColumn;
 	colfuncs[COLDRAWFUNC_TRANS] = R_DrawTranslatedColumn;
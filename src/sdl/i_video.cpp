@@ -1344,7 +1344,7 @@ dboolean VID_CheckRenderer(void)
 {
 	dboolean rendererchanged = false;
 
-	if (dedicated)
+	if (dedicated || M_CheckParm("-benchtics"))
 		return false;
 
 	if (setrenderneeded)
@@ -1499,7 +1499,8 @@ extern "C" CVarList* cvlist_graphics_driver;
 
 void I_StartupGraphics(void)
 {
-	if (dedicated)
+	// The replay benchmark never draws anything, so don't even open a window.
+	if (dedicated || M_CheckParm("-benchtics"))
 	{
 		rendermode = render_none;
 		return;
@@ -255,6 +255,9 @@ TYPEDEF (midVoteGUI_t);
 TYPEDEF (mapUserProperty_t);
 TYPEDEF (mapUserProperties_t);
 
+// lua_alloc.h
+TYPEDEF (lua_memstats_t);
+
 // lua_hudlib_drawlist.h
 typedef struct huddrawlist_s *huddrawlist_h;
 
@@ -284,6 +287,7 @@ TYPEDEF (matrix_t);
 // m_perfstats.h
 TYPEDEF (ps_hookinfo_t);
 TYPEDEF (ps_botinfo_t);
+TYPEDEF (ps_objstat_t);
 
 // m_queue.h
 TYPEDEF (mqueueitem_t);
@@ -299,6 +303,7 @@ TYPEDEF (jingle_t);
 TYPEDEF (tm_t);
 TYPEDEF (TryMoveResult_t);
 TYPEDEF (BasicFF_t);
+TYPEDEF (blockcell_t);
 
 // p_maputl.h
 TYPEDEF (divline_t);
@@ -433,6 +438,8 @@ TYPEDEF (sprcache_t);
 // r_textures.h
 TYPEDEF (texpatch_t);
 TYPEDEF (texture_t);
+TYPEDEF (texnameslot_t);
+TYPEDEF (texnameindex_t);
 
 // r_things.h
 TYPEDEF (maskcount_t);
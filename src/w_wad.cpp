@@ -34,6 +34,20 @@
 #include <unistd.h>
 #endif
 
+#if defined (_WIN32) && !defined (__CYGWIN__)
+#define WIN32_LEAN_AND_MEAN
+#define RPC_NO_WINDOWS_H
+#ifndef NOMINMAX
+#define NOMINMAX // std::min/std::max
+#endif
+#include <windows.h>
+#include <io.h>
+#define HAVE_FILEMAPPING
+#elif defined (__unix__) || defined (__APPLE__) || defined (__HAIKU__)
+#include <sys/mman.h>
+#define HAVE_MMAP
+#endif
+
 #define ZWAD
 
 #ifdef ZWAD
@@ -43,6 +57,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <mutex>
 
 #include "doomdef.h"
 #include "doomstat.h"
@@ -74,6 +89,10 @@
 
 #include "k_terrain.h"
 
+#include "core/string.h"
+#include "core/thread_pool.h"
+#include "core/vector.hpp"
+
 #ifdef HWRENDER
 #include "hardware/hw_main.h"
 #include "hardware/hw_glob.h"
@@ -108,6 +127,26 @@ typedef struct lumpnum_cache_s
 static lumpnum_cache_t lumpnumcache[LUMPNUMCACHESIZE];
 static uint16_t lumpnumcacheindex = 0;
 
+// Every lump of every added file by name, so looking one up
+// doesn't mean scanning every file. Only the lump each name
+// resolves to is kept: the first one in the newest file.
+typedef struct
+{
+	uint32_t hash;
+	lumpnum_t lumpnum; // LUMPERROR if the slot is free
+} lumpindexentry_t;
+
+typedef struct
+{
+	lumpindexentry_t *entries;
+	size_t size; // always a power of two
+	size_t count;
+	dboolean longnames; // keyed on longname, not name
+} lumpindex_t;
+
+static lumpindex_t g_lumpnameindex = {NULL, 0, 0, false};
+static lumpindex_t g_lumplongnameindex = {NULL, 0, 0, true};
+
 //===========================================================================
 //                                                                    GLOBALS
 //===========================================================================
@@ -118,6 +157,102 @@ static FILE *g_shaderspk3file;
 static uint16_t g_shaderspk3numlumps;
 static lumpinfo_t *g_shaderspk3lumps;
 
+// Taken around every seek and read of a wad file's handle: files
+// being added, files that couldn't be mapped, and the shaders pk3.
+static std::mutex g_wadreadmutex;
+
+// Maps the whole file read-only, so lumps can be read with no
+// seeking and from any thread. NULL if this isn't supported
+// or fails, in which case the file handle is used instead.
+static const uint8_t *W_MapWadFile(FILE *handle, size_t size)
+{
+	if (size == 0)
+		return NULL;
+
+#if defined (HAVE_FILEMAPPING)
+	HANDLE file = (HANDLE)_get_osfhandle(_fileno(handle));
+	HANDLE mapping;
+	void *view;
+
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL)
+		return NULL;
+
+	view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+	CloseHandle(mapping); // the view keeps it alive
+
+	return static_cast<const uint8_t*>(view);
+#elif defined (HAVE_MMAP)
+	void *view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(handle), 0);
+
+	if (view == MAP_FAILED)
+		return NULL;
+
+	return static_cast<const uint8_t*>(view);
+#else
+	(void)handle;
+	return NULL;
+#endif
+}
+
+static void W_UnmapWadFile(const uint8_t *mapped, size_t size)
+{
+	if (mapped == NULL)
+		return;
+
+#if defined (HAVE_FILEMAPPING)
+	(void)size;
+	UnmapViewOfFile(mapped);
+#elif defined (HAVE_MMAP)
+	munmap(const_cast<uint8_t*>(mapped), size);
+#else
+	(void)size;
+#endif
+}
+
+// Copies size bytes at position in the file into dest.
+// Returns how many could be read.
+static size_t W_ReadWadBytes(wadfile_t *wadfile, size_t position, void *dest, size_t size)
+{
+	if (wadfile->mapped != NULL)
+	{
+		if (position >= wadfile->filesize)
+			return 0;
+
+		size = std::min<size_t>(size, wadfile->filesize - position);
+		M_Memcpy(dest, wadfile->mapped + position, size);
+		return size;
+	}
+
+	std::lock_guard<std::mutex> lock(g_wadreadmutex);
+
+	fseek(wadfile->handle, (long)position, SEEK_SET);
+	return fread(dest, 1, size, wadfile->handle);
+}
+
+// Points at size bytes at position in the file, either in the
+// mapping or read into scratch.
+static const uint8_t *W_WadBytes(wadfile_t *wadfile, size_t position, size_t size, srb2::Vector<uint8_t> &scratch)
+{
+	if (wadfile->mapped != NULL)
+	{
+		if (position > wadfile->filesize || size > wadfile->filesize - position)
+			return NULL;
+
+		return wadfile->mapped + position;
+	}
+
+	scratch.resize(size);
+
+	if (W_ReadWadBytes(wadfile, position, scratch.data(), size) < size)
+		return NULL;
+
+	return scratch.data();
+}
+
 #ifndef NOMD5
 static void PrintMD5String(const uint8_t *md5, char *buf);
 #endif
@@ -129,10 +264,17 @@ static void PrintMD5String(const uint8_t *md5, char *buf);
 // being ejected
 void W_Shutdown(void)
 {
+	Z_Free(g_lumpnameindex.entries);
+	Z_Free(g_lumplongnameindex.entries);
+	g_lumpnameindex.entries = g_lumplongnameindex.entries = NULL;
+	g_lumpnameindex.size = g_lumplongnameindex.size = 0;
+	g_lumpnameindex.count = g_lumplongnameindex.count = 0;
+
 	while (numwadfiles--)
 	{
 		wadfile_t *wad = wadfiles[numwadfiles];
 
+		W_UnmapWadFile(wad->mapped, wad->filesize);
 		fclose(wad->handle);
 		Z_Free(wad->filename);
 		while (wad->numlumps--)
@@ -341,12 +483,199 @@ static inline int32_t W_MakeFileMD5(const char *filename, void *resblock)
 	return 1;
 }
 
+#ifndef NOMD5
+// Checksums W_InitMultipleFiles worked out ahead of time,
+// by the path W_OpenWadFile found the file at.
+struct prehashedfile_t
+{
+	srb2::String path;
+	uint8_t md5sum[16];
+	bool valid;
+};
+
+static srb2::Vector<prehashedfile_t> g_prehashedfiles;
+
+// Checksum every file in parallel before they're added one by
+// one. Reading each file through also leaves it in the OS's
+// cache for the directory and lump reads that come after.
+static void W_PrehashFiles(const initmultiplefilesentry_t *entries, int32_t count, dboolean addons)
+{
+	int32_t i;
+
+	g_prehashedfiles.clear();
+	g_prehashedfiles.resize(count);
+
+	// Finding a file uses filenamebuf, so do that up front.
+	for (i = 0; i < count; i++)
+	{
+		const char *filename = entries[i].filename;
+		FILE *handle = W_OpenWadFile(&filename, (addons ? "addons" : NULL), false);
+
+		if (handle == NULL)
+			continue;
+
+		fclose(handle);
+		g_prehashedfiles[i].path = filename;
+	}
+
+	auto hash = [](size_t first, size_t last)
+	{
+		for (size_t j = first; j < last; j++)
+		{
+			prehashedfile_t &file = g_prehashedfiles[j];
+			FILE *fhandle;
+
+			if (file.path.empty() || (fhandle = fopen(file.path.c_str(), "rb")) == NULL)
+				continue;
+
+			file.valid = (md5_stream(fhandle, file.md5sum) == 0);
+			fclose(fhandle);
+		}
+	};
+
+	if (srb2::g_main_threadpool != nullptr)
+		srb2::g_main_threadpool->parallel_for(0, count, 1, hash);
+	else
+		hash(0, count);
+}
+
+static bool W_FindPrehashedMD5(const char *filename, void *resblock)
+{
+	for (const prehashedfile_t &file : g_prehashedfiles)
+	{
+		if (file.valid && file.path == filename)
+		{
+			M_Memcpy(resblock, file.md5sum, 16);
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
 // Invalidates the cache of lump numbers. Call this whenever a wad is added.
 static void W_InvalidateLumpnumCache(void)
 {
 	memset(lumpnumcache, 0, sizeof (lumpnumcache));
 }
 
+static inline lumpinfo_t *W_IndexedLump(lumpnum_t lumpnum)
+{
+	return &wadfiles[WADFILENUM(lumpnum)]->lumpinfo[LUMPNUM(lumpnum)];
+}
+
+static inline uint32_t W_LongNameHash(const char *name)
+{
+	return quickncasehash(name, SIZE_MAX);
+}
+
+static dboolean W_IndexedLumpMatches(const lumpindex_t *index, lumpnum_t lumpnum, const char *name)
+{
+	const lumpinfo_t *lump = W_IndexedLump(lumpnum);
+
+	if (index->longnames)
+		return strcasecmp(lump->longname, name) == 0;
+
+	return strncasecmp(lump->name, name, 8) == 0;
+}
+
+// Returns the slot name is in, or the free slot it would go in.
+static lumpindexentry_t *W_LumpIndexSlot(const lumpindex_t *index, uint32_t hash, const char *name)
+{
+	size_t i = hash & (index->size - 1);
+
+	while (index->entries[i].lumpnum != LUMPERROR)
+	{
+		if (index->entries[i].hash == hash
+			&& W_IndexedLumpMatches(index, index->entries[i].lumpnum, name))
+		{
+			break;
+		}
+
+		i = (i + 1) & (index->size - 1);
+	}
+
+	return &index->entries[i];
+}
+
+static void W_GrowLumpIndex(lumpindex_t *index, size_t size)
+{
+	lumpindexentry_t *old = index->entries;
+	const size_t oldsize = index->size;
+	size_t i;
+
+	index->entries = static_cast<lumpindexentry_t*>(Z_Malloc(size * sizeof (*index->entries), PU_STATIC, NULL));
+	index->size = size;
+
+	for (i = 0; i < size; i++)
+		index->entries[i].lumpnum = LUMPERROR;
+
+	// Names are unique in here already, so no need to compare them.
+	for (i = 0; i < oldsize; i++)
+	{
+		size_t j;
+
+		if (old[i].lumpnum == LUMPERROR)
+			continue;
+
+		j = old[i].hash & (size - 1);
+		while (index->entries[j].lumpnum != LUMPERROR)
+			j = (j + 1) & (size - 1);
+
+		index->entries[j] = old[i];
+	}
+
+	Z_Free(old);
+}
+
+static void W_AddToLumpIndex(lumpindex_t *index, uint32_t hash, const char *name, lumpnum_t lumpnum)
+{
+	lumpindexentry_t *slot;
+
+	// Keep it at most half full.
+	if ((index->count + 1) * 2 > index->size)
+		W_GrowLumpIndex(index, index->size ? index->size * 2 : 4096);
+
+	slot = W_LumpIndexSlot(index, hash, name);
+
+	if (slot->lumpnum == LUMPERROR)
+		index->count++;
+
+	slot->hash = hash;
+	slot->lumpnum = lumpnum;
+}
+
+static lumpnum_t W_FindInLumpIndex(const lumpindex_t *index, uint32_t hash, const char *name)
+{
+	if (index->size == 0)
+		return LUMPERROR;
+
+	return W_LumpIndexSlot(index, hash, name)->lumpnum;
+}
+
+// Call once the wad has been added to wadfiles. It's the
+// newest file, so its lumps replace any of the same name.
+// Going backwards leaves the first of each name in the file.
+static void W_IndexLumps(uint16_t wad)
+{
+	const wadfile_t *wadfile = wadfiles[wad];
+	uint16_t i;
+
+	for (i = wadfile->numlumps; i-- > 0;)
+	{
+		const lumpinfo_t *lump = &wadfile->lumpinfo[i];
+		const lumpnum_t lumpnum = (wad << 16) | i;
+
+		// The WADNAME lump of a map WAD is hashed by its
+		// long name, so a short name scan never matched it.
+		if (lump->hash == quickncasehash(lump->name, 8))
+			W_AddToLumpIndex(&g_lumpnameindex, lump->hash, lump->name, lumpnum);
+
+		W_AddToLumpIndex(&g_lumplongnameindex, W_LongNameHash(lump->longname), lump->longname, lumpnum);
+	}
+}
+
 /** Detect a file type.
  * \todo Actually detect the wad/pkzip headers and whatnot, instead of just checking the extensions.
  */
@@ -848,7 +1177,10 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 	if ((handle = W_OpenWadFile(&filename, (mainfile ? NULL : "addons"), true)) == NULL)
 		return W_InitFileError(filename, startup);
 
-	important = W_VerifyNMUSlumps(filename, handle, startup);
+	{
+		std::lock_guard<std::mutex> lock(g_wadreadmutex);
+		important = W_VerifyNMUSlumps(filename, handle, startup);
+	}
 
 	if (important == -1)
 	{
@@ -864,7 +1196,11 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 	// Let's not add a wad file if the MD5 matches
 	// an MD5 of an already added WAD file!
 	//
-	W_MakeFileMD5(filename, md5sum);
+	if (!W_FindPrehashedMD5(filename, md5sum))
+	{
+		std::lock_guard<std::mutex> lock(g_wadreadmutex);
+		W_MakeFileMD5(filename, md5sum);
+	}
 
 	if (md5expected)
 	{
@@ -933,6 +1269,8 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 		G_SaveGameData();
 	}
 
+	std::unique_lock<std::mutex> readlock(g_wadreadmutex);
+
 	switch(type = ResourceFileDetect(filename))
 	{
 	case RET_SOC:
@@ -951,6 +1289,8 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 		CONS_Alert(CONS_ERROR, "Unsupported file format\n");
 	}
 
+	readlock.unlock();
+
 	if (lumpinfo == NULL)
 	{
 		fclose(handle);
@@ -972,8 +1312,11 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 	wadfile->numlumps = (uint16_t)numlumps;
 	wadfile->lumpinfo = lumpinfo;
 	wadfile->important = important;
+	readlock.lock();
 	fseek(handle, 0, SEEK_END);
 	wadfile->filesize = (unsigned)ftell(handle);
+	wadfile->mapped = W_MapWadFile(handle, wadfile->filesize);
+	readlock.unlock();
 	wadfile->type = type;
 
 	// already generated, just copy it over
@@ -991,6 +1334,7 @@ uint16_t W_InitFile(const char *filename, dboolean mainfile, dboolean startup, c
 	CONS_Printf(M_GetText("Added file %s (%u lumps)\n"), filename, numlumps);
 	wadfiles[numwadfiles] = wadfile;
 	numwadfiles++; // must come BEFORE W_LoadDehackedLumps, so any addfile called by COM_BufInsertText called by Lua doesn't overwrite what we just loaded
+	W_IndexLumps(numwadfiles - 1);
 
 	//
 	// fill out metadata
@@ -1066,6 +1410,10 @@ int32_t W_InitMultipleFiles(const initmultiplefilesentry_t *entries, int32_t cou
 	int32_t rc = 1;
 	int32_t overallrc = 1;
 
+#ifndef NOMD5
+	W_PrehashFiles(entries, count, addons);
+#endif
+
 	// will be realloced as lumps are added
 	for (i = 0; i < count; ++i)
 	{
@@ -1081,6 +1429,10 @@ int32_t W_InitMultipleFiles(const initmultiplefilesentry_t *entries, int32_t cou
 		overallrc &= (rc != INT16_MAX) ? 1 : 0;
 	}
 
+#ifndef NOMD5
+	g_prehashedfiles.clear();
+#endif
+
 	if (!numwadfiles)
 		I_Error("W_InitMultipleFiles: no files found");
 
@@ -1356,52 +1708,13 @@ uint16_t W_CheckNumForFullNamePK3(const char *name, uint16_t wad, uint16_t start
 //
 lumpnum_t W_CheckNumForName(const char *name)
 {
-	lumpnum_t check = INT16_MAX;
-	uint32_t hash = name ? quickncasehash(name, 8) : 0;
-	int32_t i;
-
 	if (name == NULL)
 		return LUMPERROR;
 
 	if (!*name) // some doofus gave us an empty string?
 		return LUMPERROR;
 
-	// Check the lumpnumcache first. Loop backwards so that we check
-	// most recent entries first
-	for (i = lumpnumcacheindex + LUMPNUMCACHESIZE; i > lumpnumcacheindex; i--)
-	{
-		if (!lumpnumcache[i & (LUMPNUMCACHESIZE - 1)].lumpname[8]
-			&& lumpnumcache[i & (LUMPNUMCACHESIZE - 1)].lumphash == hash
-			&& strncasecmp(lumpnumcache[i & (LUMPNUMCACHESIZE - 1)].lumpname, name, 8) == 0)
-		{
-			lumpnumcacheindex = i & (LUMPNUMCACHESIZE - 1);
-			return lumpnumcache[lumpnumcacheindex].lumpnum;
-		}
-	}
-
-	// scan wad files backwards so patch lump files take precedence
-	for (i = numwadfiles - 1; i >= 0; i--)
-	{
-		check = W_CheckNumForNamePwad(name,(uint16_t)i,0);
-		if (check != INT16_MAX)
-			break; //found it
-	}
-
-	if (check == INT16_MAX)
-	{
-		return LUMPERROR;
-	}
-	else
-	{
-		// Update the cache.
-		lumpnumcacheindex = (lumpnumcacheindex + 1) & (LUMPNUMCACHESIZE - 1);
-		memset(lumpnumcache[lumpnumcacheindex].lumpname, '\0', LUMPNUMCACHENAME);
-		strncpy(lumpnumcache[lumpnumcacheindex].lumpname, name, 8);
-		lumpnumcache[lumpnumcacheindex].lumpnum = (i << 16) | check;
-		lumpnumcache[lumpnumcacheindex].lumphash = hash;
-
-		return lumpnumcache[lumpnumcacheindex].lumpnum;
-	}
+	return W_FindInLumpIndex(&g_lumpnameindex, quickncasehash(name, 8), name);
 }
 
 //
@@ -1412,54 +1725,13 @@ lumpnum_t W_CheckNumForName(const char *name)
 //
 lumpnum_t W_CheckNumForLongName(const char *name)
 {
-	lumpnum_t check = INT16_MAX;
-	uint32_t hash = name ? quickncasehash(name, LUMPNUMCACHENAME) : 0;
-	int32_t i;
-
 	if (name == NULL)
 		return LUMPERROR;
 
 	if (!*name) // some doofus gave us an empty string?
 		return LUMPERROR;
 
-	// Check the lumpnumcache first. Loop backwards so that we check
-	// most recent entries first
-	for (i = lumpnumcacheindex + LUMPNUMCACHESIZE; i > lumpnumcacheindex; i--)
-	{
-		if (lumpnumcache[i & (LUMPNUMCACHESIZE - 1)].lumphash == hash
-			&& strcasecmp(lumpnumcache[i & (LUMPNUMCACHESIZE - 1)].lumpname, name) == 0)
-		{
-			lumpnumcacheindex = i & (LUMPNUMCACHESIZE - 1);
-			return lumpnumcache[lumpnumcacheindex].lumpnum;
-		}
-	}
-
-	// scan wad files backwards so patch lump files take precedence
-	for (i = numwadfiles - 1; i >= 0; i--)
-	{
-		check = W_CheckNumForLongNamePwad(name,(uint16_t)i,0);
-		if (check != INT16_MAX)
-			break; //found it
-	}
-
-	if (check == INT16_MAX)
-	{
-		return LUMPERROR;
-	}
-	else
-	{
-		if (strlen(name) < LUMPNUMCACHENAME)
-		{
-			// Update the cache.
-			lumpnumcacheindex = (lumpnumcacheindex + 1) & (LUMPNUMCACHESIZE - 1);
-			memset(lumpnumcache[lumpnumcacheindex].lumpname, '\0', LUMPNUMCACHENAME);
-			strlcpy(lumpnumcache[lumpnumcacheindex].lumpname, name, LUMPNUMCACHENAME);
-			lumpnumcache[lumpnumcacheindex].lumpnum = (i << 16) | check;
-			lumpnumcache[lumpnumcacheindex].lumphash = hash;
-		}
-
-		return (i << 16) | check;
-	}
+	return W_FindInLumpIndex(&g_lumplongnameindex, W_LongNameHash(name), name);
 }
 
 // Look for valid map data through all added files in descendant order.
@@ -1621,6 +1893,15 @@ lumpnum_t W_CheckNumForNameInFolder(const char *lump, const char *folder)
 uint8_t W_LumpExists(const char *name)
 {
 	int32_t i,j;
+	lumpnum_t lumpnum = W_CheckNumForLongName(name);
+
+	// The index ignores case, so it can only settle whether
+	// there's no such lump, or the one it found is an exact match.
+	if (lumpnum == LUMPERROR)
+		return false;
+	if (fastcmp(W_IndexedLump(lumpnum)->longname, name))
+		return true;
+
 	for (i = numwadfiles - 1; i >= 0; i--)
 	{
 		lumpinfo_t *lump_p = wadfiles[i]->lumpinfo;
@@ -1812,9 +2093,15 @@ void zerr(int ret)
   */
 size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size, size_t offset)
 {
+	// Compressed data has to be read or decompressed somewhere
+	// when it can't go straight into dest. One per thread, so
+	// reads don't allocate and don't need a lock.
+	static thread_local srb2::Vector<uint8_t> rawscratch;
+	static thread_local srb2::Vector<uint8_t> decscratch;
+
 	size_t lumpsize;
 	lumpinfo_t *l;
-	FILE *handle;
+	wadfile_t *wadfile;
 
 	if (!TestValidLump(wad,lump))
 		return 0;
@@ -1829,10 +2116,8 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 		size = lumpsize - offset;
 
 	// Let's get the raw lump data.
-	// We setup the desired file handle to read the lump data.
-	l = wadfiles[wad]->lumpinfo + lump;
-	handle = wadfiles[wad]->handle;
-	fseek(handle, (long)(l->position + offset), SEEK_SET);
+	wadfile = wadfiles[wad];
+	l = wadfile->lumpinfo + lump;
 
 	// But let's not copy it yet. We support different compression formats on lumps, so we need to take that into account.
 	switch(wadfiles[wad]->lumpinfo[lump].compression)
@@ -1840,26 +2125,37 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 	case CM_NOCOMPRESSION:		// If it's uncompressed, we directly write the data into our destination, and return the bytes read.
 #ifdef NO_PNG_LUMPS
 		{
-			size_t bytesread = fread(dest, 1, size, handle);
+			size_t bytesread = W_ReadWadBytes(wadfile, l->position + offset, dest, size);
 			if (Picture_IsLumpPNG((uint8_t *)dest, bytesread))
 				Picture_ThrowPNGError(l->fullname, wadfiles[wad]->filename);
 			return bytesread;
 		}
 #else
-		return fread(dest, 1, size, handle);
+		return W_ReadWadBytes(wadfile, l->position + offset, dest, size);
 #endif
 	case CM_LZF:		// Is it LZF compressed? Used by ZWADs.
 		{
 #ifdef ZWAD
-			char *rawData; // The lump's raw data.
-			char *decData; // Lump's decompressed real data.
+			const uint8_t *rawData; // The lump's raw data.
+			uint8_t *decData; // Lump's decompressed real data.
 			size_t retval; // Helper var, lzf_decompress returns 0 when an error occurs.
 
-			rawData = static_cast<char*>(Z_Malloc(l->disksize, PU_STATIC, NULL));
-			decData = static_cast<char*>(Z_Malloc(l->size, PU_STATIC, NULL));
-
-			if (fread(rawData, 1, l->disksize, handle) < l->disksize)
+			rawData = W_WadBytes(wadfile, l->position, l->disksize, rawscratch);
+			if (rawData == NULL)
 				I_Error("wad %d, lump %d: cannot read compressed data", wad, lump);
+
+			// Only the whole lump can be decompressed, so
+			// anything less goes through scratch first.
+			if (offset == 0 && size == l->size)
+			{
+				decData = static_cast<uint8_t*>(dest);
+			}
+			else
+			{
+				decscratch.resize(l->size);
+				decData = decscratch.data();
+			}
+
 			retval = lzf_decompress(rawData, l->disksize, decData, l->size);
 #ifndef AVOID_ERRNO
 			if (retval == 0) // If this was returned, check if errno was set
@@ -1877,11 +2173,8 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 				I_Error("wad %d, lump %d: decompressed to wrong number of bytes (expected %s, got %s)", wad, lump, sizeu1(l->size), sizeu2(retval));
 			}
 
-			if (!decData) // Did we get no data at all?
-				return 0;
-			M_Memcpy(dest, decData + offset, size);
-			Z_Free(rawData);
-			Z_Free(decData);
+			if (decData != dest)
+				M_Memcpy(dest, decData + offset, size);
 #ifdef NO_PNG_LUMPS
 			if (Picture_IsLumpPNG((uint8_t *)dest, size))
 				Picture_ThrowPNGError(l->fullname, wadfiles[wad]->filename);
@@ -1896,7 +2189,7 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 #ifdef HAVE_ZLIB
 	case CM_DEFLATE: // Is it compressed via DEFLATE? Very common in ZIPs/PK3s, also what most doom-related editors support.
 		{
-			uint8_t *rawData; // The lump's raw data.
+			const uint8_t *rawData; // The lump's raw data.
 			uint8_t *decData; // Lump's decompressed real data.
 
 			int zErr; // Helper var.
@@ -1904,10 +2197,10 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 			unsigned long rawSize = l->disksize;
 			unsigned long decSize = size;
 
-			rawData = static_cast<uint8_t*>(Z_Malloc(rawSize, PU_STATIC, NULL));
+			rawData = W_WadBytes(wadfile, l->position, rawSize, rawscratch);
 			decData = static_cast<uint8_t*>(dest);
 
-			if (fread(rawData, 1, rawSize, handle) < rawSize)
+			if (rawData == NULL)
 				I_Error("wad %d, lump %d: cannot read compressed data", wad, lump);
 
 			strm.zalloc = Z_NULL;
@@ -1917,7 +2210,7 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 			strm.total_in = strm.avail_in = rawSize;
 			strm.total_out = strm.avail_out = decSize;
 
-			strm.next_in = rawData;
+			strm.next_in = const_cast<Bytef*>(rawData);
 			strm.next_out = decData;
 
 			zErr = inflateInit2(&strm, -15);
@@ -1937,8 +2230,6 @@ size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size
 				zerr(zErr);
 			}
 
-			Z_Free(rawData);
-
 #ifdef NO_PNG_LUMPS
 			if (Picture_IsLumpPNG((uint8_t *)dest, size))
 				Picture_ThrowPNGError(l->fullname, wadfiles[wad]->filename);
@@ -2657,6 +2948,8 @@ dboolean W_ReadShader(const char *filename, size_t *size, void *dest)
 		return true;
 	}
 
+	std::lock_guard<std::mutex> lock(g_wadreadmutex);
+
 	if (fseek(g_shaderspk3file, lump->position, SEEK_SET) != 0)
 		I_Error("Failed to seek shaders pk3 to offset of file: %s", strerror(errno));
 
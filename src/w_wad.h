@@ -128,6 +128,7 @@ struct wadfile_t
 	lumpcache_t *patchcache;
 	uint16_t numlumps; // this wad's number of resources
 	FILE *handle;
+	const uint8_t *mapped; // the whole file, if it could be memory mapped
 	uint32_t filesize; // for network
 	uint8_t md5sum[16];
 
@@ -201,6 +202,8 @@ dboolean W_IsLumpFolder(uint16_t wad, uint16_t lump); // for detecting folder "l
 void zerr(int ret); // zlib error checking
 #endif
 
+// Lump reads are safe to make from any thread, as long as
+// no file is being added at the same time.
 size_t W_ReadLumpHeaderPwad(uint16_t wad, uint16_t lump, void *dest, size_t size, size_t offset);
 size_t W_ReadLumpHeader(lumpnum_t lump, void *dest, size_t size, size_t offest); // read all or a part of a lump
 void W_ReadLumpPwad(uint16_t wad, uint16_t lump, void *dest);